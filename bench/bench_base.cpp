@@ -0,0 +1,219 @@
+/*
+
+mkpoker - benchmarks for cards, ranges and suit normalization
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/cardset16.hpp>
+#include <mkpoker/base/cardset_combinations.hpp>
+#include <mkpoker/base/combo.hpp>
+#include <mkpoker/base/combo_range.hpp>
+#include <mkpoker/base/hand.hpp>
+#include <mkpoker/base/normalize.hpp>
+#include <mkpoker/base/range.hpp>
+#include <mkpoker/util/card_generator.hpp>
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    constexpr std::size_t c_num_samples = 4096;
+
+    // random hands and boards with the given number of board cards
+    std::vector<std::pair<mkp::hand_2c, mkp::cardset>> make_hands_w_board(const uint8_t num_board_cards)
+    {
+        mkp::card_dealer dealer{};
+        std::vector<std::pair<mkp::hand_2c, mkp::cardset>> ret;
+        ret.reserve(c_num_samples);
+        for (std::size_t i = 0; i < c_num_samples; ++i)
+        {
+            const auto cards = dealer.deal<7>();
+            ret.emplace_back(mkp::hand_2c{cards[0], cards[1]}, mkp::cardset{std::span<const mkp::card>(cards.data() + 2, num_board_cards)});
+        }
+        return ret;
+    }
+}    // namespace
+
+static void BM_range_from_string(benchmark::State& state)
+{
+    constexpr std::string_view str{"22+,A2s+,K9s+,QTs+,JTs,T9s,98s,87s,ATo+,KTo+,QJo"};
+    for (auto _ : state)
+    {
+        const mkp::range r{str};
+        benchmark::DoNotOptimize(r);
+    }
+}
+BENCHMARK(BM_range_from_string);
+
+static void BM_suit_normalization_permutation(benchmark::State& state)
+{
+    const auto samples = make_hands_w_board(static_cast<uint8_t>(state.range(0)));
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        const auto& [hand, board] = samples[i++ % c_num_samples];
+        benchmark::DoNotOptimize(mkp::suit_normalization_permutation(hand, board));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_suit_normalization_permutation)->DenseRange(3, 5);
+
+static void BM_suit_normalization_permutation16(benchmark::State& state)
+{
+    const auto samples = make_hands_w_board(static_cast<uint8_t>(state.range(0)));
+    std::vector<std::pair<mkp::hand_2c, mkp::cardset16>> samples16;
+    for (const auto& [hand, board] : samples)
+    {
+        samples16.emplace_back(hand, mkp::cardset16(board));
+    }
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        const auto& [hand, board] = samples16[i++ % c_num_samples];
+        benchmark::DoNotOptimize(mkp::suit_normalization_permutation(hand, board));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_suit_normalization_permutation16)->DenseRange(3, 5);
+
+template <typename T>
+static void BM_rotate_suits(benchmark::State& state)
+{
+    std::vector<T> samples;
+    for (const auto& [hand, board] : make_hands_w_board(5))
+    {
+        samples.emplace_back(board.combine(hand.as_cardset()));
+    }
+    constexpr std::array<uint8_t, 4> rotation{3, 0, 1, 2};
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(samples[i++ % c_num_samples].rotate_suits(rotation));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_rotate_suits, mkp::cardset);
+BENCHMARK_TEMPLATE(BM_rotate_suits, mkp::cardset16);
+
+static void BM_combo_range_normalize_dot(benchmark::State& state)
+{
+    mkp::combo_range r1(mkp::range{"22+,A2s+,K9s+,QTs+,JTs,T9s,98s,87s,ATo+,KTo+,QJo"});
+    const mkp::combo_range r2(0.5f);
+    for (auto _ : state)
+    {
+        r1 *= r2;
+        r1.normalize();
+        benchmark::DoNotOptimize(r1.dot(r2));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * 5 * sizeof(mkp::combo_range)));
+}
+BENCHMARK(BM_combo_range_normalize_dot);
+
+static void BM_blocked_combos(benchmark::State& state)
+{
+    const auto samples = make_hands_w_board(5);
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(mkp::blocked_combos(samples[i++ % c_num_samples].second));
+    }
+}
+BENCHMARK(BM_blocked_combos);
+
+static void BM_combo_range_remove_blocked(benchmark::State& state)
+{
+    const auto samples = make_hands_w_board(5);
+    mkp::combo_range r(1.0f);
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        r.remove_blocked(samples[i++ % c_num_samples].second);
+        benchmark::DoNotOptimize(r);
+    }
+}
+BENCHMARK(BM_combo_range_remove_blocked);
+
+// all k card subsets of the 48 remaining cards, nested loops with contains() as reference
+static void BM_cardset_combinations_nested(benchmark::State& state)
+{
+    const mkp::cardset dead("AcKd7h2s");
+    for (auto _ : state)
+    {
+        uint64_t sum = 0;
+        for (uint8_t i = 0; i < mkp::c_deck_size; ++i)
+        {
+            if (dead.contains(mkp::card{i}))
+            {
+                continue;
+            }
+            for (uint8_t j = i + 1; j < mkp::c_deck_size; ++j)
+            {
+                if (dead.contains(mkp::card{j}))
+                {
+                    continue;
+                }
+                for (uint8_t k = j + 1; k < mkp::c_deck_size; ++k)
+                {
+                    if (dead.contains(mkp::card{k}))
+                    {
+                        continue;
+                    }
+                    sum += mkp::cardset{mkp::card{i}, mkp::card{j}, mkp::card{k}}.as_bitset();
+                }
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * 17'296);
+}
+BENCHMARK(BM_cardset_combinations_nested);
+
+static void BM_cardset_combinations(benchmark::State& state)
+{
+    const mkp::cardset dead("AcKd7h2s");
+    const mkp::cardset_combinations combos(mkp::cardset{mkp::c_cardset_full & ~dead.as_bitset()}, static_cast<uint8_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        uint64_t sum = 0;
+        combos.for_each([&](const mkp::cardset cs) { sum += cs.as_bitset(); });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * combos.size()));
+}
+BENCHMARK(BM_cardset_combinations)->DenseRange(1, 3);
+
+static void BM_cardset_combinations_sample(benchmark::State& state)
+{
+    const mkp::cardset_combinations combos(mkp::cardset{mkp::c_cardset_full}, 5);
+    mkp::card_dealer dealer{};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(combos.sample(dealer.rng()));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_cardset_combinations_sample);
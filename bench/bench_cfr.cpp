@@ -0,0 +1,55 @@
+/*
+
+mkpoker - benchmarks for the cfr algorithm
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+
+#include <mkpoker/cfr/action_abstraction.hpp>
+#include <mkpoker/cfr/card_abstraction.hpp>
+#include <mkpoker/cfr/cfr.hpp>
+#include <mkpoker/cfr/game_abstraction.hpp>
+#include <mkpoker/cfr/node.hpp>
+#include <mkpoker/game/game.hpp>
+#include <mkpoker/util/card_generator.hpp>
+
+#include <cstdint>
+#include <utility>
+
+#include <benchmark/benchmark.h>
+
+// iterations of cfr for 'preflop poker' (see demo_cfr), stack size in BB
+static void BM_cfr_2p(benchmark::State& state)
+{
+    using game_type = mkp::gamestate<2, 0, 1>;
+    const game_type game{static_cast<int32_t>(state.range(0) * 1'000)};
+    mkp::gamestate_enumerator<game_type, uint32_t> enc{};
+    mkp::action_abstraction_simple_preflop<game_type> aa{};
+    mkp::card_abstraction_by_range<2, uint32_t> ca{};
+    auto gametree = mkp::init_tree(game, &enc, &aa);
+    mkp::cfr_data<2, game_type, uint32_t> cfrd(std::move(gametree), &enc, &aa, &ca);
+
+    mkp::card_dealer dealer{};
+    for (auto _ : state)
+    {
+        const mkp::gamecards<2> cards(dealer.deal<9>());
+        benchmark::DoNotOptimize(mkp::cfr_2p(cards, cfrd, cfrd.m_root.get(), {1.0, 1.0}));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_cfr_2p)->Arg(20)->Arg(200)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,339 @@
+/*
+
+mkpoker - benchmarks for hand evaluation and equity calculation
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+
+#include <mkpoker/base/card.hpp>
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/cardset16.hpp>
+#include <mkpoker/base/combo.hpp>
+#include <mkpoker/base/combo_range.hpp>
+#include <mkpoker/base/hand.hpp>
+#include <mkpoker/holdem/holdem_combo_evaluation.hpp>
+#include <mkpoker/holdem/holdem_equity_calculation.hpp>
+#include <mkpoker/holdem/holdem_evaluation.hpp>
+#include <mkpoker/holdem/holdem_showdown.hpp>
+#include <mkpoker/holdem/holdem_state_table.hpp>
+#include <mkpoker/omaha/omaha_equity_calculation.hpp>
+#include <mkpoker/omaha/omaha_evaluation.hpp>
+#include <mkpoker/shortdeck/shortdeck_equity_calculation.hpp>
+#include <mkpoker/shortdeck/shortdeck_evaluation.hpp>
+#include <mkpoker/util/card_generator.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    constexpr std::size_t c_num_samples = 1 << 16;
+
+    // random cardsets with n cards each
+    std::vector<mkp::cardset> make_cardsets(const uint8_t n)
+    {
+        mkp::card_dealer dealer{};
+        std::vector<mkp::cardset> ret;
+        ret.reserve(c_num_samples);
+        for (std::size_t i = 0; i < c_num_samples; ++i)
+        {
+            ret.push_back(dealer.deal_cardset(n));
+        }
+        return ret;
+    }
+}    // namespace
+
+static void BM_evaluate_unsafe(benchmark::State& state)
+{
+    const auto samples = make_cardsets(static_cast<uint8_t>(state.range(0)));
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(mkp::evaluate_unsafe(samples[i++ % c_num_samples]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_evaluate_unsafe)->DenseRange(5, 7);
+
+static void BM_evaluate_unsafe16(benchmark::State& state)
+{
+    const auto cardsets = make_cardsets(static_cast<uint8_t>(state.range(0)));
+    std::vector<mkp::cardset16> samples;
+    samples.reserve(cardsets.size());
+    for (const auto cs : cardsets)
+    {
+        samples.emplace_back(cs);
+    }
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(mkp::evaluate_unsafe(samples[i++ % c_num_samples]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_evaluate_unsafe16)->DenseRange(5, 7);
+
+template <std::size_t K>
+static void BM_evaluate(benchmark::State& state)
+{
+    const auto samples = make_cardsets(K);
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(mkp::evaluate<K>(samples[i++ % c_num_samples]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_evaluate, 5);
+BENCHMARK_TEMPLATE(BM_evaluate, 6);
+BENCHMARK_TEMPLATE(BM_evaluate, 7);
+
+static void BM_evaluate_batch(benchmark::State& state)
+{
+    const auto samples = make_cardsets(static_cast<uint8_t>(state.range(0)));
+    std::vector<uint32_t> results(c_num_samples);
+    for (auto _ : state)
+    {
+        mkp::evaluate_batch(samples, results);
+        benchmark::DoNotOptimize(results.data());
+    }
+    state.SetItemsProcessed(state.iterations() * c_num_samples);
+    state.SetLabel(std::string(mkp::to_string(mkp::cpu_level())));
+}
+BENCHMARK(BM_evaluate_batch)->DenseRange(5, 7);
+
+// all combos on random boards, direct evaluation of every combo
+static void BM_evaluate_combos_naive(benchmark::State& state)
+{
+    const auto boards = make_cardsets(static_cast<uint8_t>(state.range(0)));
+    std::size_t i = 0;
+    std::array<uint32_t, mkp::c_num_combos> results{};
+    for (auto _ : state)
+    {
+        const auto board = boards[i++ % c_num_samples];
+        (~mkp::blocked_combos(board)).for_each([&](const uint16_t idx) {
+            results[idx] = mkp::evaluate_unsafe(board.combine(mkp::combo_cardset(idx))).as_bitset();
+        });
+        benchmark::DoNotOptimize(results.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_evaluate_combos_naive)->DenseRange(3, 5)->Unit(benchmark::kMicrosecond);
+
+static void BM_evaluate_combos(benchmark::State& state)
+{
+    const auto boards = make_cardsets(static_cast<uint8_t>(state.range(0)));
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(mkp::evaluate_combos(boards[i++ % c_num_samples]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_evaluate_combos)->DenseRange(3, 5)->Unit(benchmark::kMicrosecond);
+
+// win / tie / lose weights of all hero combos against a villain range on the river, pairwise comparison as the baseline
+static void BM_river_showdown_pairwise(benchmark::State& state)
+{
+    const auto boards = make_cardsets(5);
+    const mkp::combo_range villain(0.5f);
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        const auto& board = boards[i++ % c_num_samples];
+        const auto values = mkp::evaluate_combos(board);
+        const auto live = ~mkp::blocked_combos(board);
+        std::array<mkp::showdown_weights_t, mkp::c_num_combos> ret{};
+        live.for_each([&](const uint16_t hero) {
+            live.for_each([&](const uint16_t v) {
+                if (!(mkp::detail::c_combo_bitsets[hero] & mkp::detail::c_combo_bitsets[v]))
+                {
+                    auto& r = ret[hero];
+                    (values[hero] > values[v] ? r.m_win : (values[hero] == values[v] ? r.m_tie : r.m_lose)) += villain[v];
+                }
+            });
+        });
+        benchmark::DoNotOptimize(ret);
+    }
+}
+BENCHMARK(BM_river_showdown_pairwise)->Unit(benchmark::kMicrosecond);
+
+static void BM_river_showdown(benchmark::State& state)
+{
+    const auto boards = make_cardsets(5);
+    const mkp::combo_range villain(0.5f);
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(mkp::river_showdown(boards[i++ % c_num_samples], villain));
+    }
+}
+BENCHMARK(BM_river_showdown)->Unit(benchmark::kMicrosecond);
+
+static void BM_calculate_equities_preflop(benchmark::State& state)
+{
+    const std::vector<mkp::hand_2c> hands{mkp::hand_2c{"AcAd"}, mkp::hand_2c{"Th9h"}};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(mkp::calculate_equities(hands));
+    }
+}
+BENCHMARK(BM_calculate_equities_preflop)->Unit(benchmark::kMillisecond);
+
+static void BM_calculate_equities_flop(benchmark::State& state)
+{
+    const std::vector<mkp::hand_2c> hands{mkp::hand_2c{"AcAd"}, mkp::hand_2c{"Th9h"}, mkp::hand_2c{"7s6s"}};
+    const std::vector<mkp::card> board{mkp::card{"8h"}, mkp::card{"5s"}, mkp::card{"2c"}};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(mkp::calculate_equities(hands, board));
+    }
+}
+BENCHMARK(BM_calculate_equities_flop)->Unit(benchmark::kMicrosecond);
+
+static void BM_calculate_equities_turn(benchmark::State& state)
+{
+    const std::vector<mkp::hand_2c> hands{mkp::hand_2c{"AcAd"}, mkp::hand_2c{"Th9h"}, mkp::hand_2c{"7s6s"}};
+    const std::vector<mkp::card> board{mkp::card{"8h"}, mkp::card{"5s"}, mkp::card{"2c"}, mkp::card{"Kd"}};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(mkp::calculate_equities(hands, board));
+    }
+}
+BENCHMARK(BM_calculate_equities_turn)->Unit(benchmark::kMicrosecond);
+
+// the table is created on first use (~130 MB in the working directory) and reused by later runs
+static const mkp::holdem_state_table& bench_state_table()
+{
+    static const mkp::holdem_state_table table = [] {
+        const std::string filename = "holdem_state_table.bin";
+        if (!std::filesystem::exists(filename))
+        {
+            mkp::save_state_table(filename, mkp::make_state_table());
+        }
+        return mkp::holdem_state_table(filename);
+    }();
+    return table;
+}
+
+static void BM_state_table(benchmark::State& state)
+{
+    const auto& table = bench_state_table();
+    const auto samples = make_cardsets(static_cast<uint8_t>(state.range(0)));
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(table.evaluate(samples[i++ % c_num_samples]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_state_table)->DenseRange(5, 7);
+
+static void BM_calculate_equities_preflop_state_table(benchmark::State& state)
+{
+    const auto& table = bench_state_table();
+    const std::vector<mkp::hand_2c> hands{mkp::hand_2c{"AcAd"}, mkp::hand_2c{"Th9h"}};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(mkp::calculate_equities(hands, {}, table));
+    }
+}
+BENCHMARK(BM_calculate_equities_preflop_state_table)->Unit(benchmark::kMillisecond);
+
+static void BM_calculate_equities_flop_state_table(benchmark::State& state)
+{
+    const auto& table = bench_state_table();
+    const std::vector<mkp::hand_2c> hands{mkp::hand_2c{"AcAd"}, mkp::hand_2c{"Th9h"}, mkp::hand_2c{"7s6s"}};
+    const std::vector<mkp::card> board{mkp::card{"8h"}, mkp::card{"5s"}, mkp::card{"2c"}};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(mkp::calculate_equities(hands, board, table));
+    }
+}
+BENCHMARK(BM_calculate_equities_flop_state_table)->Unit(benchmark::kMicrosecond);
+
+static void BM_evaluate_omaha(benchmark::State& state)
+{
+    const auto samples = make_cardsets(static_cast<uint8_t>(4 + state.range(0)));
+    std::vector<std::pair<mkp::cardset, mkp::cardset>> hands;
+    for (auto&& cs : samples)
+    {
+        const auto cards = cs.as_cards();
+        const mkp::cardset hole{cards[0], cards[1], cards[2], cards[3]};
+        auto board = cs;
+        board.remove(hole);
+        hands.emplace_back(hole, board);
+    }
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        const auto& [hole, board] = hands[i++ % c_num_samples];
+        benchmark::DoNotOptimize(mkp::evaluate_omaha_unsafe(hole, board));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_evaluate_omaha)->DenseRange(3, 5);
+
+static void BM_calculate_equities_omaha_flop(benchmark::State& state)
+{
+    const std::vector<mkp::cardset> hands{mkp::cardset{"AcAdKhQh"}, mkp::cardset{"Th9h8d7d"}, mkp::cardset{"7s6sJcJs"}};
+    const std::vector<mkp::card> board{mkp::card{"8h"}, mkp::card{"5s"}, mkp::card{"2c"}};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(mkp::calculate_equities_omaha(hands, board, static_cast<unsigned>(state.range(0))));
+    }
+}
+BENCHMARK(BM_calculate_equities_omaha_flop)->Arg(1)->Arg(4)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+static void BM_evaluate_shortdeck(benchmark::State& state)
+{
+    // random hands of the short deck
+    mkp::card_dealer dealer{};
+    std::vector<mkp::cardset> samples;
+    while (samples.size() < c_num_samples)
+    {
+        if (const auto cs = dealer.deal_cardset(static_cast<uint8_t>(state.range(0))); !(cs.as_bitset() & ~mkp::c_shortdeck_mask))
+        {
+            samples.push_back(cs);
+        }
+    }
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(mkp::evaluate_shortdeck_unsafe(samples[i++ % c_num_samples]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_evaluate_shortdeck)->DenseRange(5, 7);
+
+static void BM_calculate_equities_shortdeck_preflop(benchmark::State& state)
+{
+    const std::vector<mkp::hand_2c> hands{mkp::hand_2c{"AcAd"}, mkp::hand_2c{"Th9h"}};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(mkp::calculate_equities_shortdeck(hands));
+    }
+}
+BENCHMARK(BM_calculate_equities_shortdeck_preflop)->Unit(benchmark::kMillisecond);
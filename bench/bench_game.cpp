@@ -0,0 +1,156 @@
+/*
+
+mkpoker - benchmarks for the gamestate and game tree construction
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+
+#include <mkpoker/cfr/action_abstraction.hpp>
+#include <mkpoker/cfr/game_abstraction.hpp>
+#include <mkpoker/cfr/node.hpp>
+#include <mkpoker/game/game.hpp>
+#include <mkpoker/util/array.hpp>
+#include <mkpoker/util/card_generator.hpp>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    using game_type = mkp::gamestate<6, 0, 1>;
+    constexpr std::size_t c_num_samples = 4096;
+
+    // all non terminal states that occur while playing random hands
+    std::vector<game_type> make_gamestates()
+    {
+        mkp::xoshiro256ss rng{};
+        std::vector<game_type> ret;
+        ret.reserve(c_num_samples);
+        while (ret.size() < c_num_samples)
+        {
+            game_type game{20'000};
+            while (!game.in_terminal_state() && ret.size() < c_num_samples)
+            {
+                ret.push_back(game);
+                const auto actions = game.possible_actions();
+                game.execute_action(actions[rng.bounded(static_cast<uint32_t>(actions.size()))]);
+            }
+        }
+        return ret;
+    }
+}    // namespace
+
+static void BM_gamestate_possible_actions(benchmark::State& state)
+{
+    const auto samples = make_gamestates();
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(samples[i++ % c_num_samples].possible_actions());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_gamestate_possible_actions);
+
+static void BM_gamestate_execute_action(benchmark::State& state)
+{
+    // precompute one random valid action for every state, measure only execute_action
+    const auto samples = make_gamestates();
+    mkp::xoshiro256ss rng{};
+    std::vector<mkp::player_action_t> actions;
+    actions.reserve(c_num_samples);
+    for (auto&& game : samples)
+    {
+        const auto all_actions = game.possible_actions();
+        actions.push_back(all_actions[rng.bounded(static_cast<uint32_t>(all_actions.size()))]);
+    }
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        auto game = samples[i % c_num_samples];
+        game.execute_action(actions[i % c_num_samples]);
+        benchmark::DoNotOptimize(game);
+        ++i;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_gamestate_execute_action);
+
+// full game tree without action abstraction, stack size in BB
+static void BM_init_tree_noop(benchmark::State& state)
+{
+    using game_type_2p = mkp::gamestate<2, 0, 1>;
+    const game_type_2p game{static_cast<int32_t>(state.range(0) * 1'000)};
+    for (auto _ : state)
+    {
+        mkp::gamestate_enumerator<game_type_2p, uint32_t> enc{};
+        mkp::action_abstraction_noop<game_type_2p> aa{};
+        benchmark::DoNotOptimize(mkp::init_tree(game, &enc, &aa));
+    }
+}
+BENCHMARK(BM_init_tree_noop)->Arg(2)->Arg(3)->Arg(4)->Unit(benchmark::kMillisecond);
+
+// 'preflop poker' game tree, stack size in BB
+static void BM_init_tree_simple_preflop(benchmark::State& state)
+{
+    using game_type_2p = mkp::gamestate<2, 0, 1>;
+    const game_type_2p game{static_cast<int32_t>(state.range(0) * 1'000)};
+    for (auto _ : state)
+    {
+        mkp::gamestate_enumerator<game_type_2p, uint32_t> enc{};
+        mkp::action_abstraction_simple_preflop<game_type_2p> aa{};
+        benchmark::DoNotOptimize(mkp::init_tree(game, &enc, &aa));
+    }
+}
+BENCHMARK(BM_init_tree_simple_preflop)->Arg(20)->Arg(100)->Arg(200)->Unit(benchmark::kMicrosecond);
+
+static void BM_gamestate_payouts_showdown(benchmark::State& state)
+{
+    // terminal states with showdown (and often side pots) of random all in heavy games with random stacks
+    mkp::xoshiro256ss rng{};
+    mkp::card_dealer dealer{};
+    std::vector<std::pair<game_type, mkp::gamecards<6>>> samples;
+    samples.reserve(c_num_samples);
+    while (samples.size() < c_num_samples)
+    {
+        const auto chips = mkp::make_array<int32_t, 6>([&](const auto) { return static_cast<int32_t>(1'000 + rng.bounded(20) * 500); });
+        game_type game(chips);
+        while (!game.in_terminal_state())
+        {
+            const auto actions = game.possible_actions();
+            game.execute_action(actions[rng.bounded(static_cast<uint32_t>(actions.size()))]);
+        }
+        if (game.is_showdown())
+        {
+            samples.emplace_back(game, mkp::gamecards<6>(dealer.deal<17>()));
+        }
+    }
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        const auto& [game, cards] = samples[i++ % c_num_samples];
+        benchmark::DoNotOptimize(game.payouts_showdown(cards));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_gamestate_payouts_showdown);
@@ -0,0 +1,128 @@
+/*
+
+mkpoker - benchmarks for writing and parsing hand histories
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+
+#include <mkpoker/game/game.hpp>
+#include <mkpoker/game/handhistory.hpp>
+#include <mkpoker/game/hh_parser.hpp>
+#include <mkpoker/game/hh_stats.hpp>
+#include <mkpoker/util/array.hpp>
+#include <mkpoker/util/card_generator.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+#include <fmt/format.h>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    using game_type = mkp::gamestate<6, 1, 20>;
+    constexpr uint64_t c_num_hands = 50'000;
+
+    // random 6 player hands written by hh_ps
+    void write_random_hands(fmt::memory_buffer& buf, const uint64_t num_hands)
+    {
+        std::array<std::string, 6> names = {"Alf", "Bert", "Charles", "Dave", "Ethan", "Fred"};
+        mkp::card_dealer dealer{};
+        auto& rng = dealer.rng();
+        for (uint64_t i = 0; i < num_hands; ++i)
+        {
+            const auto chips = mkp::make_array<int32_t, 6>([&](auto) { return static_cast<int32_t>(1000 * (70 + rng.bounded(60))); });
+            const mkp::gamecards<6> cards(dealer.deal<17>());
+            auto game = game_type(chips);
+            auto printer = mkp::hh_ps(game, cards, names, buf, 2, 50'000, i);
+            while (!game.in_terminal_state())
+            {
+                const auto actions = game.possible_actions();
+                const auto action = actions[rng.bounded(static_cast<uint32_t>(actions.size()))];
+                game.execute_action(action);
+                printer.add_action(action);
+            }
+        }
+    }
+}    // namespace
+
+static void BM_hh_ps_write(benchmark::State& state)
+{
+    fmt::memory_buffer buf;
+    for (auto _ : state)
+    {
+        buf.clear();
+        write_random_hands(buf, 1000);
+    }
+    state.SetItemsProcessed(state.iterations() * 1000);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * buf.size()));
+}
+BENCHMARK(BM_hh_ps_write)->Unit(benchmark::kMillisecond);
+
+// parse a memory-mapped file, arg: number of threads
+static void BM_hh_ps_parse(benchmark::State& state)
+{
+    const std::string filename{"bench_hh_parser.txt"};
+    {
+        fmt::memory_buffer buf;
+        write_random_hands(buf, c_num_hands);
+        std::FILE* f = std::fopen(filename.c_str(), "wb");
+        std::fwrite(buf.data(), 1, buf.size(), f);
+        std::fclose(f);
+    }
+
+    std::size_t size = 0;
+    for (auto _ : state)
+    {
+        const mkp::hh_file_ps file(filename, static_cast<unsigned>(state.range(0)));
+        benchmark::DoNotOptimize(file.hands().data());
+        size = file.size();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * c_num_hands));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size));
+    std::filesystem::remove(filename);
+}
+BENCHMARK(BM_hh_ps_parse)->Arg(1)->Arg(4)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// aggregate player stats of a parsed file, arg: number of threads
+static void BM_hh_stats(benchmark::State& state)
+{
+    const std::string filename{"bench_hh_stats.txt"};
+    {
+        fmt::memory_buffer buf;
+        write_random_hands(buf, c_num_hands);
+        std::FILE* f = std::fopen(filename.c_str(), "wb");
+        std::fwrite(buf.data(), 1, buf.size(), f);
+        std::fclose(f);
+    }
+
+    const mkp::hh_file_ps file(filename);
+    for (auto _ : state)
+    {
+        mkp::hh_stats stats;
+        stats.add(file, static_cast<unsigned>(state.range(0)));
+        benchmark::DoNotOptimize(stats.num_hands());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * c_num_hands));
+    std::filesystem::remove(filename);
+}
+BENCHMARK(BM_hh_stats)->Arg(1)->Arg(4)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,96 @@
+/*
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+
+// built once per table size (MKP_EVAL_TABLE_SIZE = 0, 1, 2), compare the executables bench_lookup_tables_<size>
+
+#include <mkpoker/base/card.hpp>
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/hand.hpp>
+#include <mkpoker/holdem/holdem_equity_calculation.hpp>
+#include <mkpoker/holdem/holdem_evaluation.hpp>
+#include <mkpoker/holdem/holdem_lookup_tables.hpp>
+#include <mkpoker/util/card_generator.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    constexpr std::size_t c_num_samples = 1 << 16;
+
+    // random cardsets with n cards each
+    std::vector<mkp::cardset> make_cardsets(const uint8_t n)
+    {
+        mkp::card_dealer dealer{};
+        std::vector<mkp::cardset> ret;
+        ret.reserve(c_num_samples);
+        for (std::size_t i = 0; i < c_num_samples; ++i)
+        {
+            ret.push_back(dealer.deal_cardset(n));
+        }
+        return ret;
+    }
+
+    const std::string c_label = "table size " + std::to_string(MKP_EVAL_TABLE_SIZE);
+}    // namespace
+
+static void BM_evaluate_unsafe(benchmark::State& state)
+{
+    const auto samples = make_cardsets(static_cast<uint8_t>(state.range(0)));
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(mkp::evaluate_unsafe(samples[i++ % c_num_samples]));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetLabel(c_label);
+}
+BENCHMARK(BM_evaluate_unsafe)->DenseRange(5, 7);
+
+template <std::size_t K>
+static void BM_evaluate(benchmark::State& state)
+{
+    const auto samples = make_cardsets(K);
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(mkp::evaluate<K>(samples[i++ % c_num_samples]));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetLabel(c_label);
+}
+BENCHMARK_TEMPLATE(BM_evaluate, 5);
+BENCHMARK_TEMPLATE(BM_evaluate, 6);
+BENCHMARK_TEMPLATE(BM_evaluate, 7);
+
+static void BM_calculate_equities_preflop(benchmark::State& state)
+{
+    const std::vector<mkp::hand_2c> hands{mkp::hand_2c{"AcAd"}, mkp::hand_2c{"Th9h"}};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(mkp::calculate_equities(hands));
+    }
+    state.SetLabel(c_label);
+}
+BENCHMARK(BM_calculate_equities_preflop)->Unit(benchmark::kMillisecond);
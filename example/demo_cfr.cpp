@@ -103,7 +103,7 @@ int main()
         for (int tid = 0; tid < 8; ++tid)
         {
             workers.push_back(std::thread([&cfrd_2p, &mu, tid]() {
-                mkp::card_generator cgen{};
+                mkp::card_dealer dealer(1927, static_cast<uint32_t>(tid));
                 std::array<std::array<int32_t, 2>, 65536> util{};
                 for (uint32_t i = 0; i < 100'000; ++i)
                 {
@@ -127,7 +127,7 @@ int main()
                         }
                     }
 
-                    const mkp::gamecards<2> cards(cgen.generate_v(9));
+                    const mkp::gamecards<2> cards(dealer.deal<9>());
                     util[i % util.size()] = cfr_2p(cards, cfrd_2p, cfrd_2p.m_root.get(), {1.0, 1.0});
                 }
             }));
@@ -164,7 +164,7 @@ int main()
         for (int tid = 0; tid < 8; ++tid)
         {
             workers.push_back(std::thread([&cfrd_2p, &mu, tid]() {
-                mkp::card_generator cgen{};
+                mkp::card_dealer dealer(1927, static_cast<uint32_t>(tid));
                 std::array<std::array<int32_t, 2>, 65536> util{};
                 for (uint32_t i = 0; i < 500'000; ++i)
                 {
@@ -188,7 +188,7 @@ int main()
                         }
                     }
 
-                    const mkp::gamecards<2> cards(cgen.generate_v(9));
+                    const mkp::gamecards<2> cards(dealer.deal<9>());
                     util[i % util.size()] = cfr_2p(cards, cfrd_2p, cfrd_2p.m_root.get(), {1.0, 1.0});
                 }
             }));
@@ -0,0 +1,86 @@
+/*
+
+mkpoker - demo that builds a card abstraction by bucketing hands by EHS² percentiles
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/hand.hpp>
+#include <mkpoker/cfr/card_abstraction_ehs.hpp>
+#include <mkpoker/game/game.hpp>
+#include <mkpoker/util/card_generator.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <random>
+#include <string>
+
+#include <fmt/core.h>
+
+int main(int argc, char** argv)
+{
+    // usage: demo_ehs_abstraction [tables file] [buckets file]
+    const std::string fn_tables = argc > 1 ? argv[1] : "ehs_tables.bin";
+    const std::string fn_buckets = argc > 2 ? argv[2] : "ehs_buckets.bin";
+
+    //
+    // EHS / EHS² for all canonical hands, this is the expensive part
+    //
+    const auto t_start = std::chrono::steady_clock::now();
+    const auto tables = [&]() {
+        if (std::filesystem::exists(fn_tables))
+        {
+            fmt::print("loading tables from '{}'...", fn_tables);
+            return mkp::ehs_tables::load(fn_tables);
+        }
+        fmt::print("computing tables with {} threads...", mkp::default_num_threads());
+        auto ret = mkp::ehs_tables::generate();
+        ret.save(fn_tables);
+        return ret;
+    }();
+    const auto t_tables = std::chrono::steady_clock::now();
+    fmt::print(" done! ({} s)\n", std::chrono::duration_cast<std::chrono::seconds>(t_tables - t_start).count());
+
+    //
+    // bucket by percentile and save
+    //
+    fmt::print("bucketing...");
+    const mkp::card_abstraction_ehs<2> abstraction(tables, {50, 50, 50}, mkp::ehs_metric_t::EHS2);
+    abstraction.save(fn_buckets);
+    const auto t_buckets = std::chrono::steady_clock::now();
+    fmt::print(" done! ({} s), buckets saved to '{}'\n\n", std::chrono::duration_cast<std::chrono::seconds>(t_buckets - t_tables).count(),
+               fn_buckets);
+
+    //
+    // take some samples
+    //
+    mkp::card_generator cgen{std::random_device{}()};
+    for (auto i = 0; i < 10; ++i)
+    {
+        const mkp::gamecards<2> cards(cgen.generate_v(9));
+        fmt::print("{}\n", cards.str_cards());
+        for (auto gs : {mkp::gb_gamestate_t::PREFLOP_BET, mkp::gb_gamestate_t::FLOP_BET, mkp::gb_gamestate_t::TURN_BET,
+                        mkp::gb_gamestate_t::RIVER_BET})
+        {
+            fmt::print("    {}\n", abstraction.str_id(gs, abstraction.id(gs, 0, cards)));
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,139 @@
+/*
+
+mkpoker - demo that builds a card abstraction by clustering hands with k-means (EMD / OCHS)
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <mkpoker/base/hand_indexer.hpp>
+#include <mkpoker/cfr/card_abstraction_buckets.hpp>
+#include <mkpoker/cfr/card_abstraction_ehs.hpp>
+#include <mkpoker/cfr/card_abstraction_kmeans.hpp>
+#include <mkpoker/game/game.hpp>
+#include <mkpoker/util/card_generator.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <numeric>
+#include <random>
+#include <string>
+
+#include <fmt/core.h>
+
+int main(int argc, char** argv)
+{
+    // usage: demo_kmeans_abstraction [ehs tables file] [bucket file] [number of buckets per street]
+    const std::string fn_tables = argc > 1 ? argv[1] : "ehs_tables.bin";
+    const std::string fn_buckets = argc > 2 ? argv[2] : "kmeans_buckets.bin";
+    const uint32_t num_buckets = argc > 3 ? static_cast<uint32_t>(std::stoul(argv[3])) : 200;
+
+    mkp::kmeans_abstraction_options_t options{};
+    options.m_num_buckets = {num_buckets, num_buckets, num_buckets};
+    // stop when less than 0.1% of the hands change their bucket
+    options.m_kmeans.m_tolerance = 0.001;
+    const auto num_threads = options.m_kmeans.m_num_threads;
+
+    auto t_last = std::chrono::steady_clock::now();
+    const auto print_elapsed = [&]() {
+        const auto t_now = std::chrono::steady_clock::now();
+        fmt::print(" done! ({} s)\n", std::chrono::duration_cast<std::chrono::seconds>(t_now - t_last).count());
+        t_last = t_now;
+    };
+
+    //
+    // the river hand strengths are the basis for all histograms
+    //
+    const auto tables = [&]() {
+        if (std::filesystem::exists(fn_tables))
+        {
+            fmt::print("loading EHS tables from '{}'...", fn_tables);
+            return mkp::ehs_tables::load(fn_tables);
+        }
+        fmt::print("computing EHS tables with {} threads...", num_threads);
+        auto ret = mkp::ehs_tables::generate(num_threads);
+        ret.save(fn_tables);
+        return ret;
+    }();
+    print_elapsed();
+
+    mkp::bucket_tables_t buckets{};
+    buckets.m_num_buckets[0] = static_cast<uint32_t>(mkp::hand_indexer_preflop::size(0));
+    buckets.m_buckets[0].resize(mkp::hand_indexer_preflop::size(0));
+    std::iota(buckets.m_buckets[0].begin(), buckets.m_buckets[0].end(), uint16_t(0));
+
+    //
+    // flop and turn: equity histograms, EMD
+    //
+    {
+        fmt::print("flop: computing equity histograms...");
+        const auto features = mkp::equity_histograms_flop(tables, options.m_num_bins, num_threads);
+        print_elapsed();
+        fmt::print("flop: clustering {} hands into {} buckets...", mkp::hand_indexer_flop::size(1), options.m_num_buckets[0]);
+        buckets.m_num_buckets[1] = options.m_num_buckets[0];
+        buckets.m_buckets[1] = mkp::cluster_buckets<uint16_t>(features, options.m_num_bins, options.m_num_buckets[0],
+                                                              mkp::kmeans_distance_t::L1, false, options.m_kmeans);
+        print_elapsed();
+    }
+    {
+        fmt::print("turn: computing equity histograms...");
+        const auto features = mkp::equity_histograms_turn(tables, options.m_num_bins, num_threads);
+        print_elapsed();
+        fmt::print("turn: clustering {} hands into {} buckets...", mkp::hand_indexer_turn::size(1), options.m_num_buckets[1]);
+        buckets.m_num_buckets[2] = options.m_num_buckets[1];
+        buckets.m_buckets[2] = mkp::cluster_buckets<uint8_t>(features, options.m_num_bins, options.m_num_buckets[1],
+                                                             mkp::kmeans_distance_t::L1, false, options.m_kmeans);
+        print_elapsed();
+    }
+
+    //
+    // river: OCHS, euclidean distance
+    //
+    {
+        fmt::print("river: computing OCHS features...");
+        const auto clusters = mkp::ochs_opponent_clusters(tables, options.m_num_opponent_clusters, num_threads);
+        const auto features = mkp::ochs_features_river(clusters, options.m_num_opponent_clusters, num_threads);
+        print_elapsed();
+        fmt::print("river: clustering {} hands into {} buckets...", mkp::hand_indexer_river::size(1), options.m_num_buckets[2]);
+        buckets.m_num_buckets[3] = options.m_num_buckets[2];
+        buckets.m_buckets[3] = mkp::cluster_buckets<uint8_t>(features, options.m_num_opponent_clusters, options.m_num_buckets[2],
+                                                             mkp::kmeans_distance_t::L2, true, options.m_kmeans);
+        print_elapsed();
+    }
+
+    mkp::save_bucket_file(fn_buckets, buckets);
+    fmt::print("buckets saved to '{}'\n\n", fn_buckets);
+
+    //
+    // take some samples
+    //
+    // the bucket file is memory mapped, i.e., it is only loaded on demand and shared between processes
+    const mkp::card_abstraction_mmap<2> abstraction(fn_buckets);
+    mkp::card_generator cgen{std::random_device{}()};
+    for (auto i = 0; i < 10; ++i)
+    {
+        const mkp::gamecards<2> cards(cgen.generate_v(9));
+        fmt::print("{}\n", cards.str_cards());
+        for (auto gs : {mkp::gb_gamestate_t::PREFLOP_BET, mkp::gb_gamestate_t::FLOP_BET, mkp::gb_gamestate_t::TURN_BET,
+                        mkp::gb_gamestate_t::RIVER_BET})
+        {
+            fmt::print("    {}\n", abstraction.str_id(gs, abstraction.id(gs, 0, cards)));
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
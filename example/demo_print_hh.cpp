@@ -25,13 +25,19 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <mkpoker/game/game.hpp>
 #include <mkpoker/game/handhistory.hpp>
+#include <mkpoker/game/hh_binary.hpp>
+#include <mkpoker/game/hh_parser.hpp>
+#include <mkpoker/game/hh_writer.hpp>
 #include <mkpoker/util/array.hpp>
 #include <mkpoker/util/card_generator.hpp>
 
 #include <algorithm>    // std::rotate
 #include <array>        //
+#include <chrono>       //
 #include <cstdio>       //
 #include <random>       //
+#include <thread>       //
+#include <vector>       //
 
 #include <fmt/core.h>
 
@@ -146,10 +152,65 @@ int main()
         if (cnt > 100)
         {
             std::fclose(f_hh);
-
-            return EXIT_SUCCESS;
+            break;
         }
 
         ++hand_id;
     }
+
+    // many hands from several threads: every thread formats into its own buffer,
+    // complete blocks of hands are written to one file by the sink
+    constexpr unsigned c_num_threads = 4;
+    constexpr uint64_t c_hands_per_thread = 25'000;
+    f_hh = std::fopen("hh03.txt", "w");
+    const auto start = std::chrono::steady_clock::now();
+    {
+        mkp::hh_sink sink(f_hh);
+        std::vector<std::thread> threads;
+        for (unsigned t = 0; t < c_num_threads; ++t)
+        {
+            threads.emplace_back([&sink, t, hand_id]() {
+                mkp::hh_buffer out(sink);
+                mkp::card_dealer dealer(1927, t);
+                auto& rng_thread = dealer.rng();
+                for (uint64_t i = 0; i < c_hands_per_thread; ++i)
+                {
+                    std::array<std::string, c_num_players_game_6> names = {"Alf", "Bert", "Charles", "Dave", "Ethan", "Fred"};
+                    const auto chips = mkp::make_array<int, c_num_players_game_6>(
+                        [&](auto) { return static_cast<int>(1000 * (70 + rng_thread.bounded(61))); });
+                    const mkp::gamecards<c_num_players_game_6> gamecards(dealer.deal<5 + 2 * c_num_players_game_6>());
+                    auto game = mkp::gamestate<c_num_players_game_6, 50, 100>(chips);
+                    auto hh_printer = mkp::hh_ps(game, gamecards, names, out.buffer(), 2, 50'000, hand_id + t * c_hands_per_thread + i);
+                    while (!game.in_terminal_state())
+                    {
+                        const auto vec_actions = game.possible_actions();
+                        const auto action = vec_actions[rng_thread.bounded(static_cast<uint32_t>(vec_actions.size()))];
+                        game.execute_action(action);
+                        hh_printer.add_action(action);
+                    }
+                    out.commit();
+                }
+            });
+        }
+        std::for_each(threads.begin(), threads.end(), [](std::thread& t) { t.join(); });
+        sink.close();
+    }
+    std::fclose(f_hh);
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    fmt::print("wrote {} hand histories with {} threads in {:.2f}s\n", c_num_threads * c_hands_per_thread, c_num_threads,
+               elapsed.count());
+
+    // parse the hands again and convert them into the compact binary format
+    const auto start_convert = std::chrono::steady_clock::now();
+    const mkp::hh_file_ps hh_file("hh03.txt");
+    const auto num_converted = [&]() {
+        mkp::hh_binary_writer writer("hh03.bin");
+        return mkp::hh_convert(hh_file, writer);
+    }();
+    const std::chrono::duration<double> elapsed_convert = std::chrono::steady_clock::now() - start_convert;
+    const mkp::hh_binary_reader hh_binary("hh03.bin");
+    fmt::print("converted {} hand histories ({} bytes) into {} bytes in {:.2f}s\n", num_converted, hh_file.size(), hh_binary.size(),
+               elapsed_convert.count());
+
+    return EXIT_SUCCESS;
 }
\ No newline at end of file
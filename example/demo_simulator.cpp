@@ -0,0 +1,80 @@
+/*
+
+mkpoker - demo that evaluates agents against each other with the batch hand simulator
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+
+#include <mkpoker/game/game.hpp>
+#include <mkpoker/game/simulator.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <fmt/core.h>
+
+namespace
+{
+    void print_results(const std::vector<std::string>& names, const mkp::simulation_result_t& result, const double seconds)
+    {
+        fmt::print("{} hands in {:.2f}s ({:.0f} hands/s)\n", result.m_num_hands, seconds, result.m_num_hands / seconds);
+        fmt::print(" Agent            |    bb/100 |  95% CI \n");
+        fmt::print("------------------+-----------+---------\n");
+        for (unsigned i = 0; i < names.size(); ++i)
+        {
+            const auto& agent = result.m_agents[i];
+            fmt::print(" {:<16} | {:>9.2f} | {:>7.2f}\n", names[i], agent.bb_per_100(), agent.m_ci95 / 10.0);
+        }
+        fmt::print("\n");
+    }
+}    // namespace
+
+int main()
+{
+    mkp::simulation_options_t options{};
+    options.m_num_deals = 200'000;
+
+    // heads up: a calling station against a random player
+    {
+        mkp::hand_simulator<2> sim({mkp::calling_station_policy<2>, mkp::random_policy<2>});
+        const auto start = std::chrono::steady_clock::now();
+        const auto result = sim.run(options);
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        print_results({"calling station", "random"}, result, elapsed.count());
+    }
+
+    // six players with a custom policy: always fold unless checking is possible
+    {
+        using game_type = mkp::gamestate<6, 0, 1>;
+        const mkp::policy_t<6> check_fold = [](const game_type& game, const mkp::hand_2c, const mkp::cardset, mkp::xoshiro256ss&) {
+            return mkp::player_action_t{0, game.amount_to_call() == 0 ? mkp::gb_action_t::CHECK : mkp::gb_action_t::FOLD,
+                                        game.active_player_v()};
+        };
+        mkp::hand_simulator<6> sim({mkp::calling_station_policy<6>, mkp::random_policy<6>, check_fold, mkp::calling_station_policy<6>,
+                                    mkp::random_policy<6>, check_fold});
+        options.m_num_deals = 50'000;
+        const auto start = std::chrono::steady_clock::now();
+        const auto result = sim.run(options);
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        print_results({"calling station", "random", "check/fold", "calling station", "random", "check/fold"}, result, elapsed.count());
+    }
+
+    return 0;
+}
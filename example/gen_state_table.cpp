@@ -0,0 +1,50 @@
+/*
+
+mkpoker - generator for the state table of the memory mapped hand evaluator
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include <mkpoker/holdem/holdem_state_table.hpp>
+
+#include <chrono>
+#include <string>
+
+#include <fmt/core.h>
+
+// usage: gen_state_table [filename]
+int main(int argc, char** argv)
+{
+    const std::string filename = argc > 1 ? argv[1] : "holdem_state_table.bin";
+
+    const auto t1 = std::chrono::high_resolution_clock::now();
+    const auto table = mkp::make_state_table();
+    mkp::save_state_table(filename, table);
+    const auto t2 = std::chrono::high_resolution_clock::now();
+
+    fmt::print("{} states ({} MB) written to '{}' in {} ms\n", table.size() / mkp::c_state_table_stride,
+               table.size() * sizeof(uint32_t) / (1024 * 1024), filename,
+               std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count());
+
+    // quick check
+    const mkp::holdem_state_table st(filename);
+    auto cursor = st.start();
+    cursor.add(mkp::cardset("AhKhQhJhTh2c3d"));
+    fmt::print("AhKhQhJhTh2c3d: {}\n", cursor.result().str());
+
+    return 0;
+}
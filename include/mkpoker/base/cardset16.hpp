@@ -0,0 +1,248 @@
+/*
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+
+#pragma once
+
+#include <mkpoker/base/card.hpp>
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/util/bit.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace mkp
+{
+    inline namespace constants
+    {
+        // width of a suit in the cardset16 layout
+        constexpr uint8_t c_cardset16_suit_bits = 16;
+
+        constexpr uint64_t c_cardset16_full = 0x1FFF'1FFF'1FFF'1FFF;
+    }    // namespace constants
+
+    // same as cardset, but every suit is a 16 bit lane (clubs in the lowest bits) and the upper 3 bits of each lane are zero
+    // the suit masks are plain 16 bit words, so suit rotations are word shuffles and the masks map directly to simd lanes;
+    // use it for code that works on suit masks (evaluation, normalization) and convert from / to cardset at the boundaries
+    class cardset16
+    {
+        // internal encoding
+        uint64_t m_cards = 0;
+
+        // private helper to create from bitset
+        [[nodiscard]] static constexpr cardset16 from_bits(const uint64_t bits) noexcept
+        {
+            cardset16 ret{};
+            ret.m_cards = bits;
+            return ret;
+        }
+
+       public:
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // CTORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // empty cardset
+        cardset16() = default;
+
+        // create from bitset (cardset16 layout), throws if bits outside of the lanes are set
+        constexpr explicit cardset16(const uint64_t& bitset) : m_cards(bitset)
+        {
+            if (bitset & ~c_cardset16_full)
+            {
+                throw std::runtime_error("cardset16(const uint64_t): invalid bits set in argument " + std::to_string(bitset));
+            }
+        }
+
+        // convert from the 13 bit layout
+        constexpr explicit cardset16(const cardset cs) noexcept
+        {
+            const uint64_t m = cs.as_bitset();
+            m_cards = (m & c_mask_ranks) | (((m >> (1 * c_num_ranks)) & c_mask_ranks) << (1 * c_cardset16_suit_bits)) |
+                      (((m >> (2 * c_num_ranks)) & c_mask_ranks) << (2 * c_cardset16_suit_bits)) |
+                      (((m >> (3 * c_num_ranks)) & c_mask_ranks) << (3 * c_cardset16_suit_bits));
+        }
+
+        // create with init list
+        constexpr explicit cardset16(const std::initializer_list<const card> li) noexcept
+        {
+            for (auto&& c : li)
+            {
+                insert(c);
+            }
+        }
+
+        // create from string, i.e. "AcKs2h", throws if ill-formed
+        constexpr explicit cardset16(const std::string_view sv) : cardset16(cardset(sv)) {}
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // ACCESSORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // return size / number of unique cards
+        [[nodiscard]] constexpr size_t size() const noexcept { return std::popcount(m_cards); }
+
+        // return bit mask (cardset16 layout)
+        [[nodiscard]] constexpr uint64_t as_bitset() const noexcept { return m_cards; }
+
+        // convert to the 13 bit layout
+        [[nodiscard]] constexpr cardset as_cardset() const noexcept
+        {
+            const auto m = suit_masks();
+            return cardset{uint64_t(m[0]) | (uint64_t(m[1]) << (1 * c_num_ranks)) | (uint64_t(m[2]) << (2 * c_num_ranks)) |
+                           (uint64_t(m[3]) << (3 * c_num_ranks))};
+        }
+
+        // ranks of one suit
+        [[nodiscard]] constexpr uint16_t suit_mask(const uint8_t s) const noexcept
+        {
+            return static_cast<uint16_t>(m_cards >> (s * c_cardset16_suit_bits));
+        }
+
+        // ranks of all suits (clubs, diamonds, hearts, spades), a reinterpretation of the bits on little endian machines
+        [[nodiscard]] constexpr std::array<uint16_t, c_num_suits> suit_masks() const noexcept
+        {
+            if constexpr (std::endian::native == std::endian::little)
+            {
+                return std::bit_cast<std::array<uint16_t, c_num_suits>>(m_cards);
+            }
+            else
+            {
+                return {suit_mask(0), suit_mask(1), suit_mask(2), suit_mask(3)};
+            }
+        }
+
+        // return string representation
+        [[nodiscard]] std::string str() const noexcept { return as_cardset().str(); }
+
+        // check if the card is in the set
+        [[nodiscard]] constexpr bool contains(const card c) const noexcept { return (m_cards & card_bit(c)) != 0; }
+
+        // check if all cards from cs are in the set (i.e. cs is a subset)
+        [[nodiscard]] constexpr bool contains(const cardset16& cs) const noexcept { return (m_cards | cs.m_cards) == m_cards; }
+
+        // check if cs is exclusive to this
+        [[nodiscard]] constexpr bool disjoint(const cardset16& cs) const noexcept { return (m_cards & cs.m_cards) == 0; }
+
+        // check if cs has joined cards with this
+        [[nodiscard]] constexpr bool intersects(const cardset16& cs) const noexcept { return (m_cards & cs.m_cards) != 0; }
+
+        // returns a new cs, combine with card
+        [[nodiscard]] constexpr cardset16 combine(const card c) const noexcept { return from_bits(m_cards | card_bit(c)); }
+
+        // returns a new cs, combine with cardset
+        [[nodiscard]] constexpr cardset16 combine(const cardset16& cs) const noexcept { return from_bits(m_cards | cs.m_cards); }
+
+        // get the suit rotation vector that transforms this cardset into the normalized form, same as cardset
+        [[nodiscard]] constexpr std::array<uint8_t, 4> get_normalization_vector() const noexcept
+        {
+            const auto masks = suit_masks();
+            using pui16 = std::pair<uint16_t, uint16_t>;
+            std::array<pui16, 4> temp{{{uint16_t(0), masks[0]}, {uint16_t(1), masks[1]}, {uint16_t(2), masks[2]}, {uint16_t(3), masks[3]}}};
+
+            std::sort(temp.begin(), temp.end(), [](const pui16& lhs, const pui16& rhs) {
+                if (std::popcount(lhs.second) == std::popcount(rhs.second))
+                {
+                    return lhs.second > rhs.second;
+                }
+                return std::popcount(lhs.second) > std::popcount(rhs.second);
+            });
+
+            std::array<uint8_t, 4> ret{};
+            for (uint8_t u = 0; u < 4; ++u)
+            {
+                ret[temp[u].first] = u;
+            }
+            return ret;
+        }
+
+        // returns a new cs, rotate the suits (suit i becomes suit r[i]), i.e. a shuffle of the 16 bit words
+        [[nodiscard]] constexpr cardset16 rotate_suits(const std::array<uint8_t, 4>& r) const
+        {
+            if (const int i = (1 << r[0] | 1 << r[1] | 1 << r[2] | 1 << r[3]); i != 0b0'1111)
+            {
+                throw std::runtime_error("duplicate or invalid arguments provided for rotate_suits");
+            }
+
+            const auto masks = suit_masks();
+            std::array<uint16_t, c_num_suits> rotated{};
+            for (uint8_t s = 0; s < c_num_suits; ++s)
+            {
+                rotated[r[s]] = masks[s];
+            }
+            return from_masks(rotated);
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // MUTATORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // clear the set
+        constexpr void clear() noexcept { m_cards = 0; }
+
+        // fill with all cards
+        constexpr void fill() noexcept { m_cards = c_cardset16_full; }
+
+        // insert a single card
+        constexpr void insert(const card c) noexcept { m_cards |= card_bit(c); }
+
+        // join with another set
+        constexpr void join(const cardset16 cs) noexcept { m_cards |= cs.m_cards; }
+
+        // remove a single card
+        constexpr void remove(const card c) noexcept { m_cards &= ~card_bit(c); }
+
+        // remove all cards from cs (if they exist)
+        constexpr void remove(const cardset16 cs) noexcept { m_cards &= ~cs.m_cards; }
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // helper functions
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // bit of a card in the cardset16 layout
+        [[nodiscard]] static constexpr uint64_t card_bit(const card c) noexcept
+        {
+            return uint64_t(1) << (c.m_card % c_num_ranks + (c.m_card / c_num_ranks) * c_cardset16_suit_bits);
+        }
+
+        // create from the ranks of all suits (clubs, diamonds, hearts, spades), no check
+        [[nodiscard]] static constexpr cardset16 from_masks(const std::array<uint16_t, c_num_suits>& masks) noexcept
+        {
+            if constexpr (std::endian::native == std::endian::little)
+            {
+                return from_bits(std::bit_cast<uint64_t>(masks));
+            }
+            else
+            {
+                return from_bits(uint64_t(masks[0]) | (uint64_t(masks[1]) << (1 * c_cardset16_suit_bits)) |
+                                 (uint64_t(masks[2]) << (2 * c_cardset16_suit_bits)) | (uint64_t(masks[3]) << (3 * c_cardset16_suit_bits)));
+            }
+        }
+
+        constexpr auto operator<=>(const cardset16&) const noexcept = default;
+    };
+
+}    // namespace mkp
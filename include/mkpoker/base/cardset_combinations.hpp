@@ -0,0 +1,207 @@
+/*
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#pragma once
+
+#include <mkpoker/base/card.hpp>
+#include <mkpoker/base/cardset.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+namespace mkp
+{
+    namespace detail
+    {
+        // pascal's triangle, c_binomial[n][k] = n choose k for n, k <= 52
+        inline constexpr auto c_binomial = []() {
+            std::array<std::array<uint64_t, c_deck_size + 1>, c_deck_size + 1> ret{};
+            for (std::size_t n = 0; n <= c_deck_size; ++n)
+            {
+                ret[n][0] = 1;
+                for (std::size_t k = 1; k <= n; ++k)
+                {
+                    ret[n][k] = ret[n - 1][k - 1] + ret[n - 1][k];
+                }
+            }
+            return ret;
+        }();
+    }    // namespace detail
+
+    // all subsets with k cards of a cardset (e.g. the remaining deck) in colex order. every subset has an index in
+    // [0, size()), so enumerations can be split into index ranges, resumed from an index or sampled uniformly
+    class cardset_combinations
+    {
+        // the cards of the set as bitset, their indices in ascending order and the bitsets of the i lowest cards
+        uint64_t m_mask;
+        std::array<uint8_t, c_deck_size> m_cards{};
+        std::array<uint64_t, c_deck_size + 1> m_lowest{};
+        uint8_t m_n;
+        uint8_t m_k;
+
+        // positions (within the set) of the cards of the subset with index idx, returns the subset as bitset
+        [[nodiscard]] uint64_t unrank_positions(uint64_t idx, std::array<uint8_t, c_deck_size + 1>& positions) const
+        {
+            if (idx >= size())
+            {
+                throw std::runtime_error("cardset_combinations::unrank(uint64_t): index " + std::to_string(idx) + " out of range (size " +
+                                         std::to_string(size()) + ")");
+            }
+            // greedy: the largest position is the largest p with (p choose i) <= idx
+            uint64_t ret = 0;
+            uint8_t p = m_n;
+            for (uint8_t i = m_k; i > 0; --i)
+            {
+                do
+                {
+                    --p;
+                } while (detail::c_binomial[p][i] > idx);
+                idx -= detail::c_binomial[p][i];
+                positions[i - 1] = p;
+                ret |= uint64_t(1) << m_cards[p];
+            }
+            return ret;
+        }
+
+       public:
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // CTORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // subsets with k cards of cs, throws if k is larger than the set
+        cardset_combinations(const cardset cs, const uint8_t k) : m_mask(cs.as_bitset()), m_n(static_cast<uint8_t>(cs.size())), m_k(k)
+        {
+            if (k > m_n)
+            {
+                throw std::runtime_error("cardset_combinations(cardset, uint8_t): can not choose " + std::to_string(k) + " out of " +
+                                         std::to_string(m_n) + " cards");
+            }
+            uint8_t i = 0;
+            for (uint64_t mask = m_mask; mask != 0; mask &= mask - 1, ++i)
+            {
+                m_cards[i] = static_cast<uint8_t>(std::countr_zero(mask));
+                m_lowest[i + 1] = m_lowest[i] | (mask & (~mask + 1));
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // ACCESSORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // number of subsets (n choose k)
+        [[nodiscard]] uint64_t size() const noexcept { return detail::c_binomial[m_n][m_k]; }
+
+        // colex index of a subset, throws if it is not a subset with k cards
+        [[nodiscard]] uint64_t rank(const cardset subset) const
+        {
+            if (subset.size() != m_k || (subset.as_bitset() & ~m_mask) != 0)
+            {
+                throw std::runtime_error("cardset_combinations::rank(cardset): '" + subset.str() + "' is not a subset with " +
+                                         std::to_string(m_k) + " cards");
+            }
+            // sum of (position choose i) over the i-th smallest card
+            uint64_t ret = 0;
+            uint8_t i = 1;
+            for (uint64_t mask = subset.as_bitset(); mask != 0; mask &= mask - 1, ++i)
+            {
+                const auto pos = std::popcount(m_mask & ((mask & (~mask + 1)) - 1));
+                ret += detail::c_binomial[pos][i];
+            }
+            return ret;
+        }
+
+        // subset with colex index idx, throws if idx >= size()
+        [[nodiscard]] cardset unrank(const uint64_t idx) const
+        {
+            std::array<uint8_t, c_deck_size + 1> positions{};
+            return cardset{unrank_positions(idx, positions)};
+        }
+
+        // uniformly distributed subset
+        template <typename URBG>
+        [[nodiscard]] cardset sample(URBG& rng) const
+        {
+            return unrank(std::uniform_int_distribution<uint64_t>(0, size() - 1)(rng));
+        }
+
+        // calls f(subset) for the subsets with indices in [begin, end) in colex order
+        template <typename F>
+        void for_each(const uint64_t begin, const uint64_t end, F&& f) const
+        {
+            if (begin >= end)
+            {
+                return;
+            }
+            if (end > size())
+            {
+                throw std::runtime_error("cardset_combinations::for_each(uint64_t, uint64_t, F&&): end " + std::to_string(end) +
+                                         " out of range (size " + std::to_string(size()) + ")");
+            }
+            if (m_k == 0)
+            {
+                f(cardset{});
+                return;
+            }
+            // the positions of the cards are stepped like an odometer: the lowest card runs through the cards below the
+            // second lowest one (as the innermost of nested loops), then the first card which can move up is moved and
+            // the cards below it are reset to the lowest cards of the set. the last position is a sentinel
+            std::array<uint8_t, c_deck_size + 1> positions{};
+            uint64_t higher = unrank_positions(begin, positions) & ~(uint64_t(1) << m_cards[positions[0]]);
+            positions[m_k] = m_n;
+            for (uint64_t i = begin;;)
+            {
+                const auto last = static_cast<uint8_t>(std::min<uint64_t>(positions[1], positions[0] + end - i));
+                for (uint8_t p = positions[0]; p < last; ++p)
+                {
+                    f(cardset{higher | (uint64_t(1) << m_cards[p])});
+                }
+                i += last - positions[0];
+                if (i == end)
+                {
+                    return;
+                }
+
+                uint8_t j = 1;
+                while (positions[j] + 1 == positions[j + 1])
+                {
+                    ++j;
+                }
+                const uint64_t moved = uint64_t(1) << m_cards[positions[j]++];
+                higher = (higher & ~((moved << 1) - 1)) | (uint64_t(1) << m_cards[positions[j]]) | (m_lowest[j] & ~m_lowest[1]);
+                for (uint8_t l = 0; l < j; ++l)
+                {
+                    positions[l] = l;
+                }
+            }
+        }
+
+        // calls f(subset) for all subsets in colex order
+        template <typename F>
+        void for_each(F&& f) const
+        {
+            for_each(0, size(), f);
+        }
+    };
+
+}    // namespace mkp
@@ -0,0 +1,228 @@
+/*
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#pragma once
+
+#include <mkpoker/base/card.hpp>
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/hand.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace mkp
+{
+    inline namespace constants
+    {
+        // number of two card combinations (52 choose 2)
+        inline constexpr uint16_t c_num_combos = 1326;
+
+        // number of 64 bit words of a combo_mask
+        inline constexpr uint8_t c_combo_mask_words = (c_num_combos + 63) / 64;
+    }    // namespace constants
+
+    // combos are indexed in colex order of their card indices: hi * (hi - 1) / 2 + lo
+    // card index = rank + 13 * suit: 2c3c = #0, 2c4c = #1, 3c4c = #2, 2c5c = #3, ... Ad As = #1300, ... Ks As = #1325
+    [[nodiscard]] constexpr uint16_t combo_index(const uint8_t card1, const uint8_t card2) noexcept
+    {
+        const auto hi = std::max(card1, card2);
+        const auto lo = std::min(card1, card2);
+        return static_cast<uint16_t>(hi * (hi - 1) / 2 + lo);
+    }
+
+    [[nodiscard]] constexpr uint16_t combo_index(const hand_2c h) noexcept { return combo_index(h.m_card1.m_card, h.m_card2.m_card); }
+
+    namespace detail
+    {
+        // card indices (lo, hi) of every combo
+        inline constexpr auto c_combo_cards = []() {
+            std::array<std::array<uint8_t, 2>, c_num_combos> ret{};
+            for (uint8_t hi = 1; hi < c_deck_size; ++hi)
+            {
+                for (uint8_t lo = 0; lo < hi; ++lo)
+                {
+                    ret[combo_index(lo, hi)] = {lo, hi};
+                }
+            }
+            return ret;
+        }();
+
+        // cardset bits of every combo
+        inline constexpr auto c_combo_bitsets = []() {
+            std::array<uint64_t, c_num_combos> ret{};
+            for (uint16_t i = 0; i < c_num_combos; ++i)
+            {
+                ret[i] = (uint64_t(1) << c_combo_cards[i][0]) | (uint64_t(1) << c_combo_cards[i][1]);
+            }
+            return ret;
+        }();
+    }    // namespace detail
+
+    // get the hand_2c for any (valid) combo index
+    [[nodiscard]] constexpr hand_2c combo_hand(const uint16_t index)
+    {
+        if (index >= c_num_combos)
+        {
+            throw std::runtime_error("combo_hand(const uint16_t): index out of bounds: " + std::to_string(index));
+        }
+        return hand_2c(card(detail::c_combo_cards[index][0]), card(detail::c_combo_cards[index][1]));
+    }
+
+    // get the cardset for any (valid) combo index
+    [[nodiscard]] constexpr cardset combo_cardset(const uint16_t index)
+    {
+        if (index >= c_num_combos)
+        {
+            throw std::runtime_error("combo_cardset(const uint16_t): index out of bounds: " + std::to_string(index));
+        }
+        return cardset(detail::c_combo_bitsets[index]);
+    }
+
+    // one bit per combo (indexed by combo_index), e.g. the combos blocked by a board
+    class combo_mask
+    {
+        std::array<uint64_t, c_combo_mask_words> m_bits = {};
+
+        // valid (used) bits of the last word, the padding above them is always zero
+        static constexpr uint64_t c_last_word = ~uint64_t(0) >> (64 * c_combo_mask_words - c_num_combos);
+
+       public:
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // CTORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // empty mask
+        constexpr combo_mask() = default;
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // ACCESSORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // is combo i set, no bounds check
+        [[nodiscard]] constexpr bool test(const uint16_t index) const noexcept { return (m_bits[index / 64] >> (index % 64)) & 1; }
+
+        // number of set combos
+        [[nodiscard]] constexpr uint16_t size() const noexcept
+        {
+            uint16_t ret = 0;
+            for (const auto w : m_bits)
+            {
+                ret += static_cast<uint16_t>(std::popcount(w));
+            }
+            return ret;
+        }
+
+        [[nodiscard]] constexpr bool none() const noexcept
+        {
+            return std::all_of(m_bits.cbegin(), m_bits.cend(), [](const uint64_t w) { return w == 0; });
+        }
+
+        [[nodiscard]] constexpr const std::array<uint64_t, c_combo_mask_words>& words() const noexcept { return m_bits; }
+
+        // calls f(index) for every set combo in ascending order
+        template <typename F>
+        constexpr void for_each(F&& f) const
+        {
+            for (uint16_t i = 0; i < c_combo_mask_words; ++i)
+            {
+                for (uint64_t w = m_bits[i]; w; w &= w - 1)
+                {
+                    f(static_cast<uint16_t>(i * 64 + std::countr_zero(w)));
+                }
+            }
+        }
+
+        [[nodiscard]] constexpr combo_mask operator~() const noexcept
+        {
+            combo_mask ret;
+            for (uint8_t i = 0; i < c_combo_mask_words; ++i)
+            {
+                ret.m_bits[i] = ~m_bits[i];
+            }
+            ret.m_bits.back() &= c_last_word;
+            return ret;
+        }
+
+        [[nodiscard]] constexpr combo_mask operator|(const combo_mask& other) const noexcept { return combo_mask(*this) |= other; }
+
+        [[nodiscard]] constexpr combo_mask operator&(const combo_mask& other) const noexcept { return combo_mask(*this) &= other; }
+
+        constexpr bool operator==(const combo_mask&) const noexcept = default;
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // MUTATORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // set combo i, no bounds check
+        constexpr void set(const uint16_t index) noexcept { m_bits[index / 64] |= uint64_t(1) << (index % 64); }
+
+        constexpr void reset(const uint16_t index) noexcept { m_bits[index / 64] &= ~(uint64_t(1) << (index % 64)); }
+
+        constexpr combo_mask& operator|=(const combo_mask& other) noexcept
+        {
+            for (uint8_t i = 0; i < c_combo_mask_words; ++i)
+            {
+                m_bits[i] |= other.m_bits[i];
+            }
+            return *this;
+        }
+
+        constexpr combo_mask& operator&=(const combo_mask& other) noexcept
+        {
+            for (uint8_t i = 0; i < c_combo_mask_words; ++i)
+            {
+                m_bits[i] &= other.m_bits[i];
+            }
+            return *this;
+        }
+    };
+
+    namespace detail
+    {
+        // all combos containing a card, for every card
+        inline constexpr auto c_card_combo_masks = []() {
+            std::array<combo_mask, c_deck_size> ret{};
+            for (uint16_t i = 0; i < c_num_combos; ++i)
+            {
+                ret[c_combo_cards[i][0]].set(i);
+                ret[c_combo_cards[i][1]].set(i);
+            }
+            return ret;
+        }();
+    }    // namespace detail
+
+    // all combos containing card c
+    [[nodiscard]] constexpr const combo_mask& combo_mask_of(const card c) noexcept { return detail::c_card_combo_masks[c.m_card]; }
+
+    // all combos sharing at least one card with cs (e.g. the board or dead cards)
+    [[nodiscard]] constexpr combo_mask blocked_combos(const cardset cs) noexcept
+    {
+        combo_mask ret;
+        for (uint64_t bits = cs.as_bitset(); bits; bits &= bits - 1)
+        {
+            ret |= detail::c_card_combo_masks[std::countr_zero(bits)];
+        }
+        return ret;
+    }
+
+}    // namespace mkp
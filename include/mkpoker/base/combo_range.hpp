@@ -0,0 +1,262 @@
+/*
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#pragma once
+
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/combo.hpp>
+#include <mkpoker/base/hand.hpp>
+#include <mkpoker/base/range.hpp>
+#include <mkpoker/util/cpu_dispatch.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+namespace mkp
+{
+    namespace detail
+    {
+        // kernels over the padded weights of a combo_range (one float per bit of a combo_mask, 64 byte aligned)
+        inline constexpr std::size_t c_combo_weights_size = c_combo_mask_words * 64;
+
+        // reductions use 16 independent partial sums, otherwise the compiler can not reorder (and vectorize) float additions
+        template <typename F>
+        MKP_FORCE_INLINE float combo_weights_reduce(F&& f) noexcept
+        {
+            std::array<float, 16> partial = {};
+            for (std::size_t i = 0; i < c_combo_weights_size; i += partial.size())
+            {
+                for (std::size_t j = 0; j < partial.size(); ++j)
+                {
+                    partial[j] += f(i + j);
+                }
+            }
+            float ret = 0.0f;
+            for (const auto p : partial)
+            {
+                ret += p;
+            }
+            return ret;
+        }
+
+        MKP_FORCE_INLINE float combo_weights_sum_impl(const float* a) noexcept
+        {
+            return combo_weights_reduce([a](const std::size_t i) { return a[i]; });
+        }
+
+        // may be contracted to fma (v3 and above), so results can differ in the last bits between cpus
+        MKP_FORCE_INLINE float combo_weights_dot_impl(const float* a, const float* b) noexcept
+        {
+            return combo_weights_reduce([a, b](const std::size_t i) { return a[i] * b[i]; });
+        }
+
+        MKP_FORCE_INLINE void combo_weights_scale_impl(float* a, const float factor) noexcept
+        {
+            for (std::size_t i = 0; i < c_combo_weights_size; ++i)
+            {
+                a[i] *= factor;
+            }
+        }
+
+        MKP_FORCE_INLINE void combo_weights_mul_impl(float* a, const float* b) noexcept
+        {
+            for (std::size_t i = 0; i < c_combo_weights_size; ++i)
+            {
+                a[i] *= b[i];
+            }
+        }
+
+        MKP_FORCE_INLINE void combo_weights_add_impl(float* a, const float* b) noexcept
+        {
+            for (std::size_t i = 0; i < c_combo_weights_size; ++i)
+            {
+                a[i] += b[i];
+            }
+        }
+
+        MKP_DISPATCH_KERNELS(combo_weights_sum, float, (const float* a), (a))
+        MKP_DISPATCH_KERNELS(combo_weights_dot, float, (const float* a, const float* b), (a, b))
+        MKP_DISPATCH_KERNELS(combo_weights_scale, void, (float* a, const float factor), (a, factor))
+        MKP_DISPATCH_KERNELS(combo_weights_mul, void, (float* a, const float* b), (a, b))
+        MKP_DISPATCH_KERNELS(combo_weights_add, void, (float* a, const float* b), (a, b))
+    }    // namespace detail
+
+    // weight (0..1) of every single combo, e.g. for suit specific or card removal adjusted ranges
+    // storage is 64 byte aligned and padded to one float per bit of a combo_mask (full cache lines),
+    // all operations are plain loops over the whole array which the compiler vectorizes, the padding is always zero
+    // sum, dot and the arithmetic operators use the kernel for the best instruction set of the cpu (see cpu_dispatch.hpp)
+    class combo_range
+    {
+       public:
+        static constexpr std::size_t c_padded_size = detail::c_combo_weights_size;
+
+       private:
+        alignas(64) std::array<float, c_padded_size> m_weights = {};
+
+       public:
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // CTORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // empty range
+        combo_range() = default;
+
+        // all combos with the same weight
+        explicit combo_range(const float weight) noexcept { fill(weight); }
+
+        // every combo gets the (normalized) weight of its class
+        explicit combo_range(const range& r) noexcept
+        {
+            for (uint16_t i = 0; i < c_num_combos; ++i)
+            {
+                const auto idx = range::index(combo_hand(i));
+                m_weights[i] = static_cast<float>(r.value_of(idx)) / static_cast<float>(range::max_value(idx));
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // ACCESSORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // weight of combo i, no bounds check
+        [[nodiscard]] float operator[](const uint16_t index) const noexcept { return m_weights[index]; }
+
+        [[nodiscard]] float value_of(const hand_2c h) const noexcept { return m_weights[combo_index(h)]; }
+
+        [[nodiscard]] std::span<const float, c_num_combos> weights() const noexcept
+        {
+            return std::span<const float, c_num_combos>(m_weights.data(), c_num_combos);
+        }
+
+        // number of combos with weight > 0
+        [[nodiscard]] uint16_t size() const noexcept
+        {
+            uint16_t ret = 0;
+            for (std::size_t i = 0; i < c_padded_size; ++i)
+            {
+                ret += m_weights[i] > 0.0f;
+            }
+            return ret;
+        }
+
+        [[nodiscard]] float sum() const noexcept
+        {
+            static const auto kernel = cpu_dispatch(detail::combo_weights_sum_kernels);
+            return kernel(m_weights.data());
+        }
+
+        // sum of the products of the weights, e.g. the probability that two ranges hold the same combo
+        [[nodiscard]] float dot(const combo_range& other) const noexcept
+        {
+            static const auto kernel = cpu_dispatch(detail::combo_weights_dot_kernels);
+            return kernel(m_weights.data(), other.m_weights.data());
+        }
+
+        // convert to range, weights of the combos of each class are summed up (rounded to full percent)
+        [[nodiscard]] range to_range() const
+        {
+            std::array<float, c_range_size> sums = {};
+            for (uint16_t i = 0; i < c_num_combos; ++i)
+            {
+                sums[range::index(combo_hand(i))] += m_weights[i];
+            }
+            range ret;
+            for (uint8_t i = 0; i < c_range_size; ++i)
+            {
+                const auto value = static_cast<uint16_t>(std::lround(std::clamp(sums[i] * 100.0f, 0.0f, float(range::max_value(i)))));
+                ret.set_value(i, value);
+            }
+            return ret;
+        }
+
+        bool operator==(const combo_range&) const noexcept = default;
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // MUTATORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        void clear() noexcept { m_weights.fill(0.0f); }
+
+        // set all combos to weight
+        void fill(const float weight) noexcept { std::fill_n(m_weights.begin(), c_num_combos, weight); }
+
+        // set weight of combo i, throws if invalid input
+        void set_value(const uint16_t index, const float weight)
+        {
+            if (index >= c_num_combos)
+            {
+                throw std::runtime_error("set_value(const uint16_t, const float): index out of bounds '" + std::to_string(index) + "'");
+            }
+            if (!(weight >= 0.0f && weight <= 1.0f))
+            {
+                throw std::runtime_error("set_value(const uint16_t, const float): weight out of bounds '" + std::to_string(weight) + "'");
+            }
+            m_weights[index] = weight;
+        }
+
+        void set_value(const hand_2c h, const float weight) { set_value(combo_index(h), weight); }
+
+        // scale weights to sum up to 1, an empty range stays empty
+        void normalize() noexcept
+        {
+            if (const auto s = sum(); s > 0.0f)
+            {
+                *this *= 1.0f / s;
+            }
+        }
+
+        // remove all combos set in mask
+        void remove(const combo_mask& mask) noexcept { mask.for_each([this](const uint16_t i) { m_weights[i] = 0.0f; }); }
+
+        // remove all combos which contain a card of cs (e.g. the board)
+        void remove_blocked(const cardset cs) noexcept { remove(blocked_combos(cs)); }
+
+        combo_range& operator*=(const float factor) noexcept
+        {
+            static const auto kernel = cpu_dispatch(detail::combo_weights_scale_kernels);
+            kernel(m_weights.data(), factor);
+            return *this;
+        }
+
+        // element-wise product, e.g. to apply the probabilities of an action
+        combo_range& operator*=(const combo_range& other) noexcept
+        {
+            static const auto kernel = cpu_dispatch(detail::combo_weights_mul_kernels);
+            kernel(m_weights.data(), other.m_weights.data());
+            return *this;
+        }
+
+        combo_range& operator+=(const combo_range& other) noexcept
+        {
+            static const auto kernel = cpu_dispatch(detail::combo_weights_add_kernels);
+            kernel(m_weights.data(), other.m_weights.data());
+            return *this;
+        }
+    };
+
+    static_assert(alignof(combo_range) == 64, "combo_range should be aligned to cache lines");
+    static_assert(sizeof(combo_range) % 64 == 0, "combo_range should fill full cache lines");
+
+}    // namespace mkp
@@ -0,0 +1,638 @@
+/*
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#pragma once
+
+#include <mkpoker/base/card.hpp>
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/hand.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace mkp
+{
+    namespace detail
+    {
+        // binomial coefficient, k is always small (number of suits / cards per suit and round)
+        [[nodiscard]] constexpr uint64_t nCr(const uint64_t n, const uint64_t k) noexcept
+        {
+            if (k > n)
+            {
+                return 0;
+            }
+            uint64_t ret = 1;
+            for (uint64_t i = 1; i <= k; ++i)
+            {
+                ret = ret * (n - k + i) / i;
+            }
+            return ret;
+        }
+
+        // number of multisets of size k with elements from a set of size n
+        [[nodiscard]] constexpr uint64_t nMCr(const uint64_t n, const uint64_t k) noexcept { return n + k == 0 ? 1 : nCr(n + k - 1, k); }
+
+        // colex index of a set of ranks among all rank sets with the same size
+        inline constexpr auto c_rank_set_to_index = []() {
+            std::array<uint16_t, 1 << c_num_ranks> ret{};
+            for (uint32_t i = 0; i < ret.size(); ++i)
+            {
+                uint32_t j = 1;
+                for (uint32_t set = i; set; set &= set - 1, ++j)
+                {
+                    ret[i] += static_cast<uint16_t>(nCr(std::countr_zero(set), j));
+                }
+            }
+            return ret;
+        }();
+
+        // inverse of c_rank_set_to_index for rank sets of size n
+        [[nodiscard]] constexpr uint16_t index_to_rank_set(const uint32_t n, uint64_t idx) noexcept
+        {
+            uint16_t ret = 0;
+            for (uint32_t k = n; k > 0; --k)
+            {
+                uint32_t c = k - 1;
+                while (nCr(c + 1, k) <= idx)
+                {
+                    ++c;
+                }
+                ret |= uint16_t(1) << c;
+                idx -= nCr(c, k);
+            }
+            return ret;
+        }
+
+        // position of the n-th zero bit in used
+        [[nodiscard]] constexpr uint8_t nth_unset(const uint16_t used, const uint32_t n) noexcept
+        {
+            uint32_t set = ~uint32_t(used) & c_mask_ranks;
+            for (uint32_t i = 0; i < n; ++i)
+            {
+                set &= set - 1;
+            }
+            return static_cast<uint8_t>(std::countr_zero(set));
+        }
+
+        // the number of cards of a suit for every round is packed into 4 bit per round, first round in the highest bits
+        constexpr uint32_t c_round_shift = 4;
+        constexpr uint32_t c_round_mask = 0b1111;
+
+        // enumerate all possible distributions of cards to suits for every round; if is_canonical is true,
+        // only distributions with suits ordered by descending number of cards are observed ('configurations')
+        // the observer also gets the index of the distribution (mixed radix over the number of cards of the first three suits)
+        template <bool is_canonical, std::size_t R, typename F>
+        constexpr void enumerate_suit_distributions(const std::array<uint8_t, R>& cards_per_round, const uint32_t round,
+                                                    const uint32_t remaining, const uint32_t suit, const uint32_t equal,
+                                                    const uint32_t perm_idx, const uint32_t perm_mult, std::array<uint32_t, c_num_suits>& used,
+                                                    std::array<uint32_t, c_num_suits>& distribution, F& observe)
+        {
+            if (suit == c_num_suits)
+            {
+                observe(round, distribution, perm_idx);
+                if (round + 1 < R)
+                {
+                    enumerate_suit_distributions<is_canonical>(cards_per_round, round + 1, cards_per_round[round + 1], 0, equal, perm_idx,
+                                                               perm_mult, used, distribution, observe);
+                }
+                return;
+            }
+
+            const uint32_t min = suit == c_num_suits - 1 ? remaining : 0;
+            uint32_t max = std::min(remaining, c_num_ranks - used[suit]);
+
+            const uint32_t shift = c_round_shift * (R - round - 1);
+            const bool was_equal = is_canonical && (equal & (1u << suit));
+            const uint32_t previous = was_equal ? (distribution[suit - 1] >> shift) & c_round_mask : c_num_ranks + 1;
+            max = std::min(max, previous);
+
+            // the last suit is implied by the others
+            const bool is_last = suit == c_num_suits - 1;
+            const uint32_t next_mult = is_last ? perm_mult : perm_mult * (remaining + 1);
+
+            const uint32_t old_distribution = distribution[suit];
+            const uint32_t old_used = used[suit];
+            for (uint32_t i = min; i <= max; ++i)
+            {
+                const uint32_t new_equal = (equal & ~(1u << suit)) | (uint32_t(was_equal && i == previous) << suit);
+                const uint32_t next_idx = is_last ? perm_idx : perm_idx + perm_mult * i;
+                used[suit] = old_used + i;
+                distribution[suit] = old_distribution | (i << shift);
+                enumerate_suit_distributions<is_canonical>(cards_per_round, round, remaining - i, suit + 1, new_equal, next_idx, next_mult,
+                                                           used, distribution, observe);
+                distribution[suit] = old_distribution;
+                used[suit] = old_used;
+            }
+        }
+
+        template <bool is_canonical, std::size_t R, typename F>
+        constexpr void enumerate_suit_distributions(const std::array<uint8_t, R>& cards_per_round, F&& observe)
+        {
+            std::array<uint32_t, c_num_suits> used{};
+            std::array<uint32_t, c_num_suits> distribution{};
+            enumerate_suit_distributions<is_canonical>(cards_per_round, 0, cards_per_round[0], 0, (1u << c_num_suits) - 2, 0, 1, used,
+                                                       distribution, observe);
+        }
+
+        // lexicographical compare, cheaper than std::array::operator< in constant evaluation
+        [[nodiscard]] constexpr bool less(const std::array<uint32_t, c_num_suits>& lhs, const std::array<uint32_t, c_num_suits>& rhs) noexcept
+        {
+            for (uint32_t i = 0; i < c_num_suits; ++i)
+            {
+                if (lhs[i] != rhs[i])
+                {
+                    return lhs[i] < rhs[i];
+                }
+            }
+            return false;
+        }
+
+        template <std::size_t R>
+        struct indexer_counts
+        {
+            std::array<uint32_t, R> m_configurations{};
+            std::array<uint32_t, R> m_permutations{};
+
+            [[nodiscard]] constexpr uint32_t total_configurations() const noexcept
+            {
+                uint32_t ret = 0;
+                for (auto&& e : m_configurations)
+                {
+                    ret += e;
+                }
+                return ret;
+            }
+
+            [[nodiscard]] constexpr uint32_t total_permutations() const noexcept
+            {
+                uint32_t ret = 0;
+                for (auto&& e : m_permutations)
+                {
+                    ret += e;
+                }
+                return ret;
+            }
+        };
+
+        template <std::size_t R>
+        [[nodiscard]] constexpr indexer_counts<R> make_indexer_counts(const std::array<uint8_t, R>& cards_per_round)
+        {
+            indexer_counts<R> ret{};
+            enumerate_suit_distributions<true>(cards_per_round,
+                                               [&](const uint32_t round, const auto&, const uint32_t) { ++ret.m_configurations[round]; });
+            enumerate_suit_distributions<false>(cards_per_round, [&](const uint32_t round, const auto&, const uint32_t perm_idx) {
+                ret.m_permutations[round] = std::max(ret.m_permutations[round], perm_idx + 1);
+            });
+            return ret;
+        }
+
+        // all the tables for one indexer, each table is flattened over all rounds, i.e.,
+        // the entries for round r start at m_config_start[r] and m_perm_start[r] respectively
+        // C: total number of configurations, P: total number of permutations
+        template <std::size_t R, std::size_t C, std::size_t P>
+        struct indexer_tables
+        {
+            std::array<uint32_t, R> m_config_start{};
+            std::array<uint32_t, R> m_perm_start{};
+            std::array<uint64_t, R> m_round_size{};
+
+            std::array<std::array<uint32_t, c_num_suits>, C> m_configuration{};
+            std::array<std::array<uint64_t, c_num_suits>, C> m_suit_size{};
+            std::array<uint64_t, C> m_offset{};
+            std::array<uint8_t, C> m_equal{};
+
+            std::array<uint32_t, P> m_perm_to_config{};
+            std::array<std::array<uint8_t, c_num_suits>, P> m_perm_to_pi{};
+        };
+
+        template <std::size_t R, std::size_t C, std::size_t P>
+        [[nodiscard]] constexpr indexer_tables<R, C, P> make_indexer_tables(const std::array<uint8_t, R>& cards_per_round,
+                                                                            const indexer_counts<R>& counts)
+        {
+            indexer_tables<R, C, P> ret{};
+            for (uint32_t r = 1; r < R; ++r)
+            {
+                ret.m_config_start[r] = ret.m_config_start[r - 1] + counts.m_configurations[r - 1];
+                ret.m_perm_start[r] = ret.m_perm_start[r - 1] + counts.m_permutations[r - 1];
+            }
+
+            // 1) configurations, kept sorted in ascending order for each round
+            std::array<uint32_t, R> num_configs{};
+            enumerate_suit_distributions<true>(cards_per_round, [&](const uint32_t round, const std::array<uint32_t, c_num_suits>& cfg,
+                                                                    const uint32_t) {
+                const uint32_t start = ret.m_config_start[round];
+                uint32_t id = num_configs[round]++;
+                for (; id > 0 && less(cfg, ret.m_configuration[start + id - 1]); --id)
+                {
+                    ret.m_configuration[start + id] = ret.m_configuration[start + id - 1];
+                    ret.m_suit_size[start + id] = ret.m_suit_size[start + id - 1];
+                    ret.m_offset[start + id] = ret.m_offset[start + id - 1];
+                    ret.m_equal[start + id] = ret.m_equal[start + id - 1];
+                }
+
+                // number of hands for this configuration: product over all groups of equal suits
+                ret.m_configuration[start + id] = cfg;
+                ret.m_offset[start + id] = 1;
+                uint8_t equal = 0;
+                for (uint32_t i = 0; i < c_num_suits;)
+                {
+                    uint64_t size = 1;
+                    for (uint32_t j = 0, remaining = c_num_ranks; j <= round; ++j)
+                    {
+                        const uint32_t ranks = (cfg[i] >> (c_round_shift * (R - j - 1))) & c_round_mask;
+                        size *= nCr(remaining, ranks);
+                        remaining -= ranks;
+                    }
+
+                    uint32_t j = i + 1;
+                    while (j < c_num_suits && cfg[j] == cfg[i])
+                    {
+                        ++j;
+                    }
+                    for (uint32_t k = i; k < j; ++k)
+                    {
+                        ret.m_suit_size[start + id][k] = size;
+                        // bit k-1 set: suit k is equal to suit k-1
+                        equal |= k > i ? uint8_t(1 << (k - 1)) : uint8_t(0);
+                    }
+                    ret.m_offset[start + id] *= nMCr(size, j - i);
+                    i = j;
+                }
+                ret.m_equal[start + id] = equal;
+            });
+
+            // 2) turn the sizes into offsets
+            for (uint32_t r = 0; r < R; ++r)
+            {
+                uint64_t accum = 0;
+                for (uint32_t i = 0; i < counts.m_configurations[r]; ++i)
+                {
+                    const uint64_t next = accum + ret.m_offset[ret.m_config_start[r] + i];
+                    ret.m_offset[ret.m_config_start[r] + i] = accum;
+                    accum = next;
+                }
+                ret.m_round_size[r] = accum;
+            }
+
+            // 3) map every suit distribution to its configuration and the suit permutation
+            enumerate_suit_distributions<false>(cards_per_round, [&](const uint32_t round, const std::array<uint32_t, c_num_suits>& count,
+                                                                     const uint32_t perm_idx) {
+                const uint32_t idx = ret.m_perm_start[round] + perm_idx;
+
+                // sort suits by number of cards (descending, stable)
+                std::array<uint8_t, c_num_suits> pi{0, 1, 2, 3};
+                for (uint32_t i = 1; i < c_num_suits; ++i)
+                {
+                    const uint8_t pi_i = pi[i];
+                    uint32_t j = i;
+                    for (; j > 0 && count[pi_i] > count[pi[j - 1]]; --j)
+                    {
+                        pi[j] = pi[j - 1];
+                    }
+                    pi[j] = pi_i;
+                }
+                ret.m_perm_to_pi[idx] = pi;
+
+                std::array<uint32_t, c_num_suits> sorted{};
+                for (uint32_t i = 0; i < c_num_suits; ++i)
+                {
+                    sorted[i] = count[pi[i]];
+                }
+                const uint32_t start = ret.m_config_start[round];
+                uint32_t low = 0;
+                uint32_t high = counts.m_configurations[round];
+                while (low < high)
+                {
+                    const uint32_t mid = (low + high) / 2;
+                    if (less(ret.m_configuration[start + mid], sorted))
+                    {
+                        low = mid + 1;
+                    }
+                    else
+                    {
+                        high = mid;
+                    }
+                }
+                ret.m_perm_to_config[idx] = low;
+            });
+
+            return ret;
+        }
+
+    }    // namespace detail
+
+    // maps cards (dealt in rounds, e.g., hole cards + board) to a dense index, so that all hands
+    // which are equal up to a permutation of suits share the same index (suit isomorphism)
+    //
+    // implementation of the algorithm described in
+    // K. Waugh, "A Fast and Optimal Hand Isomorphism Algorithm", AAAI Workshop on Computer Poker, 2013
+    // the suits are sorted by their number of cards and the rank sets of each suit are indexed in colex
+    // order, suits with identical distributions are combined as multisets; all tables are computed
+    // at compile time
+    //
+    // cards_per_round: number of cards in each round, e.g. <2, 3> for hole cards + flop
+    template <uint8_t... cards_per_round>
+    class hand_indexer
+    {
+        static_assert(sizeof...(cards_per_round) > 0 && sizeof...(cards_per_round) <= 8, "number of rounds must be in the range [1,8]");
+        static_assert(((cards_per_round > 0 && cards_per_round <= c_num_ranks) && ...), "invalid number of cards per round");
+        static_assert((cards_per_round + ...) <= c_deck_size, "too many cards");
+
+       public:
+        static constexpr std::size_t c_rounds = sizeof...(cards_per_round);
+        static constexpr std::array<uint8_t, c_rounds> c_cards_per_round{cards_per_round...};
+
+       private:
+        static constexpr auto c_counts = detail::make_indexer_counts(c_cards_per_round);
+        static constexpr auto c_tables =
+            detail::make_indexer_tables<c_rounds, c_counts.total_configurations(), c_counts.total_permutations()>(c_cards_per_round,
+                                                                                                                 c_counts);
+
+       public:
+        // incremental state, allows to index the hand round by round
+        struct state_t
+        {
+            std::array<uint64_t, c_num_suits> m_suit_index{};
+            std::array<uint64_t, c_num_suits> m_suit_multiplier{1, 1, 1, 1};
+            std::array<uint16_t, c_num_suits> m_used_ranks{};
+            uint64_t m_permutation_index = 0;
+            uint64_t m_permutation_multiplier = 1;
+            uint32_t m_round = 0;
+        };
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // STATIC functions
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // number of canonical hands for round
+        [[nodiscard]] static constexpr uint64_t size(const std::size_t round)
+        {
+            if (round >= c_rounds)
+            {
+                throw std::runtime_error("hand_indexer::size(const size_t): invalid round " + std::to_string(round));
+            }
+            return c_tables.m_round_size[round];
+        }
+
+        // add the cards of the next round and return the index for all rounds up to now
+        // the cardset must have the correct size for that round and must not contain cards of previous rounds
+        [[nodiscard]] static constexpr uint64_t index_next_round(state_t& state, const cardset cs) noexcept
+        {
+            const uint32_t round = state.m_round++;
+            assert(round < c_rounds && "all rounds already indexed");
+            assert(cs.size() == c_cards_per_round[round] && "wrong number of cards for this round");
+
+            // 1) update the index of the rank set of each suit
+            std::array<uint16_t, c_num_suits> ranks{};
+            for (uint8_t s = 0; s < c_num_suits; ++s)
+            {
+                ranks[s] = (cs.as_bitset() >> (s * c_num_ranks)) & c_mask_ranks;
+                assert((ranks[s] & state.m_used_ranks[s]) == 0 && "duplicate cards");
+
+                // remove ranks of previous rounds, i.e., rank sets get 'shifted' to an index of the remaining ranks
+                uint32_t shifted = 0;
+                for (uint32_t m = ranks[s]; m; m &= m - 1)
+                {
+                    const uint32_t bit = m & (~m + 1);
+                    shifted |= bit >> std::popcount((bit - 1) & state.m_used_ranks[s]);
+                }
+
+                const auto used_size = std::popcount(state.m_used_ranks[s]);
+                const auto this_size = std::popcount(ranks[s]);
+                state.m_suit_index[s] += state.m_suit_multiplier[s] * detail::c_rank_set_to_index[shifted];
+                state.m_suit_multiplier[s] *= detail::nCr(c_num_ranks - used_size, this_size);
+                state.m_used_ranks[s] |= ranks[s];
+            }
+
+            // 2) update the index of the suit distribution
+            for (uint32_t s = 0, remaining = c_cards_per_round[round]; s < c_num_suits - 1; ++s)
+            {
+                const auto this_size = static_cast<uint32_t>(std::popcount(ranks[s]));
+                state.m_permutation_index += state.m_permutation_multiplier * this_size;
+                state.m_permutation_multiplier *= remaining + 1;
+                remaining -= this_size;
+            }
+
+            // 3) lookup configuration and suit permutation, combine suits
+            const auto perm = c_tables.m_perm_start[round] + state.m_permutation_index;
+            const auto config = c_tables.m_config_start[round] + c_tables.m_perm_to_config[perm];
+            const auto& pi = c_tables.m_perm_to_pi[perm];
+            const auto equal = c_tables.m_equal[config];
+
+            std::array<uint64_t, c_num_suits> suit_index{};
+            std::array<uint64_t, c_num_suits> suit_multiplier{};
+            for (uint8_t s = 0; s < c_num_suits; ++s)
+            {
+                suit_index[s] = state.m_suit_index[pi[s]];
+                suit_multiplier[s] = state.m_suit_multiplier[pi[s]];
+            }
+
+            uint64_t idx = c_tables.m_offset[config];
+            uint64_t multiplier = 1;
+            for (uint32_t i = 0; i < c_num_suits;)
+            {
+                // group of suits with equal configuration: [i,j)
+                uint32_t j = i + 1;
+                while (j < c_num_suits && (equal & (1u << (j - 1))))
+                {
+                    ++j;
+                }
+
+                // sort the group (at most 4 elements), then get the multiset index
+                for (uint32_t k = i + 1; k < j; ++k)
+                {
+                    for (uint32_t l = k; l > i && suit_index[l - 1] > suit_index[l]; --l)
+                    {
+                        std::swap(suit_index[l - 1], suit_index[l]);
+                    }
+                }
+                uint64_t part = 0;
+                for (uint32_t k = i; k < j; ++k)
+                {
+                    part += detail::nCr(suit_index[k] + (k - i), k - i + 1);
+                }
+
+                idx += multiplier * part;
+                multiplier *= detail::nMCr(suit_multiplier[i], j - i);
+                i = j;
+            }
+
+            return idx;
+        }
+
+        // index of the last round, checks the input
+        [[nodiscard]] static constexpr uint64_t index(const std::array<cardset, c_rounds>& rounds)
+        {
+            return index_all(rounds).back();
+        }
+
+        // index of every round, checks the input
+        [[nodiscard]] static constexpr std::array<uint64_t, c_rounds> index_all(const std::array<cardset, c_rounds>& rounds)
+        {
+            cardset all{};
+            for (std::size_t r = 0; r < c_rounds; ++r)
+            {
+                if (rounds[r].size() != c_cards_per_round[r])
+                {
+                    throw std::runtime_error("hand_indexer::index(): invalid number of cards (" + std::to_string(rounds[r].size()) +
+                                             ") in round " + std::to_string(r));
+                }
+                if (all.intersects(rounds[r]))
+                {
+                    throw std::runtime_error("hand_indexer::index(): called with duplicated cards");
+                }
+                all.join(rounds[r]);
+            }
+
+            state_t state{};
+            std::array<uint64_t, c_rounds> ret{};
+            for (std::size_t r = 0; r < c_rounds; ++r)
+            {
+                ret[r] = index_next_round(state, rounds[r]);
+            }
+            return ret;
+        }
+
+        // convenience overload for preflop
+        [[nodiscard]] static constexpr uint64_t index(const hand_2c h)
+            requires(c_rounds == 1 && c_cards_per_round[0] == 2)
+        {
+            state_t state{};
+            return index_next_round(state, h.as_cardset());
+        }
+
+        // convenience overload for hole cards + board
+        [[nodiscard]] static constexpr uint64_t index(const hand_2c h, const cardset board)
+            requires(c_rounds == 2 && c_cards_per_round[0] == 2)
+        {
+            return index({h.as_cardset(), board});
+        }
+
+        // get the canonical representative for index in round, the cardsets of later rounds are empty
+        [[nodiscard]] static constexpr std::array<cardset, c_rounds> unindex(const std::size_t round, uint64_t idx)
+        {
+            if (round >= c_rounds || idx >= c_tables.m_round_size[round])
+            {
+                throw std::runtime_error("hand_indexer::unindex(): invalid round (" + std::to_string(round) + ") or index (" +
+                                         std::to_string(idx) + ")");
+            }
+
+            // 1) find the configuration (last offset <= idx)
+            const uint32_t start = c_tables.m_config_start[round];
+            uint32_t low = 0;
+            uint32_t high = c_counts.m_configurations[round];
+            uint32_t config = start;
+            while (low < high)
+            {
+                const uint32_t mid = (low + high) / 2;
+                if (c_tables.m_offset[start + mid] <= idx)
+                {
+                    config = start + mid;
+                    low = mid + 1;
+                }
+                else
+                {
+                    high = mid;
+                }
+            }
+            idx -= c_tables.m_offset[config];
+            const auto& cfg = c_tables.m_configuration[config];
+
+            // 2) split into the index of each suit, reverse the multiset index for groups of equal suits
+            std::array<uint64_t, c_num_suits> suit_index{};
+            for (uint32_t i = 0; i < c_num_suits;)
+            {
+                uint32_t j = i + 1;
+                while (j < c_num_suits && cfg[j] == cfg[i])
+                {
+                    ++j;
+                }
+
+                const uint64_t suit_size = c_tables.m_suit_size[config][i];
+                const uint64_t group_size = detail::nMCr(suit_size, j - i);
+                uint64_t group_index = idx % group_size;
+                idx /= group_size;
+
+                for (; i < j - 1; ++i)
+                {
+                    // largest x with nCr(x + k - 1, k) <= group_index
+                    const uint32_t k = j - i;
+                    uint64_t lo = 0;
+                    uint64_t hi = suit_size;
+                    while (hi - lo > 1)
+                    {
+                        const uint64_t mid = (lo + hi) / 2;
+                        if (detail::nCr(mid + k - 1, k) <= group_index)
+                        {
+                            lo = mid;
+                        }
+                        else
+                        {
+                            hi = mid;
+                        }
+                    }
+                    suit_index[i] = lo;
+                    group_index -= detail::nCr(lo + k - 1, k);
+                }
+                suit_index[i] = group_index;
+                ++i;
+            }
+
+            // 3) get the rank sets of each suit for every round
+            std::array<cardset, c_rounds> ret{};
+            for (uint8_t s = 0; s < c_num_suits; ++s)
+            {
+                uint16_t used = 0;
+                uint32_t m = 0;
+                for (uint32_t r = 0; r <= round; ++r)
+                {
+                    const uint32_t n = (cfg[s] >> (detail::c_round_shift * (c_rounds - r - 1))) & detail::c_round_mask;
+                    const uint64_t round_size = detail::nCr(c_num_ranks - m, n);
+                    m += n;
+                    const uint64_t round_idx = suit_index[s] % round_size;
+                    suit_index[s] /= round_size;
+
+                    uint16_t rank_set = 0;
+                    for (uint16_t shifted = detail::index_to_rank_set(n, round_idx); shifted; shifted &= shifted - 1)
+                    {
+                        const auto r_card = detail::nth_unset(used, std::countr_zero(shifted));
+                        rank_set |= uint16_t(1) << r_card;
+                        ret[r].insert(card{static_cast<uint8_t>(r_card + s * c_num_ranks)});
+                    }
+                    used |= rank_set;
+                }
+            }
+            return ret;
+        }
+    };
+
+    // imperfect recall indexers (the order of the board cards is irrelevant), which can be used for card abstractions
+    using hand_indexer_preflop = hand_indexer<2>;
+    using hand_indexer_flop = hand_indexer<2, 3>;
+    using hand_indexer_turn = hand_indexer<2, 4>;
+    using hand_indexer_river = hand_indexer<2, 5>;
+
+}    // namespace mkp
@@ -20,6 +20,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #pragma once
 
 #include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/cardset16.hpp>
 #include <mkpoker/base/hand.hpp>
 
 #include <array>
@@ -28,7 +29,77 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 namespace mkp
 {
-    auto suit_normalization_permutation(const hand_2c h, const cardset& b) -> std::array<uint8_t, 4>
+    namespace detail
+    {
+        // masks are the ranks of every suit of hand and board
+        inline auto suit_normalization_permutation(const hand_2c h, const std::array<uint16_t, 4>& masks) -> std::array<uint8_t, 4>
+        {
+            // clang-format off
+            static constexpr std::array<std::array<std::array<uint8_t, 4>, 4>, 4> choose {{
+                {{ {0,1,2,3}, {0,1,2,3}, {0,2,1,3}, {0,3,1,2} }},
+                {{ {1,0,2,3}, {1,0,2,3}, {1,2,0,3}, {1,3,0,2} }},
+                {{ {2,0,1,3}, {2,1,0,3}, {2,0,1,3}, {2,3,0,1} }},
+                {{ {3,0,1,2}, {3,1,0,2}, {3,2,0,1}, {3,0,1,2} }}
+            }};
+
+            // clang-format on
+            std::array<uint8_t, 4> temp = choose[h.m_card1.suit().m_suit][h.m_card2.suit().m_suit];
+
+            // special case: suited hand
+            if (h.m_card1.suit() == h.m_card2.suit())
+            {
+                const uint16_t mask_1 = masks[temp[1]];
+                const uint16_t mask_2 = masks[temp[2]];
+                const uint16_t mask_3 = masks[temp[3]];
+
+                using pui16 = std::pair<uint8_t, uint16_t>;
+                std::array<pui16, 4> tnew{{{temp[0], uint16_t(0)}, {temp[1], mask_1}, {temp[2], mask_2}, {temp[3], mask_3}}};
+
+                std::sort(tnew.begin() + 1, tnew.end(), [](const pui16& lhs, const pui16& rhs) {
+                    if (std::popcount(lhs.second) == std::popcount(rhs.second))
+                    {
+                        return lhs.second > rhs.second;
+                    }
+                    return std::popcount(lhs.second) > std::popcount(rhs.second);
+                });
+
+                temp[1] = tnew[1].first;
+                temp[2] = tnew[2].first;
+                temp[3] = tnew[3].first;
+            }
+            else
+            {
+                if (h.m_card1.rank() == h.m_card2.rank())
+                {
+                    const uint16_t mask_1 = masks[temp[0]];
+                    const uint16_t mask_2 = masks[temp[1]];
+                    if (mask_1 < mask_2)
+                    {
+                        std::swap(temp[0], temp[1]);
+                    }
+                }
+                const uint16_t mask_3 = masks[temp[2]];
+                const uint16_t mask_4 = masks[temp[3]];
+                if (mask_3 < mask_4)
+                {
+                    std::swap(temp[2], temp[3]);
+                }
+                // else positions 3 and 4 are in correct order from the lookup table
+            }
+
+            // "invert" numbers so we return the wanted permutation to get that conanical suits
+            std::array<uint8_t, 4> ret{};
+            for (uint8_t u = 0; u < 4; ++u)
+            {
+                ret[temp[u]] = u;
+            }
+
+            return ret;
+        }
+    }    // namespace detail
+
+    // throws if the board size is invalid or if there are duplicated cards
+    inline auto suit_normalization_permutation(const hand_2c h, const cardset& b) -> std::array<uint8_t, 4>
     {
         const auto board_size = b.size();
         const auto cs_all = b.combine(h.as_cardset());
@@ -42,71 +113,29 @@ namespace mkp
             throw std::runtime_error("suit_normalization_permutation: called with duplicated cards");
         }
 
-        // clang-format off
-        static constexpr std::array<std::array<std::array<uint8_t, 4>, 4>, 4> choose {{
-            {{ {0,1,2,3}, {0,1,2,3}, {0,2,1,3}, {0,3,1,2} }},
-            {{ {1,0,2,3}, {1,0,2,3}, {1,2,0,3}, {1,3,0,2} }},
-            {{ {2,0,1,3}, {2,1,0,3}, {2,0,1,3}, {2,3,0,1} }},
-            {{ {3,0,1,2}, {3,1,0,2}, {3,2,0,1}, {3,0,1,2} }}
-        }};
-
-        // clang-format on
-        std::array<uint8_t, 4> temp = choose[h.m_card1.suit().m_suit][h.m_card2.suit().m_suit];
-
-        // special case: suited hand
-        if (h.m_card1.suit() == h.m_card2.suit())
-        {
-            using namespace ::mkp::constants;
-
-            const uint16_t mask_1 = (cs_all.as_bitset() >> (temp[1] * c_num_ranks)) & c_mask_ranks;
-            const uint16_t mask_2 = (cs_all.as_bitset() >> (temp[2] * c_num_ranks)) & c_mask_ranks;
-            const uint16_t mask_3 = (cs_all.as_bitset() >> (temp[3] * c_num_ranks)) & c_mask_ranks;
-
-            using pui16 = std::pair<uint8_t, uint16_t>;
-            std::array<pui16, 4> tnew{{{temp[0], uint16_t(0)}, {temp[1], mask_1}, {temp[2], mask_2}, {temp[3], mask_3}}};
+        const uint64_t mask = cs_all.as_bitset();
+        return detail::suit_normalization_permutation(
+            h, {static_cast<uint16_t>(mask & c_mask_ranks), static_cast<uint16_t>((mask >> (1 * c_num_ranks)) & c_mask_ranks),
+                static_cast<uint16_t>((mask >> (2 * c_num_ranks)) & c_mask_ranks),
+                static_cast<uint16_t>((mask >> (3 * c_num_ranks)) & c_mask_ranks)});
+    }
 
-            std::sort(tnew.begin() + 1, tnew.end(), [](const pui16& lhs, const pui16& rhs) {
-                if (std::popcount(lhs.second) == std::popcount(rhs.second))
-                {
-                    return lhs.second > rhs.second;
-                }
-                return std::popcount(lhs.second) > std::popcount(rhs.second);
-            });
+    // same as above for the 16 bit suit layout
+    inline auto suit_normalization_permutation(const hand_2c h, const cardset16& b) -> std::array<uint8_t, 4>
+    {
+        const auto board_size = b.size();
+        const auto cs_all = b.combine(cardset16(h.as_cardset()));
 
-            temp[1] = tnew[1].first;
-            temp[2] = tnew[2].first;
-            temp[3] = tnew[3].first;
-        }
-        else
+        if (board_size < 3 || board_size > 5)
         {
-            using namespace ::mkp::constants;
-
-            if (h.m_card1.rank() == h.m_card2.rank())
-            {
-                const uint16_t mask_1 = (cs_all.as_bitset() >> (temp[0] * c_num_ranks)) & c_mask_ranks;
-                const uint16_t mask_2 = (cs_all.as_bitset() >> (temp[1] * c_num_ranks)) & c_mask_ranks;
-                if (mask_1 < mask_2)
-                {
-                    std::swap(temp[0], temp[1]);
-                }
-            }
-            const uint16_t mask_3 = (cs_all.as_bitset() >> (temp[2] * c_num_ranks)) & c_mask_ranks;
-            const uint16_t mask_4 = (cs_all.as_bitset() >> (temp[3] * c_num_ranks)) & c_mask_ranks;
-            if (mask_3 < mask_4)
-            {
-                std::swap(temp[2], temp[3]);
-            }
-            // else positions 3 and 4 are in correct order from the lookup table
+            throw std::runtime_error("suit_normalization_permutation: called with invalid board size");
         }
-
-        // "invert" numbers so we return the wanted permutation to get that conanical suits
-        std::array<uint8_t, 4> ret{};
-        for (uint8_t u = 0; u < 4; ++u)
+        if (cs_all.size() != (board_size + 2))
         {
-            ret[temp[u]] = u;
+            throw std::runtime_error("suit_normalization_permutation: called with duplicated cards");
         }
 
-        return ret;
+        return detail::suit_normalization_permutation(h, cs_all.suit_masks());
     }
 
 }    // namespace mkp
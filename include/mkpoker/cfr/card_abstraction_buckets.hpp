@@ -0,0 +1,338 @@
+/*
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#pragma once
+
+#include <mkpoker/base/hand_indexer.hpp>
+#include <mkpoker/cfr/card_abstraction.hpp>
+#include <mkpoker/game/game.hpp>
+#include <mkpoker/util/file.hpp>
+#include <mkpoker/util/mapped_file.hpp>
+#include <mkpoker/util/mtp.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mkp
+{
+    inline namespace constants
+    {
+        // preflop, flop, turn, river
+        constexpr uint8_t c_num_streets = 4;
+    }    // namespace constants
+
+    // number of canonical hands for every street, i.e., the number of entries of a bucket table
+    inline constexpr std::array<uint64_t, c_num_streets> c_bucket_table_sizes{hand_indexer_preflop::size(0), hand_indexer_flop::size(1),
+                                                                               hand_indexer_turn::size(1), hand_indexer_river::size(1)};
+
+    // canonical hand index (hand_indexer_preflop/flop/turn/river) for the hand of a player in a given game state
+    template <std::size_t N>
+    [[nodiscard]] uint64_t canonical_hand_index(const gb_gamestate_t game_state, const uint8_t active_player, const gamecards<N>& cards)
+    {
+        const auto& hand = cards.m_hands[active_player];
+        switch (game_state)
+        {
+            case gb_gamestate_t::PREFLOP_BET:
+                return hand_indexer_preflop::index(hand);
+            case gb_gamestate_t::FLOP_BET:
+                return hand_indexer_flop::index(hand, cards.board_n_as_cs(3));
+            case gb_gamestate_t::TURN_BET:
+                return hand_indexer_turn::index(hand, cards.board_n_as_cs(4));
+            default:
+                return hand_indexer_river::index(hand, cards.board_n_as_cs(5));
+        }
+    }
+
+    // street for a game state, the river table is used for finished games
+    [[nodiscard]] constexpr std::size_t street_index(const gb_gamestate_t game_state) noexcept
+    {
+        return game_state == gb_gamestate_t::GAME_FIN ? c_num_streets - 1 : static_cast<std::size_t>(game_state);
+    }
+
+    // file layout: header, followed by one flat array per street (preflop, flop, turn, river) with the bucket
+    // of every canonical hand index, each array starts at m_offsets[street] bytes from the beginning of the file
+    //
+    // version 2: entries can be uint16_t or uint32_t, arrays are aligned to 64 bytes (so the file can be mapped into memory)
+    struct bucket_file_header_t
+    {
+        static constexpr std::array<char, 8> c_magic{'M', 'K', 'P', 'B', 'K', 'T', '\0', '\0'};
+        static constexpr uint32_t c_version = 2;
+        static constexpr uint64_t c_alignment = 64;
+
+        std::array<char, 8> m_magic = c_magic;
+        uint32_t m_version = c_version;
+        // size of one entry in bytes
+        uint32_t m_entry_size = sizeof(uint16_t);
+        std::array<uint32_t, c_num_streets> m_num_buckets{};
+        std::array<uint64_t, c_num_streets> m_num_entries{};
+        std::array<uint64_t, c_num_streets> m_offsets{};
+
+        // create a header with the layout for the given number of buckets
+        [[nodiscard]] static bucket_file_header_t make(const std::array<uint32_t, c_num_streets>& num_buckets, const uint32_t entry_size)
+        {
+            bucket_file_header_t ret{};
+            ret.m_entry_size = entry_size;
+            ret.m_num_buckets = num_buckets;
+            uint64_t offset = sizeof(bucket_file_header_t);
+            for (uint8_t i = 0; i < c_num_streets; ++i)
+            {
+                offset = (offset + c_alignment - 1) / c_alignment * c_alignment;
+                ret.m_num_entries[i] = c_bucket_table_sizes[i];
+                ret.m_offsets[i] = offset;
+                offset += c_bucket_table_sizes[i] * entry_size;
+            }
+            return ret;
+        }
+
+        // total file size
+        [[nodiscard]] uint64_t file_size() const noexcept { return m_offsets.back() + m_num_entries.back() * m_entry_size; }
+
+        // throws if the header does not belong to a valid bucket file
+        void validate(const std::string& filename, const uint64_t actual_file_size) const
+        {
+            if (m_magic != c_magic || m_version == 0 || m_version > c_version)
+            {
+                throw std::runtime_error("bucket file '" + filename + "': invalid magic or unsupported version");
+            }
+            if (m_entry_size != sizeof(uint16_t) && m_entry_size != sizeof(uint32_t))
+            {
+                throw std::runtime_error("bucket file '" + filename + "': unsupported entry size " + std::to_string(m_entry_size));
+            }
+            for (uint8_t i = 0; i < c_num_streets; ++i)
+            {
+                if (m_num_entries[i] != c_bucket_table_sizes[i] || m_num_buckets[i] == 0 || m_offsets[i] % m_entry_size != 0 ||
+                    m_offsets[i] < sizeof(bucket_file_header_t) || m_offsets[i] + m_num_entries[i] * m_entry_size > actual_file_size)
+                {
+                    throw std::runtime_error("bucket file '" + filename + "': invalid table for street " + std::to_string(i));
+                }
+            }
+        }
+    };
+
+    static_assert(std::is_standard_layout_v<bucket_file_header_t>, "bucket_file_header_t should have standard layout");
+    static_assert(sizeof(bucket_file_header_t) == 96, "bucket_file_header_t should have no padding");
+
+    // bucket of every canonical hand for all streets
+    template <typename T>
+    struct basic_bucket_tables_t
+    {
+        static_assert(std::is_same_v<T, uint16_t> || std::is_same_v<T, uint32_t>, "bucket tables store uint16_t or uint32_t");
+
+        std::array<uint32_t, c_num_streets> m_num_buckets{};
+        std::array<std::vector<T>, c_num_streets> m_buckets;
+    };
+
+    using bucket_tables_t = basic_bucket_tables_t<uint16_t>;
+
+    // write bucket tables to file (native byte order)
+    template <typename T>
+    void save_bucket_file(const std::string& filename, const basic_bucket_tables_t<T>& tables)
+    {
+        const auto header = bucket_file_header_t::make(tables.m_num_buckets, sizeof(T));
+        for (uint8_t i = 0; i < c_num_streets; ++i)
+        {
+            if (tables.m_buckets[i].size() != header.m_num_entries[i])
+            {
+                throw std::runtime_error("save_bucket_file(const string&, const bucket_tables_t&): invalid table for street " +
+                                         std::to_string(i));
+            }
+        }
+
+        auto f = detail::open_file(filename, "wb");
+        detail::write_binary(f.get(), &header, 1);
+        uint64_t pos = sizeof(bucket_file_header_t);
+        for (uint8_t i = 0; i < c_num_streets; ++i)
+        {
+            const std::array<char, bucket_file_header_t::c_alignment> padding{};
+            detail::write_binary(f.get(), padding.data(), header.m_offsets[i] - pos);
+            detail::write_binary(f.get(), tables.m_buckets[i].data(), tables.m_buckets[i].size());
+            pos = header.m_offsets[i] + tables.m_buckets[i].size() * sizeof(T);
+        }
+
+        // buffered data is written by fclose, the file on disk has to pass the checks of load_bucket_file
+        if (std::fclose(f.release()) != 0)
+        {
+            throw std::runtime_error("save_bucket_file(const string&, const bucket_tables_t&): could not write file '" + filename + "'");
+        }
+        header.validate(filename, std::filesystem::file_size(filename));
+    }
+
+    // read bucket tables from file into memory
+    // the file is mapped instead of read with std::fseek / std::fread, which can not seek beyond 2 GB where long is 32 bit
+    template <typename T = uint16_t>
+    [[nodiscard]] basic_bucket_tables_t<T> load_bucket_file(const std::string& filename)
+    {
+        const mapped_file file(filename, mapped_file_advice_t::SEQUENTIAL);
+        if (file.size() < sizeof(bucket_file_header_t))
+        {
+            throw std::runtime_error("load_bucket_file(const string&): file '" + filename + "' too small");
+        }
+        bucket_file_header_t header{};
+        std::memcpy(&header, file.data(), sizeof(bucket_file_header_t));
+        header.validate(filename, file.size());
+        if (header.m_entry_size != sizeof(T))
+        {
+            throw std::runtime_error("load_bucket_file(const string&): entry size in file '" + filename + "' does not match");
+        }
+
+        basic_bucket_tables_t<T> ret{};
+        for (uint8_t i = 0; i < c_num_streets; ++i)
+        {
+            ret.m_num_buckets[i] = header.m_num_buckets[i];
+            ret.m_buckets[i].resize(header.m_num_entries[i]);
+            std::memcpy(ret.m_buckets[i].data(), file.data() + header.m_offsets[i], ret.m_buckets[i].size() * sizeof(T));
+        }
+        return ret;
+    }
+
+    // card abstraction with precomputed buckets for every canonical hand (e.g. created by k-means clustering)
+    // the id is a single lookup into the bucket table with the canonical hand index
+    template <std::size_t N, UnsignedIntegral T = uint32_t>
+    class card_abstraction_buckets final : public card_abstraction_base<N, T>
+    {
+        bucket_tables_t m_tables;
+
+       public:
+        using typename card_abstraction_base<N, T>::uint_type;
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // CTORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // load from a bucket file
+        explicit card_abstraction_buckets(const std::string& filename) : m_tables(load_bucket_file(filename)) {}
+
+        // use tables directly
+        explicit card_abstraction_buckets(bucket_tables_t tables) : m_tables(std::move(tables))
+        {
+            for (uint8_t i = 0; i < c_num_streets; ++i)
+            {
+                if (m_tables.m_buckets[i].size() != c_bucket_table_sizes[i])
+                {
+                    throw std::runtime_error("card_abstraction_buckets(bucket_tables_t): invalid table for street " + std::to_string(i));
+                }
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // ACCESSORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] virtual uint_type size(const gb_gamestate_t game_state) const override
+        {
+            return m_tables.m_num_buckets[street_index(game_state)];
+        }
+
+        [[nodiscard]] virtual uint_type id(const gb_gamestate_t game_state, const uint8_t active_player,
+                                           const gamecards<N>& cards) const override
+        {
+            return m_tables.m_buckets[street_index(game_state)][canonical_hand_index(game_state, active_player, cards)];
+        }
+
+        // debug / human readable description of that id
+        [[nodiscard]] virtual std::string str_id(const gb_gamestate_t game_state, uint_type id) const override
+        {
+            return "bucket " + std::to_string(id) + "/" + std::to_string(size(game_state)) + " (" + to_string(game_state) + ")";
+        }
+
+        // raw tables
+        [[nodiscard]] const bucket_tables_t& tables() const noexcept { return m_tables; }
+    };
+
+    // card abstraction backed by a read-only memory mapped bucket file: opening is instant and the
+    // tables are shared via the page cache by all processes using the same file
+    template <std::size_t N, UnsignedIntegral T = uint32_t>
+    class card_abstraction_mmap final : public card_abstraction_base<N, T>
+    {
+        mapped_file m_file;
+        bucket_file_header_t m_header;
+        std::array<const std::byte*, c_num_streets> m_tables{};
+
+       public:
+        using typename card_abstraction_base<N, T>::uint_type;
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // CTORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        explicit card_abstraction_mmap(const std::string& filename) : m_file(filename, mapped_file_advice_t::RANDOM)
+        {
+            if (m_file.size() < sizeof(bucket_file_header_t))
+            {
+                throw std::runtime_error("card_abstraction_mmap(const string&): file '" + filename + "' too small");
+            }
+            std::memcpy(&m_header, m_file.data(), sizeof(bucket_file_header_t));
+            m_header.validate(filename, m_file.size());
+            if (m_header.m_entry_size > sizeof(uint_type))
+            {
+                throw std::runtime_error("card_abstraction_mmap(const string&): buckets in file '" + filename +
+                                         "' do not fit into uint_type");
+            }
+
+            for (uint8_t i = 0; i < c_num_streets; ++i)
+            {
+                m_tables[i] = m_file.data() + m_header.m_offsets[i];
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // ACCESSORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] virtual uint_type size(const gb_gamestate_t game_state) const override
+        {
+            return static_cast<uint_type>(m_header.m_num_buckets[street_index(game_state)]);
+        }
+
+        [[nodiscard]] virtual uint_type id(const gb_gamestate_t game_state, const uint8_t active_player,
+                                           const gamecards<N>& cards) const override
+        {
+            return bucket(street_index(game_state), canonical_hand_index(game_state, active_player, cards));
+        }
+
+        // debug / human readable description of that id
+        [[nodiscard]] virtual std::string str_id(const gb_gamestate_t game_state, uint_type id) const override
+        {
+            return "bucket " + std::to_string(id) + "/" + std::to_string(size(game_state)) + " (" + to_string(game_state) + ")";
+        }
+
+        // bucket for the canonical hand index of a street (0: preflop ... 3: river)
+        [[nodiscard]] uint_type bucket(const std::size_t street, const uint64_t idx) const noexcept
+        {
+            // the arrays are aligned, so they can be accessed directly
+            if (m_header.m_entry_size == sizeof(uint16_t))
+            {
+                return static_cast<uint_type>(reinterpret_cast<const uint16_t*>(m_tables[street])[idx]);
+            }
+            return static_cast<uint_type>(reinterpret_cast<const uint32_t*>(m_tables[street])[idx]);
+        }
+
+        [[nodiscard]] const bucket_file_header_t& header() const noexcept { return m_header; }
+    };
+
+}    // namespace mkp
@@ -0,0 +1,411 @@
+/*
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#pragma once
+
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/combo.hpp>
+#include <mkpoker/base/hand.hpp>
+#include <mkpoker/base/hand_indexer.hpp>
+#include <mkpoker/base/range.hpp>
+#include <mkpoker/cfr/card_abstraction.hpp>
+#include <mkpoker/game/game.hpp>
+#include <mkpoker/holdem/holdem_combo_evaluation.hpp>
+#include <mkpoker/holdem/holdem_evaluation.hpp>
+#include <mkpoker/holdem/holdem_showdown.hpp>
+#include <mkpoker/util/file.hpp>
+#include <mkpoker/util/mtp.hpp>
+#include <mkpoker/util/parallel.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace mkp
+{
+    inline namespace constants
+    {
+        // max value for the river hand strength (2 * wins + ties against all opponent hands)
+        constexpr uint16_t c_river_strength_max = 2 * ((c_deck_size - 7) * (c_deck_size - 8) / 2);
+    }    // namespace constants
+
+    // hand strength (2 * wins + ties against all possible opponent hands) for every hand on a river board,
+    // indexed like detail::c_combo_cards, hands colliding with the board are set to 0
+    // (single sweep over the sorted hands, see detail::river_sweep)
+    [[nodiscard]] inline std::array<uint16_t, c_num_combos> river_hand_strengths(const cardset board)
+    {
+        std::array<uint16_t, c_num_combos> ret{};
+        detail::river_sweep<int32_t, 1>(
+            river_combo_order(board), 1, [](const uint16_t) { return 0u; }, [](const uint16_t) { return 1; },
+            [&](const uint16_t combo, const uint32_t, const int32_t wins, const int32_t ties, const int32_t) {
+                ret[combo] = static_cast<uint16_t>(2 * wins + ties);
+            });
+        return ret;
+    }
+
+    // expected hand strength and expected squared hand strength against a uniform random opponent hand
+    struct ehs_t
+    {
+        float m_ehs = 0.0f;
+        float m_ehs2 = 0.0f;
+    };
+
+    // EHS / EHS² for every canonical flop, turn and river hand (imperfect recall indexers),
+    // the river table stores 2 * wins + ties to save memory (~250MB instead of ~1GB)
+    class ehs_tables
+    {
+        std::vector<uint16_t> m_river;
+        std::vector<ehs_t> m_turn;
+        std::vector<ehs_t> m_flop;
+
+        // file format identifier and version
+        static constexpr std::array<char, 8> c_magic{'M', 'K', 'P', 'E', 'H', 'S', '\0', '\0'};
+        static constexpr uint32_t c_version = 1;
+
+        ehs_tables() = default;
+
+       public:
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // CTORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // compute all tables (takes a few minutes with enough cores)
+        [[nodiscard]] static ehs_tables generate(const unsigned num_threads = default_num_threads())
+        {
+            ehs_tables ret{};
+            ret.m_river.resize(hand_indexer_river::size(1));
+            ret.m_turn.resize(hand_indexer_turn::size(1));
+            ret.m_flop.resize(hand_indexer_flop::size(1));
+
+            // river: canonical boards are never isomorphic to each other, so no two threads write the same entry
+            using board_indexer_t = hand_indexer<c_num_board_cards>;
+            parallel_for(board_indexer_t::size(0), num_threads, [&](const uint64_t i) {
+                const cardset board = board_indexer_t::unindex(0, i)[0];
+                const auto strengths = river_hand_strengths(board);
+                (~blocked_combos(board)).for_each([&](const uint16_t combo) {
+                    hand_indexer_river::state_t state{};
+                    static_cast<void>(hand_indexer_river::index_next_round(state, combo_cardset(combo)));
+                    ret.m_river[hand_indexer_river::index_next_round(state, board)] = strengths[combo];
+                });
+            });
+
+            // turn: average over all river cards
+            parallel_for(ret.m_turn.size(), num_threads, [&](const uint64_t i) {
+                const auto cs = hand_indexer_turn::unindex(1, i);
+                hand_indexer_river::state_t hand_state{};
+                static_cast<void>(hand_indexer_river::index_next_round(hand_state, cs[0]));
+
+                double sum = 0.0;
+                double sum_sq = 0.0;
+                unsigned n = 0;
+                for (uint64_t mask = c_cardset_full & ~cs[0].combine(cs[1]).as_bitset(); mask; mask &= mask - 1, ++n)
+                {
+                    auto state = hand_state;
+                    const cardset river = cs[1].combine(cardset{mask & (~mask + 1)});
+                    const double hs = double(ret.m_river[hand_indexer_river::index_next_round(state, river)]) / c_river_strength_max;
+                    sum += hs;
+                    sum_sq += hs * hs;
+                }
+                ret.m_turn[i] = {static_cast<float>(sum / n), static_cast<float>(sum_sq / n)};
+            });
+
+            // flop: average over all turn cards (which are already averaged over all river cards)
+            parallel_for(ret.m_flop.size(), num_threads, [&](const uint64_t i) {
+                const auto cs = hand_indexer_flop::unindex(1, i);
+                hand_indexer_turn::state_t hand_state{};
+                static_cast<void>(hand_indexer_turn::index_next_round(hand_state, cs[0]));
+
+                double sum = 0.0;
+                double sum_sq = 0.0;
+                unsigned n = 0;
+                for (uint64_t mask = c_cardset_full & ~cs[0].combine(cs[1]).as_bitset(); mask; mask &= mask - 1, ++n)
+                {
+                    auto state = hand_state;
+                    const cardset turn = cs[1].combine(cardset{mask & (~mask + 1)});
+                    const auto& e = ret.m_turn[hand_indexer_turn::index_next_round(state, turn)];
+                    sum += e.m_ehs;
+                    sum_sq += e.m_ehs2;
+                }
+                ret.m_flop[i] = {static_cast<float>(sum / n), static_cast<float>(sum_sq / n)};
+            });
+
+            return ret;
+        }
+
+        // load tables from a file created with save()
+        [[nodiscard]] static ehs_tables load(const std::string& filename)
+        {
+            const auto f = detail::open_file(filename, "rb");
+
+            std::array<char, 8> magic{};
+            uint32_t version = 0;
+            std::array<uint64_t, 3> sizes{};
+            detail::read_binary(f.get(), magic.data(), magic.size());
+            detail::read_binary(f.get(), &version, 1);
+            detail::read_binary(f.get(), sizes.data(), sizes.size());
+            if (magic != c_magic || version != c_version || sizes[0] != hand_indexer_flop::size(1) ||
+                sizes[1] != hand_indexer_turn::size(1) || sizes[2] != hand_indexer_river::size(1))
+            {
+                throw std::runtime_error("ehs_tables::load(const string&): invalid file '" + filename + "'");
+            }
+
+            ehs_tables ret{};
+            ret.m_flop.resize(sizes[0]);
+            ret.m_turn.resize(sizes[1]);
+            ret.m_river.resize(sizes[2]);
+            detail::read_binary(f.get(), ret.m_flop.data(), ret.m_flop.size());
+            detail::read_binary(f.get(), ret.m_turn.data(), ret.m_turn.size());
+            detail::read_binary(f.get(), ret.m_river.data(), ret.m_river.size());
+            return ret;
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // ACCESSORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // EHS / EHS² for the canonical index of the respective indexer
+        [[nodiscard]] ehs_t flop(const uint64_t idx) const { return m_flop[idx]; }
+        [[nodiscard]] ehs_t turn(const uint64_t idx) const { return m_turn[idx]; }
+        [[nodiscard]] ehs_t river(const uint64_t idx) const
+        {
+            const float hs = static_cast<float>(m_river[idx]) / c_river_strength_max;
+            return {hs, hs * hs};
+        }
+
+        // EHS / EHS² for hand and board (3 to 5 cards)
+        [[nodiscard]] ehs_t get(const hand_2c hand, const cardset board) const
+        {
+            switch (board.size())
+            {
+                case 3:
+                    return flop(hand_indexer_flop::index(hand, board));
+                case 4:
+                    return turn(hand_indexer_turn::index(hand, board));
+                case 5:
+                    return river(hand_indexer_river::index(hand, board));
+                default:
+                    throw std::runtime_error("ehs_tables::get(const hand_2c, const cardset): invalid board size " +
+                                             std::to_string(board.size()));
+            }
+        }
+
+        // raw tables
+        [[nodiscard]] std::span<const ehs_t> flop_table() const noexcept { return m_flop; }
+        [[nodiscard]] std::span<const ehs_t> turn_table() const noexcept { return m_turn; }
+        [[nodiscard]] std::span<const uint16_t> river_table() const noexcept { return m_river; }
+
+        // write tables to file (native byte order)
+        void save(const std::string& filename) const
+        {
+            const auto f = detail::open_file(filename, "wb");
+            const std::array<uint64_t, 3> sizes{m_flop.size(), m_turn.size(), m_river.size()};
+            detail::write_binary(f.get(), c_magic.data(), c_magic.size());
+            detail::write_binary(f.get(), &c_version, 1);
+            detail::write_binary(f.get(), sizes.data(), sizes.size());
+            detail::write_binary(f.get(), m_flop.data(), m_flop.size());
+            detail::write_binary(f.get(), m_turn.data(), m_turn.size());
+            detail::write_binary(f.get(), m_river.data(), m_river.size());
+        }
+    };
+
+    // assign every value to one of num_buckets buckets by its percentile, equal values share a bucket
+    // (every canonical hand has the same weight, regardless of how many suit isomorphic hands it represents)
+    [[nodiscard]] inline std::vector<uint16_t> percentile_buckets(const std::span<const float> values, const uint16_t num_buckets,
+                                                                  const unsigned num_threads = default_num_threads())
+    {
+        if (num_buckets == 0 || values.empty())
+        {
+            throw std::runtime_error("percentile_buckets(span<const float>, const uint16_t): no values or buckets");
+        }
+
+        std::vector<float> sorted(values.begin(), values.end());
+        std::sort(sorted.begin(), sorted.end());
+
+        std::vector<uint16_t> ret(values.size());
+        parallel_for(values.size(), num_threads, [&](const uint64_t i) {
+            const uint64_t pos = std::lower_bound(sorted.cbegin(), sorted.cend(), values[i]) - sorted.cbegin();
+            ret[i] = static_cast<uint16_t>(pos * num_buckets / sorted.size());
+        });
+        return ret;
+    }
+
+    // same for small integral values (e.g. the river hand strength), uses a histogram instead of sorting
+    [[nodiscard]] inline std::vector<uint16_t> percentile_buckets(const std::span<const uint16_t> values, const uint16_t num_buckets,
+                                                                  const unsigned num_threads = default_num_threads())
+    {
+        if (num_buckets == 0 || values.empty())
+        {
+            throw std::runtime_error("percentile_buckets(span<const uint16_t>, const uint16_t): no values or buckets");
+        }
+
+        const uint16_t max = *std::max_element(values.begin(), values.end());
+        std::vector<uint64_t> less(max + 2ull, 0);
+        for (auto&& e : values)
+        {
+            ++less[e + 1ull];
+        }
+        for (std::size_t i = 1; i < less.size(); ++i)
+        {
+            less[i] += less[i - 1];
+        }
+
+        std::vector<uint16_t> ret(values.size());
+        parallel_for(values.size(), num_threads,
+                     [&](const uint64_t i) { ret[i] = static_cast<uint16_t>(less[values[i]] * num_buckets / values.size()); });
+        return ret;
+    }
+
+    enum class ehs_metric_t : uint8_t
+    {
+        EHS = 0,
+        EHS2
+    };
+
+    // card abstraction that buckets hands by percentiles of EHS or EHS², preflop each of the 169 hand classes is its own bucket
+    // the id is a single lookup into the bucket table with the canonical hand index
+    template <std::size_t N, UnsignedIntegral T = uint32_t>
+    class card_abstraction_ehs final : public card_abstraction_base<N, T>
+    {
+        // number of buckets and bucket for each canonical hand index for flop, turn and river
+        std::array<uint16_t, 3> m_num_buckets{};
+        std::array<std::vector<uint16_t>, 3> m_buckets;
+
+        static constexpr std::array<char, 8> c_magic{'M', 'K', 'P', 'B', 'E', 'H', 'S', '\0'};
+        static constexpr uint32_t c_version = 1;
+
+        [[nodiscard]] static std::size_t street(const gb_gamestate_t game_state)
+        {
+            switch (game_state)
+            {
+                case gb_gamestate_t::FLOP_BET:
+                    return 0;
+                case gb_gamestate_t::TURN_BET:
+                    return 1;
+                case gb_gamestate_t::RIVER_BET:
+                case gb_gamestate_t::GAME_FIN:
+                    return 2;
+                default:
+                    throw std::runtime_error("card_abstraction_ehs: invalid game state " + to_string(game_state));
+            }
+        }
+
+       public:
+        using typename card_abstraction_base<N, T>::uint_type;
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // CTORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // create buckets from precomputed tables, num_buckets for flop, turn and river
+        card_abstraction_ehs(const ehs_tables& tables, const std::array<uint16_t, 3>& num_buckets,
+                             const ehs_metric_t metric = ehs_metric_t::EHS2, const unsigned num_threads = default_num_threads())
+            : m_num_buckets(num_buckets)
+        {
+            const auto extract = [&](const std::span<const ehs_t> sp) {
+                std::vector<float> ret(sp.size());
+                std::transform(sp.begin(), sp.end(), ret.begin(),
+                               [&](const ehs_t& e) { return metric == ehs_metric_t::EHS ? e.m_ehs : e.m_ehs2; });
+                return ret;
+            };
+
+            m_buckets[0] = percentile_buckets(extract(tables.flop_table()), m_num_buckets[0], num_threads);
+            m_buckets[1] = percentile_buckets(extract(tables.turn_table()), m_num_buckets[1], num_threads);
+            // EHS² on the river is just HS², which results in the same ordering
+            m_buckets[2] = percentile_buckets(tables.river_table(), m_num_buckets[2], num_threads);
+        }
+
+        // load buckets from a file created with save()
+        explicit card_abstraction_ehs(const std::string& filename)
+        {
+            const auto f = detail::open_file(filename, "rb");
+
+            std::array<char, 8> magic{};
+            uint32_t version = 0;
+            detail::read_binary(f.get(), magic.data(), magic.size());
+            detail::read_binary(f.get(), &version, 1);
+            detail::read_binary(f.get(), m_num_buckets.data(), m_num_buckets.size());
+            if (magic != c_magic || version != c_version)
+            {
+                throw std::runtime_error("card_abstraction_ehs(const string&): invalid file '" + filename + "'");
+            }
+
+            const std::array<uint64_t, 3> sizes{hand_indexer_flop::size(1), hand_indexer_turn::size(1), hand_indexer_river::size(1)};
+            for (std::size_t i = 0; i < m_buckets.size(); ++i)
+            {
+                m_buckets[i].resize(sizes[i]);
+                detail::read_binary(f.get(), m_buckets[i].data(), m_buckets[i].size());
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // ACCESSORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] virtual uint_type size(const gb_gamestate_t game_state) const override
+        {
+            return game_state == gb_gamestate_t::PREFLOP_BET ? c_range_size : m_num_buckets[street(game_state)];
+        }
+
+        [[nodiscard]] virtual uint_type id(const gb_gamestate_t game_state, const uint8_t active_player,
+                                           const gamecards<N>& cards) const override
+        {
+            const auto& hand = cards.m_hands[active_player];
+            switch (game_state)
+            {
+                case gb_gamestate_t::PREFLOP_BET:
+                    return range::index(hand);
+                case gb_gamestate_t::FLOP_BET:
+                    return m_buckets[0][hand_indexer_flop::index(hand, cards.board_n_as_cs(3))];
+                case gb_gamestate_t::TURN_BET:
+                    return m_buckets[1][hand_indexer_turn::index(hand, cards.board_n_as_cs(4))];
+                default:
+                    return m_buckets[2][hand_indexer_river::index(hand, cards.board_n_as_cs(5))];
+            }
+        }
+
+        // debug / human readable description of that id
+        [[nodiscard]] virtual std::string str_id(const gb_gamestate_t game_state, uint_type id) const override
+        {
+            if (game_state == gb_gamestate_t::PREFLOP_BET)
+            {
+                return range::hand(static_cast<uint8_t>(id)).str() + " (" + std::to_string(id) + ")";
+            }
+            return "EHS bucket " + std::to_string(id) + "/" + std::to_string(size(game_state)) + " (" + to_string(game_state) + ")";
+        }
+
+        // write buckets to file (native byte order)
+        void save(const std::string& filename) const
+        {
+            const auto f = detail::open_file(filename, "wb");
+            detail::write_binary(f.get(), c_magic.data(), c_magic.size());
+            detail::write_binary(f.get(), &c_version, 1);
+            detail::write_binary(f.get(), m_num_buckets.data(), m_num_buckets.size());
+            for (auto&& e : m_buckets)
+            {
+                detail::write_binary(f.get(), e.data(), e.size());
+            }
+        }
+    };
+
+}    // namespace mkp
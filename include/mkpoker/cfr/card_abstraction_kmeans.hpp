@@ -0,0 +1,307 @@
+/*
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#pragma once
+
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/combo.hpp>
+#include <mkpoker/base/hand_indexer.hpp>
+#include <mkpoker/cfr/card_abstraction_buckets.hpp>
+#include <mkpoker/cfr/card_abstraction_ehs.hpp>
+#include <mkpoker/util/kmeans.hpp>
+#include <mkpoker/util/parallel.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// offline builder for a card abstraction that clusters hands with k-means:
+//   - flop/turn: histogram of the river hand strength over all runouts, compared with the earth mover's distance
+//   - river: hand strength against a number of opponent clusters (OCHS), compared with the euclidean distance
+// see M. Johanson et al., "Evaluating State-Space Abstractions in Extensive-Form Games", AAMAS 2013
+
+namespace mkp
+{
+    inline namespace constants
+    {
+        constexpr uint32_t c_max_histogram_bins = 256;
+        constexpr uint32_t c_max_ochs_clusters = 16;
+    }    // namespace constants
+
+    namespace detail
+    {
+        // cumulative histograms of the river hand strength over all runouts for every canonical hand of Indexer,
+        // stored as counts, i.e., the L1 distance of two entries is the earth mover's distance (times number of runouts)
+        template <typename T, typename Indexer>
+        [[nodiscard]] std::vector<T> equity_histograms(const ehs_tables& tables, const uint32_t num_bins, const unsigned num_threads)
+        {
+            if (num_bins == 0 || num_bins > c_max_histogram_bins)
+            {
+                throw std::runtime_error("equity_histograms(): invalid number of bins " + std::to_string(num_bins));
+            }
+
+            const uint64_t n = Indexer::size(1);
+            const auto river = tables.river_table();
+            std::vector<T> ret(n * num_bins);
+            parallel_for(n, num_threads, [&](const uint64_t i) {
+                const auto cs = Indexer::unindex(1, i);
+                hand_indexer_river::state_t hand_state{};
+                static_cast<void>(hand_indexer_river::index_next_round(hand_state, cs[0]));
+
+                std::array<uint32_t, c_max_histogram_bins> hist{};
+                const auto add = [&](const cardset board) {
+                    auto state = hand_state;
+                    const uint32_t v = river[hand_indexer_river::index_next_round(state, board)];
+                    ++hist[v * num_bins / (c_river_strength_max + 1)];
+                };
+
+                const uint64_t dead = cs[0].combine(cs[1]).as_bitset();
+                for (uint64_t m1 = c_cardset_full & ~dead; m1; m1 &= m1 - 1)
+                {
+                    const uint64_t c1 = m1 & (~m1 + 1);
+                    if (cs[1].size() == c_num_board_cards - 1)
+                    {
+                        add(cardset{cs[1].as_bitset() | c1});
+                        continue;
+                    }
+                    for (uint64_t m2 = m1 & (m1 - 1); m2; m2 &= m2 - 1)
+                    {
+                        add(cardset{cs[1].as_bitset() | c1 | (m2 & (~m2 + 1))});
+                    }
+                }
+
+                uint32_t sum = 0;
+                for (uint32_t b = 0; b < num_bins; ++b)
+                {
+                    sum += hist[b];
+                    ret[i * num_bins + b] = static_cast<T>(sum);
+                }
+            });
+            return ret;
+        }
+
+        // renumber clusters so that bucket 0 contains the weakest hands, strength is the sum of the center coordinates
+        inline void relabel_by_strength(kmeans_result_t& result, const std::size_t dim, const bool higher_is_stronger)
+        {
+            const auto k = static_cast<uint32_t>(result.m_centers.size() / dim);
+            std::vector<double> strength(k, 0.0);
+            for (uint32_t c = 0; c < k; ++c)
+            {
+                strength[c] = std::accumulate(result.m_centers.cbegin() + c * dim, result.m_centers.cbegin() + (c + 1) * dim, 0.0);
+                strength[c] = higher_is_stronger ? strength[c] : -strength[c];
+            }
+
+            std::vector<uint32_t> order(k);
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(), [&](const uint32_t lhs, const uint32_t rhs) { return strength[lhs] < strength[rhs]; });
+            std::vector<uint32_t> new_label(k);
+            std::vector<float> centers(result.m_centers.size());
+            for (uint32_t i = 0; i < k; ++i)
+            {
+                new_label[order[i]] = i;
+                std::copy(result.m_centers.cbegin() + order[i] * dim, result.m_centers.cbegin() + (order[i] + 1) * dim,
+                          centers.begin() + i * dim);
+            }
+            for (auto&& e : result.m_assignment)
+            {
+                e = new_label[e];
+            }
+            result.m_centers = std::move(centers);
+        }
+    }    // namespace detail
+
+    // cumulative equity histograms (num_bins values per canonical flop hand)
+    [[nodiscard]] inline std::vector<uint16_t> equity_histograms_flop(const ehs_tables& tables, const uint32_t num_bins,
+                                                                     const unsigned num_threads = default_num_threads())
+    {
+        return detail::equity_histograms<uint16_t, hand_indexer_flop>(tables, num_bins, num_threads);
+    }
+
+    // cumulative equity histograms (num_bins values per canonical turn hand)
+    [[nodiscard]] inline std::vector<uint8_t> equity_histograms_turn(const ehs_tables& tables, const uint32_t num_bins,
+                                                                    const unsigned num_threads = default_num_threads())
+    {
+        return detail::equity_histograms<uint8_t, hand_indexer_turn>(tables, num_bins, num_threads);
+    }
+
+    // EHS for every canonical preflop hand (hand_indexer_preflop), average over all flops
+    [[nodiscard]] inline std::vector<float> preflop_ehs(const ehs_tables& tables, const unsigned num_threads = default_num_threads())
+    {
+        std::vector<float> ret(hand_indexer_preflop::size(0));
+        parallel_for(ret.size(), num_threads, [&](const uint64_t i) {
+            const cardset hand = hand_indexer_preflop::unindex(0, i)[0];
+            hand_indexer_flop::state_t hand_state{};
+            static_cast<void>(hand_indexer_flop::index_next_round(hand_state, hand));
+
+            double sum = 0.0;
+            unsigned n = 0;
+            const uint64_t live = c_cardset_full & ~hand.as_bitset();
+            for (uint64_t m1 = live; m1; m1 &= m1 - 1)
+            {
+                for (uint64_t m2 = m1 & (m1 - 1); m2; m2 &= m2 - 1)
+                {
+                    for (uint64_t m3 = m2 & (m2 - 1); m3; m3 &= m3 - 1, ++n)
+                    {
+                        auto state = hand_state;
+                        const cardset flop{(m1 & (~m1 + 1)) | (m2 & (~m2 + 1)) | (m3 & (~m3 + 1))};
+                        sum += tables.flop(hand_indexer_flop::index_next_round(state, flop)).m_ehs;
+                    }
+                }
+            }
+            ret[i] = static_cast<float>(sum / n);
+        });
+        return ret;
+    }
+
+    // opponent cluster of every hole card combination (indexed like detail::c_combo_cards), percentiles of preflop EHS
+    [[nodiscard]] inline std::array<uint8_t, c_num_combos> ochs_opponent_clusters(const ehs_tables& tables, const uint32_t num_clusters,
+                                                                                  const unsigned num_threads = default_num_threads())
+    {
+        if (num_clusters == 0 || num_clusters > c_max_ochs_clusters)
+        {
+            throw std::runtime_error("ochs_opponent_clusters(): invalid number of clusters " + std::to_string(num_clusters));
+        }
+
+        const auto buckets = percentile_buckets(preflop_ehs(tables, num_threads), static_cast<uint16_t>(num_clusters), num_threads);
+        std::array<uint8_t, c_num_combos> ret{};
+        for (uint16_t i = 0; i < c_num_combos; ++i)
+        {
+            hand_indexer_preflop::state_t state{};
+            ret[i] = static_cast<uint8_t>(buckets[hand_indexer_preflop::index_next_round(state, combo_cardset(i))]);
+        }
+        return ret;
+    }
+
+    // hand strength of every hand on a river board against each opponent cluster, quantized to [0,255],
+    // out has num_clusters entries per hole card combination (indexed like detail::c_combo_cards)
+    // same sweep as river_hand_strengths (detail::river_sweep), with the clusters as channels
+    inline void river_ochs(const cardset board, const std::array<uint8_t, c_num_combos>& opponent_clusters, const uint32_t num_clusters,
+                           const std::span<uint8_t> out)
+    {
+        if (num_clusters == 0 || num_clusters > c_max_ochs_clusters || out.size() != std::size_t(c_num_combos) * num_clusters)
+        {
+            throw std::runtime_error("river_ochs(): invalid number of clusters or output size");
+        }
+
+        std::fill(out.begin(), out.end(), uint8_t(0));
+        detail::river_sweep<int32_t, c_max_ochs_clusters>(
+            river_combo_order(board), num_clusters, [&](const uint16_t combo) { return uint32_t(opponent_clusters[combo]); },
+            [](const uint16_t) { return 1; },
+            [&](const uint16_t combo, const uint32_t c, const int32_t wins, const int32_t ties, const int32_t opp) {
+                out[std::size_t(combo) * num_clusters + c] =
+                    opp > 0 ? static_cast<uint8_t>((255 * (2 * wins + ties) + opp) / (2 * opp)) : uint8_t(0);
+            });
+    }
+
+    // OCHS features (num_clusters values per canonical river hand)
+    [[nodiscard]] inline std::vector<uint8_t> ochs_features_river(const std::array<uint8_t, c_num_combos>& opponent_clusters,
+                                                                  const uint32_t num_clusters,
+                                                                  const unsigned num_threads = default_num_threads())
+    {
+        std::vector<uint8_t> ret(hand_indexer_river::size(1) * num_clusters);
+
+        // canonical boards are never isomorphic to each other, so no two threads write the same entry
+        using board_indexer_t = hand_indexer<c_num_board_cards>;
+        parallel_for(board_indexer_t::size(0), num_threads, [&](const uint64_t i) {
+            const cardset board = board_indexer_t::unindex(0, i)[0];
+            std::vector<uint8_t> features(std::size_t(c_num_combos) * num_clusters);
+            river_ochs(board, opponent_clusters, num_clusters, features);
+            (~blocked_combos(board)).for_each([&](const uint16_t combo) {
+                hand_indexer_river::state_t state{};
+                static_cast<void>(hand_indexer_river::index_next_round(state, combo_cardset(combo)));
+                const auto idx = hand_indexer_river::index_next_round(state, board);
+                std::copy_n(features.cbegin() + std::size_t(combo) * num_clusters, num_clusters, ret.begin() + idx * num_clusters);
+            });
+        });
+        return ret;
+    }
+
+    // cluster features with k-means, bucket 0 contains the weakest hands
+    template <typename T>
+    [[nodiscard]] std::vector<uint16_t> cluster_buckets(const std::span<const T> features, const std::size_t dim, const uint32_t num_buckets,
+                                                        const kmeans_distance_t kind, const bool higher_is_stronger,
+                                                        const kmeans_options_t& options = {})
+    {
+        if (num_buckets == 0 || num_buckets > 0xFFFF)
+        {
+            throw std::runtime_error("cluster_buckets(): invalid number of buckets " + std::to_string(num_buckets));
+        }
+
+        auto result = kmeans(features, dim, num_buckets, kind, options);
+        detail::relabel_by_strength(result, dim, higher_is_stronger);
+        std::vector<uint16_t> ret(result.m_assignment.size());
+        std::transform(result.m_assignment.cbegin(), result.m_assignment.cend(), ret.begin(),
+                       [](const uint32_t e) { return static_cast<uint16_t>(e); });
+        return ret;
+    }
+
+    struct kmeans_abstraction_options_t
+    {
+        // number of buckets for flop, turn and river
+        std::array<uint32_t, 3> m_num_buckets{200, 200, 200};
+        // number of bins of the equity histograms (flop and turn)
+        uint32_t m_num_bins = 50;
+        // number of opponent clusters for OCHS (river)
+        uint32_t m_num_opponent_clusters = 8;
+        kmeans_options_t m_kmeans{};
+    };
+
+    // build all bucket tables, preflop every canonical hand is its own bucket
+    // this takes hours and needs a few GB of memory for the river features, see demo_kmeans_abstraction
+    [[nodiscard]] inline bucket_tables_t build_kmeans_abstraction(const ehs_tables& tables, const kmeans_abstraction_options_t& options)
+    {
+        const auto num_threads = options.m_kmeans.m_num_threads;
+        const auto bins = options.m_num_bins;
+
+        bucket_tables_t ret{};
+        ret.m_num_buckets[0] = static_cast<uint32_t>(hand_indexer_preflop::size(0));
+        ret.m_buckets[0].resize(hand_indexer_preflop::size(0));
+        std::iota(ret.m_buckets[0].begin(), ret.m_buckets[0].end(), uint16_t(0));
+
+        // cumulative histograms: more mass in the lower bins means a weaker hand
+        {
+            const auto features = equity_histograms_flop(tables, bins, num_threads);
+            ret.m_num_buckets[1] = options.m_num_buckets[0];
+            ret.m_buckets[1] = cluster_buckets<uint16_t>(features, bins, options.m_num_buckets[0], kmeans_distance_t::L1, false,
+                                                         options.m_kmeans);
+        }
+        {
+            const auto features = equity_histograms_turn(tables, bins, num_threads);
+            ret.m_num_buckets[2] = options.m_num_buckets[1];
+            ret.m_buckets[2] = cluster_buckets<uint8_t>(features, bins, options.m_num_buckets[1], kmeans_distance_t::L1, false,
+                                                        options.m_kmeans);
+        }
+        {
+            const auto clusters = ochs_opponent_clusters(tables, options.m_num_opponent_clusters, num_threads);
+            const auto features = ochs_features_river(clusters, options.m_num_opponent_clusters, num_threads);
+            ret.m_num_buckets[3] = options.m_num_buckets[2];
+            ret.m_buckets[3] = cluster_buckets<uint8_t>(features, options.m_num_opponent_clusters, options.m_num_buckets[2],
+                                                        kmeans_distance_t::L2, true, options.m_kmeans);
+        }
+
+        return ret;
+    }
+
+}    // namespace mkp
@@ -29,6 +29,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <algorithm>      // std::find, std::sort
 #include <array>          //
+#include <bit>            // std::countr_zero, std::popcount
 #include <cassert>        //
 #include <cstdint>        //
 #include <functional>     // std::greater
@@ -136,6 +137,25 @@ namespace mkp
         constexpr bool operator==(const gamecards&) const noexcept = default;
     };
 
+    // a (side) pot: every player contributes the chips invested between lower and upper bound,
+    // bit i of m_eligible is set if player i can win the pot
+    struct pot_layer_t
+    {
+        int32_t m_upper;
+        int32_t m_lower;
+        uint8_t m_eligible;
+    };
+
+    // main pot and all side pots without allocations, there is at most one pot per player
+    template <std::size_t N>
+    struct pot_layers_t
+    {
+        std::array<pot_layer_t, N> m_pots;
+        uint8_t m_size;
+
+        [[nodiscard]] constexpr std::span<const pot_layer_t> pots() const noexcept { return {m_pots.data(), m_size}; }
+    };
+
     // class representing a game state without cards
     // chips / stack size are in milli BBs, meaning 1000 equals 1 big blind
     // N: number of players, A: rake numerator, B: rake denominator
@@ -152,6 +172,12 @@ namespace mkp
         gb_gamestate_t m_gamestate;
         // rake is only taken when a flop was dealt
         bool m_flop_dealt = false;
+        // bitmasks (bit i = player i) and highest bet, maintained by execute_action to avoid recounting
+        // alive: not OUT, allin: ALLIN, to act: INIT or ALIVE with less chips than the highest bet
+        uint8_t m_alive = c_all_players;
+        uint8_t m_allin = 0;
+        uint8_t m_to_act = c_all_players;
+        int32_t m_highest_bet = 1000;    // big blind
 
 #if !defined(NDEBUG)
         int m_debug_alive = num_alive();
@@ -159,6 +185,8 @@ namespace mkp
         int m_debug_future = num_future_actionable();
 #endif
 
+        // bitmask with all players
+        static constexpr uint8_t c_all_players = static_cast<uint8_t>((1u << N) - 1);
         // which player starts betting in the first betting round? heads up: BB(==BTN), otherwise: UTG
         static constexpr auto round0_first_player = N > 2 ? gb_pos_t::UTG : gb_pos_t::BB;
         // rake, rake multiplier (1.0 - rake) as float between 0..1
@@ -276,10 +304,7 @@ namespace mkp
         [[nodiscard]] constexpr auto minraise() const noexcept { return m_minraise; }
 
         // helper: highest bet
-        [[nodiscard]] constexpr int32_t current_highest_bet() const noexcept
-        {
-            return *std::max_element(m_chips_front.cbegin(), m_chips_front.cend());
-        }
+        [[nodiscard]] constexpr int32_t current_highest_bet() const noexcept { return m_highest_bet; }
 
         // helper: chips to call for current player
         [[nodiscard]] constexpr int32_t amount_to_call() const noexcept { return current_highest_bet() - m_chips_front[active_player()]; }
@@ -308,20 +333,7 @@ namespace mkp
                 throw std::runtime_error("all_pots(): game not in terminal state");
             }
 
-            // adjust, if chips have to be returned
-            const auto chips_front = [&]() {
-                //
-                if (const auto chips_return = chips_to_return(); chips_return.second == 0)
-                {
-                    return m_chips_front;
-                }
-                else
-                {
-                    auto chips_front = m_chips_front;
-                    chips_front[static_cast<unsigned>(chips_return.first)] -= chips_return.second;
-                    return chips_front;
-                }
-            }();
+            const auto chips_front = chips_front_adjusted();
 
             // 1) get all chip counts and sort by amount
             auto chips_and_players =
@@ -362,6 +374,52 @@ namespace mkp
             return pots;
         }
 
+        // same as all_pots(), but with eligible players as bitmask and without allocations
+        [[nodiscard]] constexpr pot_layers_t<N> pot_layers() const
+        {
+            if (!in_terminal_state())
+            {
+                throw std::runtime_error("pot_layers(): game not in terminal state");
+            }
+
+            const auto chips_front = chips_front_adjusted();
+
+            // sort players by chip count, descending (insertion sort, N is tiny)
+            auto order = make_array<uint8_t, N>([](const uint8_t pos) { return pos; });
+            for (uint8_t i = 1; i < N; ++i)
+            {
+                for (uint8_t j = i; j > 0 && chips_front[order[j - 1]] < chips_front[order[j]]; --j)
+                {
+                    std::swap(order[j - 1], order[j]);
+                }
+            }
+
+            // step through the chip counts, every all in player with less chips opens a new side pot
+            pot_layers_t<N> ret{};
+            int32_t upper = chips_front[order[0]];
+            uint8_t eligible = 0;
+            for (const uint8_t pos : order)
+            {
+                if (m_playerstate[pos] == gb_playerstate_t::OUT)
+                {
+                    // skip players that can not win the pot
+                }
+                else if (const int32_t lower = chips_front[pos]; lower == upper)
+                {
+                    eligible |= static_cast<uint8_t>(1u << pos);
+                }
+                else if (m_playerstate[pos] == gb_playerstate_t::ALLIN)
+                {
+                    ret.m_pots[ret.m_size++] = pot_layer_t{upper, lower, eligible};
+                    upper = lower;
+                    eligible |= static_cast<uint8_t>(1u << pos);
+                }
+            }
+            ret.m_pots[ret.m_size++] = pot_layer_t{upper, 0, eligible};
+
+            return ret;
+        }
+
         // remove unnecessary chips from chips_front if the last call/fold left a player with an unmatched bet
         [[nodiscard]] constexpr std::pair<gb_pos_t, int32_t> chips_to_return() const
         {
@@ -397,11 +455,10 @@ namespace mkp
                 throw std::runtime_error("payouts_showdown(): terminale state involves no showdown, but cards are given");
             }
 
-            const auto pots = all_pots();
-            // return pot_redistribution for each (side)pot, add everything up
-            return std::accumulate(pots.cbegin(), pots.cend(), std::array<int32_t, N>{}, [&](auto val, const auto& e) {
-                return val + side_pot_distribution(cards, std::get<0>(e), std::get<1>(e), std::get<2>(e));
-            });
+            // add up the distribution of each (side) pot
+            std::array<int32_t, N> ret{};
+            resolve_pots(cards, [&](const unsigned pos, const int32_t /*invested*/, const int32_t won) { ret[pos] += won; });
+            return ret;
         }
 
         // return payout on terminal state (only for states with showdown)
@@ -417,11 +474,10 @@ namespace mkp
                 throw std::runtime_error("payouts_showdown(): terminale state involves no showdown, but cards are given");
             }
 
-            const auto pots = all_pots();
-            // return chips redistribution for each (side) pot, add everything up
-            return std::accumulate(pots.cbegin(), pots.cend(), std::array<int32_t, N>{}, [&](auto val, const auto& e) {
-                return val + side_pot_chips_redistribution(cards, std::get<0>(e), std::get<1>(e), std::get<2>(e));
-            });
+            // add up the chips redistribution of each (side) pot
+            std::array<int32_t, N> ret{};
+            resolve_pots(cards, [&](const unsigned pos, const int32_t invested, const int32_t won) { ret[pos] += won - invested; });
+            return ret;
         }
 
         // return payout on terminal state (only for states with no showdown required)
@@ -575,12 +631,15 @@ namespace mkp
             }
 #endif
 
-            // adjust chips and player state if necessary
+            // adjust chips, player state and bitmasks if necessary
             const uint8_t pos = static_cast<uint8_t>(pa.m_pos);
+            const uint8_t pos_bit = static_cast<uint8_t>(1u << pos);
+            m_to_act &= static_cast<uint8_t>(~pos_bit);
             switch (pa.m_action)
             {
                 case gb_action_t::FOLD:
                     m_playerstate[pos] = gb_playerstate_t::OUT;
+                    m_alive &= static_cast<uint8_t>(~pos_bit);
                     break;
                 case gb_action_t::CHECK:
                     m_playerstate[pos] = gb_playerstate_t::ALIVE;
@@ -594,7 +653,21 @@ namespace mkp
                     }
                     m_chips_behind[pos] -= pa.m_amount;
                     m_chips_front[pos] += pa.m_amount;
-                    m_playerstate[pos] = m_chips_behind[pos] == 0 ? gb_playerstate_t::ALLIN : gb_playerstate_t::ALIVE;
+                    if (m_chips_behind[pos] == 0)
+                    {
+                        m_playerstate[pos] = gb_playerstate_t::ALLIN;
+                        m_allin |= pos_bit;
+                    }
+                    else
+                    {
+                        m_playerstate[pos] = gb_playerstate_t::ALIVE;
+                    }
+                    // a bet/raise: every other player who can still act has less chips now
+                    if (m_chips_front[pos] > m_highest_bet)
+                    {
+                        m_highest_bet = m_chips_front[pos];
+                        m_to_act = static_cast<uint8_t>(m_alive & ~m_allin & ~pos_bit);
+                    }
                     break;
             }
 
@@ -609,23 +682,16 @@ namespace mkp
                 // the entire hand ended
 
                 // check if a flop would be dealt / there is a showdown, for, e.g., all in preflop
-                if (!m_flop_dealt)
+                if (!m_flop_dealt && m_allin != 0)
                 {
-                    if (std::find(m_playerstate.cbegin(), m_playerstate.cend(), gb_playerstate_t::ALLIN) != m_playerstate.cend())
-                    {
-                        m_flop_dealt = true;
-                    }
+                    m_flop_dealt = true;
                 }
 
                 m_gamestate = gb_gamestate_t::GAME_FIN;
             }
             // if there is only one player left to act and this player has the highest bet, the entire hand also ended
-            else if (const auto pos_last_player = std::distance(
-                         m_playerstate.cbegin(), std::find_if(m_playerstate.cbegin(), m_playerstate.cend(),
-                                                              [](const gb_playerstate_t elem) {
-                                                                  return elem != gb_playerstate_t::OUT && elem != gb_playerstate_t::ALLIN;
-                                                              }));
-                     num_actionable() == 1 && num_future_actionable() == 1 && m_chips_front[pos_last_player] == current_highest_bet())
+            else if (num_act == 1 && num_future_actionable() == 1 &&
+                     m_chips_front[std::countr_zero(static_cast<uint8_t>(m_alive & ~m_allin))] == current_highest_bet())
             {
                 // there are at least 2 players alive (otherwise the 1st if branch would be true) and the
                 // entire hand ended -> there must be a showdown, so there will be a flop dealt
@@ -659,6 +725,7 @@ namespace mkp
                     }
                     std::transform(m_playerstate.begin(), m_playerstate.end(), m_playerstate.begin(),
                                    [](const gb_playerstate_t st) { return st == gb_playerstate_t::ALIVE ? gb_playerstate_t::INIT : st; });
+                    m_to_act = static_cast<uint8_t>(m_alive & ~m_allin);
                 }
             }
             else
@@ -694,106 +761,72 @@ namespace mkp
 
        protected:
         // players alive (i.e. not OUT)
-        [[nodiscard]] constexpr int num_alive() const noexcept
-        {
-            return std::accumulate(m_playerstate.cbegin(), m_playerstate.cend(), 0, [](const int val, const gb_playerstate_t elem) -> int {
-                return elem != gb_playerstate_t::OUT ? val + 1 : val;
-            });
-        }
+        [[nodiscard]] constexpr int num_alive() const noexcept { return std::popcount(m_alive); }
 
         // players who can act (i.e. INIT or ALIVE && able to call/bet)
-        [[nodiscard]] constexpr int num_actionable() const noexcept
-        {
-            constexpr auto indices = make_array<unsigned, N>(identity{});
-            return std::accumulate(indices.cbegin(), indices.cend(), 0, [&](const int val, const unsigned pos) -> int {
-                return (m_playerstate[pos] == gb_playerstate_t::INIT ||
-                        (m_playerstate[pos] == gb_playerstate_t::ALIVE && m_chips_front[pos] < current_highest_bet()))
-                           ? val + 1
-                           : val;
-            });
-        }
+        [[nodiscard]] constexpr int num_actionable() const noexcept { return std::popcount(m_to_act); }
 
         // players who can act in the next betting round (i.e. not OUT or ALLIN)
         [[nodiscard]] constexpr int num_future_actionable() const noexcept
         {
-            return std::accumulate(m_playerstate.cbegin(), m_playerstate.cend(), 0, [](const int val, const gb_playerstate_t elem) -> int {
-                return elem != gb_playerstate_t::OUT && elem != gb_playerstate_t::ALLIN ? val + 1 : val;
-            });
+            return std::popcount(static_cast<uint8_t>(m_alive & ~m_allin));
         }
 
-        // helper: return winners for given side pot and cards
-        [[nodiscard]] auto side_pot_winners(const gamecards<N>& cards, const std::vector<unsigned>& eligible_player_indices) const
-            -> std::vector<std::pair<holdem_result, unsigned>>
+        // helper: chips in front of each player, adjusted if chips have to be returned
+        [[nodiscard]] constexpr std::array<int32_t, N> chips_front_adjusted() const
         {
-            std::vector<std::pair<holdem_result, unsigned>> winners;
-
-            // 1a) start with all possible winners
-            std::for_each(eligible_player_indices.cbegin(), eligible_player_indices.cend(), [&](const unsigned pos) {
-                winners.emplace_back(evaluate_unsafe(cardset(cards.m_board).combine(cards.m_hands[pos].as_cardset())), pos);
-            });
-            // 1b) sort by highest hand
-            std::sort(winners.begin(), winners.end(), [&](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
-            const auto first_non_winner =
-                std::find_if(winners.cbegin() + 1, winners.cend(), [&](const auto& e) { return e.first < winners[0].first; });
-            const auto dist = std::distance(winners.cbegin(), first_non_winner);
-            // 1c) remove non_winners
-            // since there is no default ctor for holdem_result, we have to pass a dummy value to resize
-            winners.resize(dist, std::make_pair(holdem_result(0, 0, 0, 0), 0));
-
-            return winners;
+            auto ret = m_chips_front;
+            if (const auto chips_return = chips_to_return(); chips_return.second != 0)
+            {
+                ret[static_cast<unsigned>(chips_return.first)] -= chips_return.second;
+            }
+            return ret;
         }
 
-        // helper: relevant chips for that (side) pot
-        [[nodiscard]] auto side_pot_chips_adjusted(const int32_t upper_bound, const int32_t lower_bound) const noexcept
-            -> std::array<int32_t, N>
+        // helper: resolve all (side) pots, every hand at showdown is evaluated only once
+        // calls f(pos, chips invested in the pot, chips won from the pot) for every player and pot
+        template <typename F>
+        constexpr void resolve_pots(const gamecards<N>& cards, F&& f) const
         {
-            return make_array<int32_t, N>([&](const unsigned pos) {
-                const int32_t chips = m_chips_front[pos];
-                return chips <= lower_bound ? 0 : chips > upper_bound ? upper_bound - lower_bound : chips - lower_bound;
+            const auto layers = pot_layers();
+            const cardset board(cards.m_board);
+            const auto results = make_array<holdem_result, N>([&](const unsigned pos) {
+                return m_playerstate[pos] != gb_playerstate_t::OUT ? evaluate_unsafe(board.combine(cards.m_hands[pos].as_cardset()))
+                                                                   : holdem_result(0, 0, 0, 0);
             });
-        }
 
-        // helper: returns how many chips each player wins/loses with that pot, accounts for how many chips
-        // each player invested during this hand, i.e., if the total pot is 10'000, there is one winner,
-        // and the winner invested 4'000 chips in this pot, the output will be +6'000 for the winner
-        // (and minus X for every other player that contributed X chips to that pot)
-        // that means that the sum of all redistribution values will amount to zero (if no rake)
-        [[nodiscard]] auto side_pot_chips_redistribution(const gamecards<N>& cards, const std::vector<unsigned>& eligible_player_indices,
-                                                         const int32_t upper_bound, const int32_t lower_bound) const
-            -> std::array<int32_t, N>
-        {
-            const auto winners = side_pot_winners(cards, eligible_player_indices);
-            const auto chips_adjusted = side_pot_chips_adjusted(upper_bound, lower_bound);
-            // adjust for rake
-            const int32_t total_pot = static_cast<int32_t>(std::accumulate(chips_adjusted.cbegin(), chips_adjusted.cend(), 0) *
-                                                           (m_flop_dealt ? c_rake_multi : 1.0f));
-            const int32_t amount_each_winner = total_pot / static_cast<int32_t>(winners.size());
-
-            // return payouts for every position
-            return make_array<int32_t, N>([&](const unsigned pos) {
-                return std::find_if(winners.cbegin(), winners.cend(), [&](const auto& e) { return e.second == pos; }) != winners.cend()
-                           ? -chips_adjusted[pos] + amount_each_winner    // winner
-                           : -chips_adjusted[pos];                        // loser or not involved (will return 0 for 2nd case)
-            });
-        }
+            for (auto&& pot : layers.pots())
+            {
+                // winners: eligible players with the best hand
+                uint8_t winners = 0;
+                for (uint8_t mask = pot.m_eligible; mask != 0; mask &= static_cast<uint8_t>(mask - 1))
+                {
+                    const auto pos = std::countr_zero(mask);
+                    if (winners == 0 || results[pos] > results[std::countr_zero(winners)])
+                    {
+                        winners = static_cast<uint8_t>(1u << pos);
+                    }
+                    else if (results[pos] == results[std::countr_zero(winners)])
+                    {
+                        winners |= static_cast<uint8_t>(1u << pos);
+                    }
+                }
 
-        // helper: similar to side_pot_chips_redistribution, but returns how the chips from the pot are distributed between players
-        [[nodiscard]] auto side_pot_distribution(const gamecards<N>& cards, const std::vector<unsigned>& eligible_player_indices,
-                                                 const int32_t upper_bound, const int32_t lower_bound) const -> std::array<int32_t, N>
-        {
-            const auto winners = side_pot_winners(cards, eligible_player_indices);
-            const auto chips_adjusted = side_pot_chips_adjusted(upper_bound, lower_bound);
-            // adjust for rake
-            const int32_t total_pot = static_cast<int32_t>(std::accumulate(chips_adjusted.cbegin(), chips_adjusted.cend(), 0) *
-                                                           (m_flop_dealt ? c_rake_multi : 1.0f));
-            const int32_t amount_each_winner = total_pot / static_cast<int32_t>(winners.size());
-
-            // return distribution of that (side) pot to all winners
-            return make_array<int32_t, N>([&](const unsigned pos) {
-                return std::find_if(winners.cbegin(), winners.cend(), [&](const auto& e) { return e.second == pos; }) != winners.cend()
-                           ? amount_each_winner
-                           : 0;
-            });
+                // relevant chips for that pot
+                const auto chips_adjusted = make_array<int32_t, N>([&](const unsigned pos) {
+                    const int32_t chips = m_chips_front[pos];
+                    return chips <= pot.m_lower ? 0 : chips > pot.m_upper ? pot.m_upper - pot.m_lower : chips - pot.m_lower;
+                });
+                // adjust for rake
+                const int32_t total_pot = static_cast<int32_t>(std::accumulate(chips_adjusted.cbegin(), chips_adjusted.cend(), 0) *
+                                                               (m_flop_dealt ? c_rake_multi : 1.0f));
+                const int32_t amount_each_winner = total_pot / std::popcount(winners);
+
+                for (uint8_t pos = 0; pos < N; ++pos)
+                {
+                    f(pos, chips_adjusted[pos], (winners >> pos) & 1 ? amount_each_winner : 0);
+                }
+            }
         }
     };
 
@@ -21,15 +21,18 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <mkpoker/game/game.hpp>
 #include <mkpoker/util/utility.hpp>
 
-#include <array>        //
-#include <cassert>      //
-#include <chrono>       // zoned_time, system_clock::now
-#include <stdexcept>    // std::runtime_error
-#include <string>       //
-#include <utility>      // std::pair, std::get
-#include <vector>       //
-
-#include <fmt/core.h>    // std::FILE included by fmt
+#include <array>          //
+#include <cassert>        //
+#include <chrono>         // zoned_time, system_clock::now
+#include <iterator>       // std::back_inserter
+#include <stdexcept>      // std::runtime_error
+#include <string>         //
+#include <string_view>    //
+#include <utility>        // std::pair, std::get
+#include <vector>         //
+
+#include <fmt/core.h>      // std::FILE included by fmt
+#include <fmt/format.h>    // fmt::memory_buffer
 
 #ifdef _MSC_VER
 #include <format>          // std::format with zoned_time
@@ -73,19 +76,28 @@ namespace mkp
         const unsigned m_player_id;
         const unsigned m_bb_dollar_ratio;
         const uint64_t m_hand_id;
+        // output goes either directly to a file or into a (reusable) buffer
         std::FILE* m_f;
+        fmt::memory_buffer* m_buf;
         gb_gamestate_t m_last_state;
 
-       public:
-        ///////////////////////////////////////////////////////////////////////////////////////
-        // CTORS
-        ///////////////////////////////////////////////////////////////////////////////////////
-
-        // no invalid objects
-        hh_ps() = delete;
+        // formatted output to file or buffer
+        template <typename... Args>
+        void print(fmt::format_string<Args...> format, Args&&... args)
+        {
+            if (m_buf != nullptr)
+            {
+                fmt::format_to(std::back_inserter(*m_buf), format, std::forward<Args>(args)...);
+            }
+            else
+            {
+                fmt::print(m_f, format, std::forward<Args>(args)...);
+            }
+        }
 
-        hh_ps(const T<N, Ns...>& game, gamecards<N> cards, std::array<std::string, N>& names, std::FILE* f, const unsigned player_id,
-              const unsigned bb_dollar_ratio, const uint64_t hand_id)
+        // create with either file or buffer
+        hh_ps(const T<N, Ns...>& game, gamecards<N> cards, std::array<std::string, N>& names, std::FILE* f, fmt::memory_buffer* buf,
+              const unsigned player_id, const unsigned bb_dollar_ratio, const uint64_t hand_id)
             : m_game(game),
               m_cards(cards),
               m_names(names),
@@ -93,6 +105,7 @@ namespace mkp
               m_bb_dollar_ratio(bb_dollar_ratio),
               m_hand_id(hand_id),
               m_f(f),
+              m_buf(buf),
               m_last_state(m_game.gamestate_v())
         {
             assert(names.size() == N && "size of names must be equal to game size (number of players)");
@@ -104,32 +117,52 @@ namespace mkp
             assert(player_id >= 0 && player_id <= N && "player_id does not fit to game size (number of players)");
 
             // on init, print the base info we already know
-            fmt::print(f, "PokerStars Zoom Hand #{:012}:  Hold'em No Limit (${:.2f}/${:.2f}) - {} CET [{} ET]\n", m_hand_id,
-                       static_cast<float>(500) / m_bb_dollar_ratio, static_cast<float>(1000) / m_bb_dollar_ratio, m_timestamp_cet_str,
-                       m_timestamp_et_str);
-            fmt::print(f, "Table '{}' {}-max Seat #{} is the button\n", "Testing", N, c_pos_button);
+            print("PokerStars Zoom Hand #{:012}:  Hold'em No Limit (${:.2f}/${:.2f}) - {} CET [{} ET]\n", m_hand_id,
+                  static_cast<float>(500) / m_bb_dollar_ratio, static_cast<float>(1000) / m_bb_dollar_ratio, m_timestamp_cet_str,
+                  m_timestamp_et_str);
+            print("Table '{}' {}-max Seat #{} is the button\n", "Testing", N, c_pos_button);
 
             for (unsigned int i = 0; i < c_num_players; ++i)
             {
                 // native order
-                fmt::print(f, "Seat {}: {} (${:.2f} in chips)\n", i + 1, names[i],
-                           mbb_to_dollar(game.chips_front()[i] + game.chips_behind()[i]));
+                print("Seat {}: {} (${:.2f} in chips)\n", i + 1, names[i], mbb_to_dollar(game.chips_front()[i] + game.chips_behind()[i]));
             }
 
             // print blinds and hole cards of m_player_id
             if constexpr (c_num_players > 2)
             {
-                fmt::print(f, "{}: posts small blind ${:.2f}\n", names[0], mbb_to_dollar(game.chips_front()[0]));
-                fmt::print(f, "{}: posts big blind ${:.2f}\n", names[1], mbb_to_dollar(game.chips_front()[1]));
+                print("{}: posts small blind ${:.2f}\n", names[0], mbb_to_dollar(game.chips_front()[0]));
+                print("{}: posts big blind ${:.2f}\n", names[1], mbb_to_dollar(game.chips_front()[1]));
             }
             else
             {
-                fmt::print(f, "{}: posts small blind ${:.2f}\n", names[1], mbb_to_dollar(game.chips_front()[1]));
-                fmt::print(f, "{}: posts big blind ${:.2f}\n", names[0], mbb_to_dollar(game.chips_front()[0]));
+                print("{}: posts small blind ${:.2f}\n", names[1], mbb_to_dollar(game.chips_front()[1]));
+                print("{}: posts big blind ${:.2f}\n", names[0], mbb_to_dollar(game.chips_front()[0]));
             }
-            fmt::print(f, "*** HOLE CARDS ***\n");
-            fmt::print(f, "Dealt to {} [{} {}]\n", names[m_player_id], cards.m_hands[m_player_id].m_card1.str(),
-                       cards.m_hands[m_player_id].m_card2.str());
+            print("*** HOLE CARDS ***\n");
+            print("Dealt to {} [{}]\n", names[m_player_id], str_hand(cards.m_hands[m_player_id]));
+        }
+
+       public:
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // CTORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // no invalid objects
+        hh_ps() = delete;
+
+        // write directly to file
+        hh_ps(const T<N, Ns...>& game, gamecards<N> cards, std::array<std::string, N>& names, std::FILE* f, const unsigned player_id,
+              const unsigned bb_dollar_ratio, const uint64_t hand_id)
+            : hh_ps(game, cards, names, f, nullptr, player_id, bb_dollar_ratio, hand_id)
+        {
+        }
+
+        // append to buffer, e.g. a reusable per thread buffer that is flushed in large blocks (see hh_buffer)
+        hh_ps(const T<N, Ns...>& game, gamecards<N> cards, std::array<std::string, N>& names, fmt::memory_buffer& buf,
+              const unsigned player_id, const unsigned bb_dollar_ratio, const uint64_t hand_id)
+            : hh_ps(game, cards, names, nullptr, &buf, player_id, bb_dollar_ratio, hand_id)
+        {
         }
 
         ///////////////////////////////////////////////////////////////////////////////////////
@@ -141,17 +174,17 @@ namespace mkp
             switch (auto pos = static_cast<unsigned>(a.m_pos); a.m_action)
             {
                 case gb_action_t::FOLD:
-                    fmt::print(m_f, "{}: folds\n", m_names[pos]);
+                    print("{}: folds\n", m_names[pos]);
                     m_players_summary.push_back(
                         std::make_pair(pos, fmt::format("Seat {{}}: {}{} folded {}\n", m_names[pos], str_opt_pos(pos), str_gs_at())));
                     break;
 
                 case gb_action_t::CHECK:
-                    fmt::print(m_f, "{}: checks\n", m_names[pos]);
+                    print("{}: checks\n", m_names[pos]);
                     break;
 
                 case gb_action_t::CALL:
-                    fmt::print(m_f, "{}: calls ${:.2f}\n", m_names[pos], mbb_to_dollar(a.m_amount));
+                    print("{}: calls ${:.2f}\n", m_names[pos], mbb_to_dollar(a.m_amount));
                     break;
 
                 case gb_action_t::RAISE: {
@@ -160,7 +193,7 @@ namespace mkp
                                         : fmt::format("raises ${:.2f} to ${:.2f}",
                                                       mbb_to_dollar(a.m_amount + m_game.chips_front()[pos] - m_game.current_highest_bet()),
                                                       mbb_to_dollar(a.m_amount + m_game.chips_front()[pos]));
-                    fmt::print(m_f, "{}: {}\n", m_names[pos], str_temp);
+                    print("{}: {}\n", m_names[pos], str_temp);
 
                     break;
                 }
@@ -172,7 +205,7 @@ namespace mkp
                                         : fmt::format("raises ${:.2f} to ${:.2f}",
                                                       mbb_to_dollar(a.m_amount + m_game.chips_front()[pos] - m_game.current_highest_bet()),
                                                       mbb_to_dollar(a.m_amount + m_game.chips_front()[pos]));
-                    fmt::print(m_f, "{}: {} and is all-in\n", m_names[pos], str_temp);
+                    print("{}: {} and is all-in\n", m_names[pos], str_temp);
                     break;
                 }
 
@@ -187,7 +220,7 @@ namespace mkp
                 if (new_state != gb_gamestate_t::GAME_FIN)
                 {
                     m_last_state = new_state;
-                    fmt::print(m_f, "{}", str_ccs());
+                    print_ccs();
                 }
                 else
                 {
@@ -197,8 +230,8 @@ namespace mkp
                     const auto chips_return = m_game.chips_to_return();
                     if (chips_return.second != 0)
                     {
-                        fmt::print(m_f, "Uncalled bet (${:.2f}) returned to {}\n", mbb_to_dollar(chips_return.second),
-                                   m_names[static_cast<unsigned>(chips_return.first)]);
+                        print("Uncalled bet (${:.2f}) returned to {}\n", mbb_to_dollar(chips_return.second),
+                              m_names[static_cast<unsigned>(chips_return.first)]);
                     }
 
                     const auto adjusted_pot = m_game.pot_size_rake_adjusted();
@@ -211,16 +244,16 @@ namespace mkp
                         switch (m_last_state)
                         {
                             case gb_gamestate_t::PREFLOP_BET:
-                                fmt::print(m_f, "*** FLOP *** [{}]\n", str_board(m_cards.m_board, 3));
+                                print("*** FLOP *** [{}]\n", str_board(m_cards.m_board, 3));
                                 [[fallthrough]];
                             case gb_gamestate_t::FLOP_BET:
-                                fmt::print(m_f, "*** TURN *** [{}] [{}]\n", str_board(m_cards.m_board, 3), m_cards.m_board[3].str());
+                                print("*** TURN *** [{}] [{}]\n", str_board(m_cards.m_board, 3), m_cards.m_board[3].str());
                                 [[fallthrough]];
                             case gb_gamestate_t::TURN_BET:
-                                fmt::print(m_f, "*** RIVER *** [{}] [{}]\n", str_board(m_cards.m_board, 4), m_cards.m_board[4].str());
+                                print("*** RIVER *** [{}] [{}]\n", str_board(m_cards.m_board, 4), m_cards.m_board[4].str());
                                 break;
                         }
-                        fmt::print(m_f, "*** SHOW DOWN ***\n");
+                        print("*** SHOW DOWN ***\n");
 
                         // get all pots, the last pot is always the main pot
                         // get all players from the main pot and print the showdown info
@@ -231,7 +264,7 @@ namespace mkp
                         for (const auto& pos : vec_ids)
                         {
                             const auto eval = mkp::evaluate_unsafe(m_cards.board_n_as_cs(5).combine(m_cards.m_hands[pos].as_cardset()));
-                            fmt::print(m_f, "{}: shows [{}] ({})\n", m_names[pos], str_hand(m_cards.m_hands[pos]), eval.str());
+                            print("{}: shows [{}] ({})\n", m_names[pos], str_hand(m_cards.m_hands[pos]), eval.str());
                         }
 
                         const auto pot_dist = m_game.pot_distribution(m_cards);
@@ -241,12 +274,11 @@ namespace mkp
                         {
                             if (pot_dist[pos] > 0)
                             {
-                                fmt::print(m_f, "{} collected ${:.2f} from pot\n", m_names[pos], mbb_to_dollar(pot_dist[pos]));
+                                print("{} collected ${:.2f} from pot\n", m_names[pos], mbb_to_dollar(pot_dist[pos]));
                             }
                             else if (m_game.chips_behind()[pos] == 0)
                             {
-                                fmt::print(m_f, "{} cashed out the hand for ${:.2f}\n", m_names[pos],
-                                           mbb_to_dollar(m_game.chips_front()[pos]));
+                                print("{} cashed out the hand for ${:.2f}\n", m_names[pos], mbb_to_dollar(m_game.chips_front()[pos]));
                             }
                         }
 
@@ -281,25 +313,32 @@ namespace mkp
                             std::find_if(pstate.cbegin(), pstate.cend(), [](const auto& e) { return e != gb_playerstate_t::OUT; });
                         const auto pos = static_cast<unsigned>(std::distance(pstate.cbegin(), it_winner));
 
-                        fmt::print(m_f, "{} collected ${:.2f} from pot\n", m_names[pos], mbb_to_dollar(adjusted_pot));
-                        fmt::print(m_f, "{}: doesn't show hand\n", m_names[pos]);
+                        print("{} collected ${:.2f} from pot\n", m_names[pos], mbb_to_dollar(adjusted_pot));
+                        print("{}: doesn't show hand\n", m_names[pos]);
 
                         m_players_summary.push_back(std::make_pair(
                             pos, fmt::format("Seat {{}}: {} collected (${:.2f})\n", m_names[pos], mbb_to_dollar(adjusted_pot))));
                     }
 
-                    fmt::print(m_f, "*** SUMMARY ***\n");
-                    fmt::print(m_f, "Total pot ${:.2f} | Rake ${:.2f}\n", mbb_to_dollar(adjusted_pot), mbb_to_dollar(rake));
-                    fmt::print(m_f, "Board [{}]\n", str_board(m_cards.m_board, 5));
+                    print("*** SUMMARY ***\n");
+                    print("Total pot ${:.2f} | Rake ${:.2f}\n", mbb_to_dollar(adjusted_pot), mbb_to_dollar(rake));
+                    print("Board [{}]\n", str_board(m_cards.m_board, 5));
 
                     // sort the summaries
                     std::sort(m_players_summary.begin(), m_players_summary.end(),
                               [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
                     for (unsigned int i = 0; i < c_num_players; ++i)
                     {
-                        fmt::vprint(m_f, m_players_summary[i].second, fmt::make_format_args(i + 1));
+                        if (m_buf != nullptr)
+                        {
+                            fmt::vformat_to(std::back_inserter(*m_buf), m_players_summary[i].second, fmt::make_format_args(i + 1));
+                        }
+                        else
+                        {
+                            fmt::vprint(m_f, m_players_summary[i].second, fmt::make_format_args(i + 1));
+                        }
                     }
-                    fmt::print(m_f, "\n\n\n");
+                    print("\n\n\n");
                 }
             }
         }
@@ -315,21 +354,25 @@ namespace mkp
             return static_cast<float>(amount) / m_bb_dollar_ratio;
         }
 
-        // print hand pokerstars style
+        // print hand pokerstars style, fits into the small string buffer (no allocation)
         [[nodiscard]] MKP_CONSTEXPR_STD_STR std::string str_hand(const hand_2c h) const
         {
-            return fmt::format("{} {}", h.m_card1.str(), h.m_card2.str());
+            return h.m_card1.str().append(" ").append(h.m_card2.str());
         }
 
-        // print board pokerstars style
+        // print board pokerstars style, fits into the small string buffer (no allocation)
         [[nodiscard]] MKP_CONSTEXPR_STD_STR std::string str_board(const std::array<card, 5>& b, const unsigned n) const
         {
-            return fmt::format("{} {} {}{}{}", b[0].str(), b[1].str(), b[2].str(), n > 3 ? fmt::format(" {}", b[3].str()) : "",
-                               n > 4 ? fmt::format(" {}", b[4].str()) : "");
+            std::string ret = b[0].str();
+            for (unsigned i = 1; i < n; ++i)
+            {
+                ret.append(" ").append(b[i].str());
+            }
+            return ret;
         }
 
         // print SB, BB or BTN
-        [[nodiscard]] MKP_CONSTEXPR_STD_STR std::string str_opt_pos(unsigned i) const
+        [[nodiscard]] constexpr std::string_view str_opt_pos(unsigned i) const noexcept
         {
             switch (i)
             {
@@ -345,7 +388,7 @@ namespace mkp
         }
 
         // cashed out?
-        [[nodiscard]] MKP_CONSTEXPR_STD_STR std::string str_opt_cashout(unsigned i) const
+        [[nodiscard]] constexpr std::string_view str_opt_cashout(unsigned i) const noexcept
         {
             if (m_game.chips_behind()[i] == 0)
             {
@@ -422,21 +465,24 @@ namespace mkp
         }
 
         // community cards
-        [[nodiscard]] MKP_CONSTEXPR_STD_STR std::string str_ccs() const
+        void print_ccs()
         {
             switch (m_game.gamestate_v())
             {
                 case gb_gamestate_t::PREFLOP_BET:
                 case gb_gamestate_t::GAME_FIN:
-                    return {};
+                    return;
                 case gb_gamestate_t::FLOP_BET:
-                    return fmt::format("*** FLOP *** [{}]\n", str_board(m_cards.m_board, 3));
+                    print("*** FLOP *** [{}]\n", str_board(m_cards.m_board, 3));
+                    return;
                 case gb_gamestate_t::TURN_BET:
-                    return fmt::format("*** TURN *** [{}] [{}]\n", str_board(m_cards.m_board, 3), m_cards.m_board[3].str());
+                    print("*** TURN *** [{}] [{}]\n", str_board(m_cards.m_board, 3), m_cards.m_board[3].str());
+                    return;
                 case gb_gamestate_t::RIVER_BET:
-                    return fmt::format("*** RIVER *** [{}] [{}]\n", str_board(m_cards.m_board, 4), m_cards.m_board[4].str());
+                    print("*** RIVER *** [{}] [{}]\n", str_board(m_cards.m_board, 4), m_cards.m_board[4].str());
+                    return;
                 default:
-                    throw std::runtime_error("str_ccs(): invalid gb_gamestate_t");
+                    throw std::runtime_error("print_ccs(): invalid gb_gamestate_t");
             };
         }
     };
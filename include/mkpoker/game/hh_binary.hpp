@@ -0,0 +1,711 @@
+/*
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#pragma once
+
+#include <mkpoker/base/card.hpp>
+#include <mkpoker/game/game.hpp>
+#include <mkpoker/game/game_def.hpp>
+#include <mkpoker/game/hh_parser.hpp>
+#include <mkpoker/util/compression.hpp>
+#include <mkpoker/util/file.hpp>
+#include <mkpoker/util/mapped_file.hpp>
+#include <mkpoker/util/parallel.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace mkp
+{
+    // columns of the binary hand history format, every column of a block is compressed and can be decoded separately
+    // HANDS: hand id, number of players, number of actions, big blind
+    // NAMES: player names, STACKS: starting stacks, CARDS: known hole cards and board (6 bit card indices)
+    // ACTIONS: action, position and street of every action (one byte), AMOUNTS: amounts of calls, bets and raises
+    // PAYOUTS: rake and amounts collected from the pot
+    enum class hh_column_t : uint8_t
+    {
+        HANDS = 0,
+        NAMES,
+        STACKS,
+        CARDS,
+        ACTIONS,
+        AMOUNTS,
+        PAYOUTS
+    };
+
+    inline namespace constants
+    {
+        inline constexpr uint8_t c_hh_num_columns = 7;
+        inline constexpr uint8_t c_hh_all_columns = (1u << c_hh_num_columns) - 1;
+        inline constexpr uint32_t c_hh_default_block_size = 4096;
+    }    // namespace constants
+
+    [[nodiscard]] constexpr uint8_t hh_column_bit(const hh_column_t column) noexcept
+    {
+        return static_cast<uint8_t>(1u << static_cast<uint8_t>(column));
+    }
+
+    struct hh_binary_header_t
+    {
+        static constexpr std::array<char, 8> c_magic{'M', 'K', 'P', 'H', 'H', 'B', '\0', '\0'};
+        static constexpr uint32_t c_version = 1;
+
+        std::array<char, 8> m_magic = c_magic;
+        uint32_t m_version = c_version;
+        uint32_t m_hands_per_block = c_hh_default_block_size;
+
+        // throws if the header does not belong to a valid binary hand history file
+        void validate(const std::string& filename) const
+        {
+            if (m_magic != c_magic || m_version == 0 || m_version > c_version || m_hands_per_block == 0)
+            {
+                throw std::runtime_error("binary hand history file '" + filename + "': invalid magic or unsupported version");
+            }
+        }
+    };
+
+    struct hh_block_header_t
+    {
+        uint32_t m_num_hands;
+        uint32_t m_num_actions;
+        std::array<uint32_t, c_hh_num_columns> m_raw_sizes;
+        // a stored size equal to the raw size means the column is stored uncompressed
+        std::array<uint32_t, c_hh_num_columns> m_stored_sizes;
+    };
+
+    namespace detail
+    {
+        // one byte per action: action (3 bits), position (3 bits), street (2 bits)
+        [[nodiscard]] constexpr uint8_t hh_encode_action(const player_action_t& a, const gb_gamestate_t street) noexcept
+        {
+            return static_cast<uint8_t>(static_cast<uint8_t>(a.m_action) | (static_cast<uint8_t>(a.m_pos) << 3) |
+                                        (static_cast<uint8_t>(street) << 6));
+        }
+
+        [[nodiscard]] constexpr bool hh_has_amount(const gb_action_t action) noexcept
+        {
+            return action == gb_action_t::CALL || action == gb_action_t::RAISE || action == gb_action_t::ALLIN;
+        }
+
+        // the street (betting round) of every action, throws if the actions do not match the hand
+        inline void hh_streets(const hh_hand_t& hand, const std::span<const player_action_t> actions, std::vector<gb_gamestate_t>& streets)
+        {
+            streets.clear();
+            const auto f = [&](const auto& game, const player_action_t&) { streets.push_back(game.gamestate_v()); };
+            switch (hand.m_num_players)
+            {
+                case 2:
+                    static_cast<void>(hh_replay<2, 0, 1>(hand, actions, f));
+                    break;
+                case 3:
+                    static_cast<void>(hh_replay<3, 0, 1>(hand, actions, f));
+                    break;
+                case 4:
+                    static_cast<void>(hh_replay<4, 0, 1>(hand, actions, f));
+                    break;
+                case 5:
+                    static_cast<void>(hh_replay<5, 0, 1>(hand, actions, f));
+                    break;
+                case 6:
+                    static_cast<void>(hh_replay<6, 0, 1>(hand, actions, f));
+                    break;
+                default:
+                    throw std::runtime_error("hh_streets(hh_hand_t, span<player_action_t>): invalid number of players");
+            }
+        }
+    }    // namespace detail
+
+    // decoded block of a binary hand history file, the hands refer to the actions and names stored in the block
+    // only the requested columns are decoded, the other members of the hands are zero
+    class hh_block_t
+    {
+        friend class hh_binary_reader;
+
+        uint8_t m_columns = 0;
+        std::vector<hh_hand_t> m_hands;
+        std::vector<player_action_t> m_actions;
+        std::vector<gb_gamestate_t> m_streets;
+        // names are string_views into this buffer
+        std::vector<char> m_names;
+
+       public:
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // CTORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        hh_block_t() = default;
+
+        // copies would refer to the names of the original
+        hh_block_t(const hh_block_t&) = delete;
+        hh_block_t& operator=(const hh_block_t&) = delete;
+        hh_block_t(hh_block_t&&) noexcept = default;
+        hh_block_t& operator=(hh_block_t&&) noexcept = default;
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // ACCESSORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // bitmask of the decoded columns
+        [[nodiscard]] uint8_t columns() const noexcept { return m_columns; }
+
+        [[nodiscard]] const std::vector<hh_hand_t>& hands() const noexcept { return m_hands; }
+
+        [[nodiscard]] std::span<const player_action_t> actions(const hh_hand_t& hand) const noexcept
+        {
+            return {m_actions.data() + hand.m_actions_begin, hand.m_num_actions};
+        }
+
+        [[nodiscard]] std::span<const gb_gamestate_t> streets(const hh_hand_t& hand) const noexcept
+        {
+            return {m_streets.data() + hand.m_actions_begin, hand.m_num_actions};
+        }
+
+        // all actions and streets of the block
+        [[nodiscard]] const std::vector<player_action_t>& all_actions() const noexcept { return m_actions; }
+
+        [[nodiscard]] const std::vector<gb_gamestate_t>& all_streets() const noexcept { return m_streets; }
+    };
+
+    // writes hands in blocks with columnar layout, the file ends with the offsets of all blocks
+    class hh_binary_writer
+    {
+        detail::unique_file_t m_file;
+        uint64_t m_offset = 0;
+        std::vector<uint64_t> m_block_offsets;
+        const uint32_t m_hands_per_block;
+        uint32_t m_num_hands = 0;
+        uint32_t m_num_actions = 0;
+        uint64_t m_last_id = 0;
+        uint64_t m_total_hands = 0;
+        std::array<std::vector<uint8_t>, c_hh_num_columns> m_columns;
+        // card indices are bit packed and appended to the cards column when the block is written
+        std::vector<uint8_t> m_card_indices;
+        std::vector<uint8_t> m_cards;
+        std::vector<gb_gamestate_t> m_streets;
+        // header and (compressed) columns of the block, written at once
+        std::vector<uint8_t> m_block;
+
+        [[nodiscard]] std::vector<uint8_t>& column(const hh_column_t c) noexcept { return m_columns[static_cast<uint8_t>(c)]; }
+
+        void write(const void* data, const std::size_t size)
+        {
+            if (size == 0)
+            {
+                return;
+            }
+            detail::write_binary(m_file.get(), static_cast<const uint8_t*>(data), size);
+            m_offset += size;
+        }
+
+        // the state only changes after the block has been written, a failed write leaves the block in place
+        void write_block()
+        {
+            if (m_num_hands == 0)
+            {
+                return;
+            }
+
+            m_cards.assign(column(hh_column_t::CARDS).cbegin(), column(hh_column_t::CARDS).cend());
+            bit_writer card_writer(m_cards);
+            for (auto&& c : m_card_indices)
+            {
+                card_writer.write(c, 6);
+            }
+            card_writer.flush();
+
+            hh_block_header_t header{};
+            header.m_num_hands = m_num_hands;
+            header.m_num_actions = m_num_actions;
+            m_block.resize(sizeof(header));
+            for (uint8_t i = 0; i < c_hh_num_columns; ++i)
+            {
+                const auto& raw = i == static_cast<uint8_t>(hh_column_t::CARDS) ? m_cards : m_columns[i];
+                const std::size_t offset = m_block.size();
+                header.m_raw_sizes[i] = static_cast<uint32_t>(raw.size());
+                header.m_stored_sizes[i] = static_cast<uint32_t>(lz_compress(raw, m_block));
+                if (header.m_stored_sizes[i] >= header.m_raw_sizes[i])
+                {
+                    // incompressible
+                    m_block.resize(offset);
+                    m_block.insert(m_block.end(), raw.cbegin(), raw.cend());
+                    header.m_stored_sizes[i] = header.m_raw_sizes[i];
+                }
+            }
+            std::memcpy(m_block.data(), &header, sizeof(header));
+
+            const uint64_t offset = m_offset;
+            write(m_block.data(), m_block.size());
+            m_block_offsets.push_back(offset);
+
+            // hand ids are delta encoded within a block
+            for (auto&& c : m_columns)
+            {
+                c.clear();
+            }
+            m_card_indices.clear();
+            m_last_id = 0;
+            m_num_hands = 0;
+            m_num_actions = 0;
+        }
+
+       public:
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // CTORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        explicit hh_binary_writer(const std::string& filename, const uint32_t hands_per_block = c_hh_default_block_size)
+            : m_file(detail::open_file(filename, "wb")), m_hands_per_block(hands_per_block)
+        {
+            if (hands_per_block == 0)
+            {
+                throw std::runtime_error("hh_binary_writer(const string&, uint32_t): block size is zero");
+            }
+            hh_binary_header_t header{};
+            header.m_hands_per_block = hands_per_block;
+            write(&header, sizeof(header));
+        }
+
+        hh_binary_writer(const hh_binary_writer&) = delete;
+        hh_binary_writer& operator=(const hh_binary_writer&) = delete;
+
+        // the file is only complete after close(), which is called here if necessary
+        ~hh_binary_writer()
+        {
+            try
+            {
+                close();
+            }
+            catch (...)
+            {
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // ACCESSORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // number of hands added so far
+        [[nodiscard]] uint64_t num_hands() const noexcept { return m_total_hands; }
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // MUTATORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // adds a hand, the actions are replayed to determine the streets, throws if they do not match the hand
+        void add(const hh_hand_t& hand, const std::span<const player_action_t> actions)
+        {
+            detail::hh_streets(hand, actions, m_streets);
+            add(hand, actions, m_streets);
+        }
+
+        // adds a hand with the streets of its actions (see detail::hh_streets), throws if the block can not be written
+        void add(const hh_hand_t& hand, const std::span<const player_action_t> actions, const std::span<const gb_gamestate_t> streets)
+        {
+            if (!m_file)
+            {
+                throw std::runtime_error("hh_binary_writer::add(hh_hand_t, span<player_action_t>, span<gb_gamestate_t>): writer is closed");
+            }
+            if (streets.size() != actions.size())
+            {
+                throw std::runtime_error(
+                    "hh_binary_writer::add(hh_hand_t, span<player_action_t>, span<gb_gamestate_t>): number of streets and actions differ");
+            }
+
+            auto& hands = column(hh_column_t::HANDS);
+            varint_encode(hands, zigzag_encode(static_cast<int64_t>(hand.m_hand_id - m_last_id)));
+            hands.push_back(hand.m_num_players);
+            varint_encode(hands, actions.size());
+            varint_encode(hands, static_cast<uint64_t>(hand.m_big_blind));
+            m_last_id = hand.m_hand_id;
+
+            auto& names = column(hh_column_t::NAMES);
+            auto& stacks = column(hh_column_t::STACKS);
+            auto& payouts = column(hh_column_t::PAYOUTS);
+            varint_encode(payouts, static_cast<uint64_t>(hand.m_rake));
+            for (uint8_t pos = 0; pos < hand.m_num_players; ++pos)
+            {
+                varint_encode(names, hand.m_names[pos].size());
+                names.insert(names.end(), hand.m_names[pos].cbegin(), hand.m_names[pos].cend());
+                varint_encode(stacks, static_cast<uint64_t>(hand.m_stacks[pos]));
+                varint_encode(payouts, static_cast<uint64_t>(hand.m_collected[pos]));
+            }
+
+            varint_encode(column(hh_column_t::CARDS), hand.m_known_hands | (hand.m_num_board_cards << 6));
+            for (uint8_t i = 0; i < hand.m_num_board_cards; ++i)
+            {
+                m_card_indices.push_back(hand.m_board[i]);
+            }
+            for (uint8_t pos = 0; pos < hand.m_num_players; ++pos)
+            {
+                if (hand.hand_known(pos))
+                {
+                    m_card_indices.push_back(hand.m_hole_cards[pos][0]);
+                    m_card_indices.push_back(hand.m_hole_cards[pos][1]);
+                }
+            }
+
+            auto& codes = column(hh_column_t::ACTIONS);
+            auto& amounts = column(hh_column_t::AMOUNTS);
+            for (std::size_t i = 0; i < actions.size(); ++i)
+            {
+                codes.push_back(detail::hh_encode_action(actions[i], streets[i]));
+                if (detail::hh_has_amount(actions[i].m_action))
+                {
+                    varint_encode(amounts, static_cast<uint64_t>(actions[i].m_amount));
+                }
+            }
+
+            m_num_actions += static_cast<uint32_t>(actions.size());
+            ++m_total_hands;
+            // a block which could not be written is retried with the next hand
+            if (++m_num_hands >= m_hands_per_block)
+            {
+                write_block();
+            }
+        }
+
+        // writes the last block and the block index, closes the file
+        void close()
+        {
+            if (!m_file)
+            {
+                return;
+            }
+            write_block();
+            const uint64_t num_blocks = m_block_offsets.size();
+            write(m_block_offsets.data(), m_block_offsets.size() * sizeof(uint64_t));
+            write(&num_blocks, sizeof(num_blocks));
+            write(hh_binary_header_t::c_magic.data(), hh_binary_header_t::c_magic.size());
+            // buffered data is written by fclose
+            if (std::fclose(m_file.release()) != 0)
+            {
+                throw std::runtime_error("hh_binary_writer::close(): could not write file");
+            }
+        }
+    };
+
+    // memory-mapped binary hand history file, blocks can be decoded independently (and concurrently)
+    class hh_binary_reader
+    {
+        mapped_file m_file;
+        hh_binary_header_t m_header;
+        std::vector<uint64_t> m_block_offsets;
+        uint64_t m_num_hands = 0;
+
+        [[nodiscard]] hh_block_header_t block_header(const std::size_t idx) const
+        {
+            hh_block_header_t ret;
+            std::memcpy(&ret, m_file.data() + m_block_offsets[idx], sizeof(ret));
+            return ret;
+        }
+
+       public:
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // CTORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        explicit hh_binary_reader(const std::string& filename) : m_file(filename, mapped_file_advice_t::SEQUENTIAL)
+        {
+            constexpr std::size_t c_footer_size = sizeof(uint64_t) + hh_binary_header_t::c_magic.size();
+            const auto size = m_file.size();
+            if (size < sizeof(hh_binary_header_t) + c_footer_size)
+            {
+                throw std::runtime_error("binary hand history file '" + filename + "': file too small");
+            }
+            std::memcpy(&m_header, m_file.data(), sizeof(m_header));
+            m_header.validate(filename);
+
+            std::array<char, 8> magic{};
+            uint64_t num_blocks = 0;
+            std::memcpy(magic.data(), m_file.data() + size - magic.size(), magic.size());
+            std::memcpy(&num_blocks, m_file.data() + size - c_footer_size, sizeof(num_blocks));
+            if (magic != hh_binary_header_t::c_magic || num_blocks > (size - sizeof(hh_binary_header_t) - c_footer_size) / sizeof(uint64_t))
+            {
+                throw std::runtime_error("binary hand history file '" + filename + "': file is truncated or was not closed");
+            }
+            const auto index_offset = size - c_footer_size - num_blocks * sizeof(uint64_t);
+            m_block_offsets.resize(num_blocks);
+            if (num_blocks > 0)
+            {
+                std::memcpy(m_block_offsets.data(), m_file.data() + index_offset, num_blocks * sizeof(uint64_t));
+            }
+
+            for (std::size_t i = 0; i < num_blocks; ++i)
+            {
+                if (m_block_offsets[i] < sizeof(hh_binary_header_t) || m_block_offsets[i] + sizeof(hh_block_header_t) > index_offset)
+                {
+                    throw std::runtime_error("binary hand history file '" + filename + "': invalid block offset");
+                }
+                const auto header = block_header(i);
+                const auto end = m_block_offsets[i] + sizeof(hh_block_header_t) +
+                                 std::accumulate(header.m_stored_sizes.cbegin(), header.m_stored_sizes.cend(), uint64_t(0));
+                if (end > index_offset)
+                {
+                    throw std::runtime_error("binary hand history file '" + filename + "': invalid block size");
+                }
+                m_num_hands += header.m_num_hands;
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // ACCESSORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] const hh_binary_header_t& header() const noexcept { return m_header; }
+
+        [[nodiscard]] std::size_t num_blocks() const noexcept { return m_block_offsets.size(); }
+
+        [[nodiscard]] uint64_t num_hands() const noexcept { return m_num_hands; }
+
+        [[nodiscard]] std::size_t size() const noexcept { return m_file.size(); }
+
+        // decodes the given columns (bitmask of hh_column_bit) of a block, HANDS is always decoded and AMOUNTS implies ACTIONS
+        [[nodiscard]] hh_block_t read_block(const std::size_t idx, uint8_t columns = c_hh_all_columns) const
+        {
+            if (idx >= num_blocks())
+            {
+                throw std::runtime_error("hh_binary_reader::read_block(size_t, uint8_t): block index out of range");
+            }
+            columns |= hh_column_bit(hh_column_t::HANDS);
+            if (columns & hh_column_bit(hh_column_t::AMOUNTS))
+            {
+                columns |= hh_column_bit(hh_column_t::ACTIONS);
+            }
+
+            const auto header = block_header(idx);
+            std::array<std::vector<uint8_t>, c_hh_num_columns> data;
+            const std::byte* ptr = m_file.data() + m_block_offsets[idx] + sizeof(hh_block_header_t);
+            for (uint8_t i = 0; i < c_hh_num_columns; ++i)
+            {
+                if ((columns >> i) & 1)
+                {
+                    const std::span<const uint8_t> stored(reinterpret_cast<const uint8_t*>(ptr), header.m_stored_sizes[i]);
+                    if (header.m_stored_sizes[i] == header.m_raw_sizes[i])
+                    {
+                        data[i].assign(stored.begin(), stored.end());
+                    }
+                    else
+                    {
+                        data[i].resize(header.m_raw_sizes[i]);
+                        lz_decompress(stored, data[i]);
+                    }
+                }
+                ptr += header.m_stored_sizes[i];
+            }
+            const auto column = [&](const hh_column_t c) -> const std::vector<uint8_t>& { return data[static_cast<uint8_t>(c)]; };
+            const auto has_column = [&](const hh_column_t c) { return (columns & hh_column_bit(c)) != 0; };
+            const auto read_varint = [](const std::vector<uint8_t>& v, std::size_t& pos) { return varint_decode(v, pos); };
+
+            hh_block_t ret;
+            ret.m_columns = columns;
+            ret.m_hands.resize(header.m_num_hands);
+
+            // hands
+            {
+                std::size_t pos = 0;
+                uint64_t id = 0;
+                uint32_t num_actions = 0;
+                const auto& v = column(hh_column_t::HANDS);
+                for (auto&& hand : ret.m_hands)
+                {
+                    id += static_cast<uint64_t>(zigzag_decode(read_varint(v, pos)));
+                    hand.m_hand_id = id;
+                    if (pos == v.size() || v[pos] < 2 || v[pos] > c_hh_max_players)
+                    {
+                        throw std::runtime_error("hh_binary_reader::read_block(size_t, uint8_t): invalid number of players");
+                    }
+                    hand.m_num_players = v[pos++];
+                    hand.m_actions_begin = num_actions;
+                    hand.m_num_actions = static_cast<uint32_t>(read_varint(v, pos));
+                    hand.m_big_blind = static_cast<int64_t>(read_varint(v, pos));
+                    num_actions += hand.m_num_actions;
+                }
+                if (num_actions != header.m_num_actions)
+                {
+                    throw std::runtime_error("hh_binary_reader::read_block(size_t, uint8_t): invalid number of actions");
+                }
+            }
+
+            if (has_column(hh_column_t::NAMES))
+            {
+                const auto& v = column(hh_column_t::NAMES);
+                ret.m_names.assign(v.cbegin(), v.cend());
+                std::size_t pos = 0;
+                for (auto&& hand : ret.m_hands)
+                {
+                    for (uint8_t p = 0; p < hand.m_num_players; ++p)
+                    {
+                        const auto len = read_varint(v, pos);
+                        if (len > v.size() - pos)
+                        {
+                            throw std::runtime_error("hh_binary_reader::read_block(size_t, uint8_t): invalid name");
+                        }
+                        hand.m_names[p] = std::string_view(ret.m_names.data() + pos, len);
+                        pos += len;
+                    }
+                }
+            }
+
+            if (has_column(hh_column_t::STACKS))
+            {
+                std::size_t pos = 0;
+                for (auto&& hand : ret.m_hands)
+                {
+                    for (uint8_t p = 0; p < hand.m_num_players; ++p)
+                    {
+                        hand.m_stacks[p] = static_cast<int32_t>(read_varint(column(hh_column_t::STACKS), pos));
+                    }
+                }
+            }
+
+            if (has_column(hh_column_t::PAYOUTS))
+            {
+                std::size_t pos = 0;
+                for (auto&& hand : ret.m_hands)
+                {
+                    hand.m_rake = static_cast<int32_t>(read_varint(column(hh_column_t::PAYOUTS), pos));
+                    for (uint8_t p = 0; p < hand.m_num_players; ++p)
+                    {
+                        hand.m_collected[p] = static_cast<int32_t>(read_varint(column(hh_column_t::PAYOUTS), pos));
+                    }
+                }
+            }
+
+            if (has_column(hh_column_t::CARDS))
+            {
+                const auto& v = column(hh_column_t::CARDS);
+                std::size_t pos = 0;
+                for (auto&& hand : ret.m_hands)
+                {
+                    const auto bits = read_varint(v, pos);
+                    hand.m_known_hands = static_cast<uint8_t>(bits & 63);
+                    hand.m_num_board_cards = static_cast<uint8_t>(bits >> 6);
+                    if (hand.m_num_board_cards > c_num_board_cards || (hand.m_known_hands >> hand.m_num_players) != 0)
+                    {
+                        throw std::runtime_error("hh_binary_reader::read_block(size_t, uint8_t): invalid cards");
+                    }
+                }
+                bit_reader reader(v, pos);
+                const auto read_card = [&]() {
+                    const auto c = static_cast<uint8_t>(reader.read(6));
+                    if (c > c_cardindex_max)
+                    {
+                        throw std::runtime_error("hh_binary_reader::read_block(size_t, uint8_t): invalid card");
+                    }
+                    return c;
+                };
+                for (auto&& hand : ret.m_hands)
+                {
+                    for (uint8_t i = 0; i < hand.m_num_board_cards; ++i)
+                    {
+                        hand.m_board[i] = read_card();
+                    }
+                    for (uint8_t p = 0; p < hand.m_num_players; ++p)
+                    {
+                        if (hand.hand_known(p))
+                        {
+                            hand.m_hole_cards[p][0] = read_card();
+                            hand.m_hole_cards[p][1] = read_card();
+                        }
+                    }
+                }
+            }
+
+            if (has_column(hh_column_t::ACTIONS))
+            {
+                const auto& codes = column(hh_column_t::ACTIONS);
+                if (codes.size() != header.m_num_actions)
+                {
+                    throw std::runtime_error("hh_binary_reader::read_block(size_t, uint8_t): invalid number of actions");
+                }
+                ret.m_actions.resize(codes.size());
+                ret.m_streets.resize(codes.size());
+                std::size_t pos = 0;
+                for (auto&& hand : ret.m_hands)
+                {
+                    for (uint32_t i = hand.m_actions_begin; i < hand.m_actions_begin + hand.m_num_actions; ++i)
+                    {
+                        const uint8_t action = codes[i] & 7;
+                        const uint8_t player = (codes[i] >> 3) & 7;
+                        if (action > static_cast<uint8_t>(gb_action_t::ALLIN) || player >= hand.m_num_players)
+                        {
+                            throw std::runtime_error("hh_binary_reader::read_block(size_t, uint8_t): invalid action");
+                        }
+                        auto& a = ret.m_actions[i];
+                        a.m_action = static_cast<gb_action_t>(action);
+                        a.m_pos = static_cast<gb_pos_t>(player);
+                        a.m_amount = 0;
+                        if (has_column(hh_column_t::AMOUNTS) && detail::hh_has_amount(a.m_action))
+                        {
+                            a.m_amount = static_cast<int32_t>(read_varint(column(hh_column_t::AMOUNTS), pos));
+                        }
+                        ret.m_streets[i] = static_cast<gb_gamestate_t>(codes[i] >> 6);
+                    }
+                }
+            }
+
+            return ret;
+        }
+    };
+
+    // writes all hands of a parsed file, hands which can not be replayed (e.g. a blind larger than the stack) are skipped
+    // returns the number of written hands, write errors are not caught
+    inline uint64_t hh_convert(const hh_file_ps& file, hh_binary_writer& writer)
+    {
+        uint64_t ret = 0;
+        std::vector<gb_gamestate_t> streets;
+        for (auto&& hand : file.hands())
+        {
+            const auto actions = file.actions(hand);
+            try
+            {
+                detail::hh_streets(hand, actions, streets);
+            }
+            catch (const std::runtime_error&)
+            {
+                continue;
+            }
+            writer.add(hand, actions, streets);
+            ++ret;
+        }
+        return ret;
+    }
+
+    // converts a PokerStars hand history file (e.g. written by hh_ps) into the binary format, returns the number of written hands
+    inline uint64_t hh_convert_ps(const std::string& ps_filename, const std::string& binary_filename,
+                                  const unsigned num_threads = default_num_threads(),
+                                  const uint32_t hands_per_block = c_hh_default_block_size)
+    {
+        const hh_file_ps file(ps_filename, num_threads);
+        hh_binary_writer writer(binary_filename, hands_per_block);
+        const auto ret = hh_convert(file, writer);
+        writer.close();
+        return ret;
+    }
+
+}    // namespace mkp
@@ -0,0 +1,660 @@
+/*
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#pragma once
+
+#include <mkpoker/base/card.hpp>
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/hand.hpp>
+#include <mkpoker/game/game.hpp>
+#include <mkpoker/game/game_def.hpp>
+#include <mkpoker/util/array.hpp>
+#include <mkpoker/util/card_generator.hpp>
+#include <mkpoker/util/mapped_file.hpp>
+#include <mkpoker/util/parallel.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace mkp
+{
+    inline namespace constants
+    {
+        // the parser supports the same table sizes as gamestate
+        inline constexpr uint8_t c_hh_max_players = 6;
+    }    // namespace constants
+
+    // a single parsed hand, all players are indexed by their position in gamestate (i.e. SB = 0, BB = 1 for more than two players
+    // and BB = 0, SB = 1 heads up), all amounts are in mBB
+    struct hh_hand_t
+    {
+        uint64_t m_hand_id;
+        // hand text and player names point into the parsed file (zero-copy)
+        std::string_view m_text;
+        std::array<std::string_view, c_hh_max_players> m_names;
+        // starting stacks, amounts collected from the pot and rake
+        std::array<int32_t, c_hh_max_players> m_stacks;
+        std::array<int32_t, c_hh_max_players> m_collected;
+        int32_t m_rake;
+        // big blind in cents (or chips for tournaments)
+        int64_t m_big_blind;
+        // known hole cards (dealt to hero or shown), bit i set if the cards of player i are known
+        std::array<std::array<uint8_t, 2>, c_hh_max_players> m_hole_cards;
+        std::array<uint8_t, c_num_board_cards> m_board;
+        uint8_t m_known_hands;
+        uint8_t m_num_board_cards;
+        uint8_t m_num_players;
+        // range of actions in the action vector of the file
+        uint32_t m_actions_begin;
+        uint32_t m_num_actions;
+
+        [[nodiscard]] constexpr bool hand_known(const uint8_t pos) const noexcept { return (m_known_hands >> pos) & 1; }
+
+        [[nodiscard]] constexpr hand_2c hand(const uint8_t pos) const
+        {
+            return hand_2c(card(m_hole_cards[pos][0]), card(m_hole_cards[pos][1]));
+        }
+
+        // all known cards (board and hands)
+        [[nodiscard]] constexpr cardset known_cards() const noexcept
+        {
+            uint64_t ret = 0;
+            for (uint8_t i = 0; i < m_num_board_cards; ++i)
+            {
+                ret |= uint64_t(1) << m_board[i];
+            }
+            for (uint8_t pos = 0; pos < m_num_players; ++pos)
+            {
+                if (hand_known(pos))
+                {
+                    ret |= (uint64_t(1) << m_hole_cards[pos][0]) | (uint64_t(1) << m_hole_cards[pos][1]);
+                }
+            }
+            return cardset{ret};
+        }
+    };
+
+    namespace detail
+    {
+        // returns the next line without line break and advances sv
+        [[nodiscard]] constexpr std::string_view hh_next_line(std::string_view& sv) noexcept
+        {
+            const auto pos = sv.find('\n');
+            auto line = sv.substr(0, pos);
+            sv.remove_prefix(pos == std::string_view::npos ? sv.size() : pos + 1);
+            if (!line.empty() && line.back() == '\r')
+            {
+                line.remove_suffix(1);
+            }
+            return line;
+        }
+
+        // parses the first amount in sv as fixed point number with two decimals, i.e. "$1,234.5" -> 123450 and "20" -> 2000
+        // currency symbols and thousands separators are skipped, returns -1 if there is no amount
+        [[nodiscard]] constexpr int64_t hh_parse_amount(std::string_view sv) noexcept
+        {
+            std::size_t i = 0;
+            while (i < sv.size() && (sv[i] < '0' || sv[i] > '9'))
+            {
+                ++i;
+            }
+            if (i == sv.size())
+            {
+                return -1;
+            }
+
+            int64_t ret = 0;
+            for (; i < sv.size() && ((sv[i] >= '0' && sv[i] <= '9') || sv[i] == ','); ++i)
+            {
+                if (sv[i] != ',')
+                {
+                    ret = 10 * ret + (sv[i] - '0');
+                }
+            }
+            int decimals = 0;
+            if (i + 1 < sv.size() && sv[i] == '.' && sv[i + 1] >= '0' && sv[i + 1] <= '9')
+            {
+                for (++i; i < sv.size() && sv[i] >= '0' && sv[i] <= '9' && decimals < 2; ++i, ++decimals)
+                {
+                    ret = 10 * ret + (sv[i] - '0');
+                }
+            }
+            for (; decimals < 2; ++decimals)
+            {
+                ret *= 10;
+            }
+            return ret;
+        }
+
+        // parses "[Ah Kd ...]" into card indices, returns the number of cards or -1 on error
+        template <std::size_t N>
+        [[nodiscard]] constexpr int hh_parse_cards(std::string_view sv, std::array<uint8_t, N>& out)
+        {
+            const auto begin = sv.find('[');
+            const auto end = sv.find(']', begin);
+            if (begin == std::string_view::npos || end == std::string_view::npos)
+            {
+                return -1;
+            }
+            sv = sv.substr(begin + 1, end - begin - 1);
+
+            int n = 0;
+            for (std::size_t i = 0; i + 1 < sv.size(); i += 3)
+            {
+                if (n == static_cast<int>(N))
+                {
+                    return -1;
+                }
+                out[n++] = card(sv.substr(i, 2)).m_card;
+            }
+            return n;
+        }
+
+        // index of the longest player name which is followed by ':' or ' ' at the start of the line, -1 if there is none
+        [[nodiscard]] constexpr int hh_find_player(const std::string_view line, const std::span<const std::string_view> names) noexcept
+        {
+            int ret = -1;
+            std::size_t len = 0;
+            for (std::size_t i = 0; i < names.size(); ++i)
+            {
+                const auto n = names[i].size();
+                if (n >= len && line.size() > n && (line[n] == ':' || line[n] == ' ') && line.starts_with(names[i]))
+                {
+                    ret = static_cast<int>(i);
+                    len = n;
+                }
+            }
+            return ret;
+        }
+
+        // the start of the next hand at or after pos, npos if there is none
+        [[nodiscard]] constexpr std::size_t hh_find_hand_start(const std::string_view sv, std::size_t pos) noexcept
+        {
+            constexpr std::string_view c_start{"PokerStars "};
+            for (pos = sv.find(c_start, pos); pos != std::string_view::npos; pos = sv.find(c_start, pos + 1))
+            {
+                // beginning of a line, possibly after an utf-8 byte order mark
+                if (pos == 0 || sv[pos - 1] == '\n' || (pos == 3 && sv.starts_with("\xEF\xBB\xBF")))
+                {
+                    return pos;
+                }
+            }
+            return std::string_view::npos;
+        }
+    }    // namespace detail
+
+    // parses a single PokerStars no limit hold'em hand, the actions are appended to actions
+    // returns false (and leaves actions unchanged) for hands which can not be represented by gamestate, e.g. more than six
+    // players, antes, straddles, dead blinds, blinds other than 1:2 or amounts which are no whole number of mBB, and for
+    // malformed hands
+    inline bool parse_hand_ps(const std::string_view text, hh_hand_t& hand, std::vector<player_action_t>& actions)
+    {
+        hand = hh_hand_t{};
+        hand.m_text = text;
+        hand.m_actions_begin = static_cast<uint32_t>(actions.size());
+
+        try
+        {
+            std::string_view sv = text;
+
+            // header
+            auto line = detail::hh_next_line(sv);
+            if (line.starts_with("\xEF\xBB\xBF"))
+            {
+                line.remove_prefix(3);
+            }
+            const auto id_pos = line.find("Hand #");
+            if (!line.starts_with("PokerStars ") || id_pos == std::string_view::npos ||
+                line.find("Hold'em No Limit") == std::string_view::npos)
+            {
+                return false;
+            }
+            for (auto i = id_pos + 6; i < line.size() && line[i] >= '0' && line[i] <= '9'; ++i)
+            {
+                hand.m_hand_id = 10 * hand.m_hand_id + static_cast<uint64_t>(line[i] - '0');
+            }
+
+            // seats (in seat order) until the hole cards are dealt, blinds
+            constexpr uint8_t c_max_seats = 10;
+            std::array<std::string_view, c_max_seats> seat_names{};
+            std::array<int64_t, c_max_seats> seat_stacks{};
+            std::array<uint8_t, c_max_seats> seat_numbers{};
+            uint8_t num_seats = 0;
+            int sb_seat = -1;
+            int bb_seat = -1;
+            int64_t sb = 0;
+            int64_t bb = 0;
+            while (!sv.empty())
+            {
+                line = detail::hh_next_line(sv);
+                if (line.starts_with("*** HOLE CARDS ***"))
+                {
+                    break;
+                }
+                if (line.starts_with("Seat "))
+                {
+                    if (!line.ends_with(" in chips)"))
+                    {
+                        // players who are not dealt in, anything else (e.g. bounties) is not supported
+                        if (line.ends_with("is sitting out") || line.find(" out of hand") != std::string_view::npos)
+                        {
+                            continue;
+                        }
+                        return false;
+                    }
+                    const auto colon = line.find(": ");
+                    const auto paren = line.rfind(" (");
+                    if (num_seats == c_max_seats || colon == std::string_view::npos || paren == std::string_view::npos || paren < colon)
+                    {
+                        return false;
+                    }
+                    seat_numbers[num_seats] = static_cast<uint8_t>(detail::hh_parse_amount(line.substr(5, colon - 5)) / 100);
+                    seat_names[num_seats] = line.substr(colon + 2, paren - colon - 2);
+                    seat_stacks[num_seats] = detail::hh_parse_amount(line.substr(paren));
+                    ++num_seats;
+                    continue;
+                }
+
+                const int seat = detail::hh_find_player(line, {seat_names.data(), num_seats});
+                if (seat < 0 || !line.substr(seat_names[seat].size()).starts_with(": posts "))
+                {
+                    continue;
+                }
+                const auto rest = line.substr(seat_names[seat].size() + 8);
+                if (rest.starts_with("small blind ") && sb_seat < 0)
+                {
+                    sb_seat = seat;
+                    sb = detail::hh_parse_amount(rest);
+                }
+                else if (rest.starts_with("big blind ") && bb_seat < 0)
+                {
+                    bb_seat = seat;
+                    bb = detail::hh_parse_amount(rest);
+                }
+                else
+                {
+                    // antes, straddles, dead or additional blinds
+                    return false;
+                }
+            }
+
+            if (num_seats < 2 || num_seats > c_hh_max_players || sb_seat < 0 || bb_seat < 0 || bb <= 0 || 2 * sb != bb ||
+                (num_seats > 2 && bb_seat != (sb_seat + 1) % num_seats))
+            {
+                return false;
+            }
+            hand.m_num_players = num_seats;
+            hand.m_big_blind = bb;
+
+            // seat index to position: SB, BB, UTG, ... for more than two players and BB, SB (= BTN) heads up
+            // amounts which are no whole number of mBB (e.g. odd cents at a big blind of $25) can not be represented
+            bool exact = true;
+            const auto to_mbb = [&](const int64_t amount) {
+                exact = exact && amount * 1000 % bb == 0;
+                return static_cast<int32_t>(amount * 1000 / bb);
+            };
+            std::array<uint8_t, c_max_seats> seat_to_pos{};
+            for (uint8_t i = 0; i < num_seats; ++i)
+            {
+                seat_to_pos[i] = num_seats == 2 ? static_cast<uint8_t>(i == sb_seat ? 1 : 0)
+                                                : static_cast<uint8_t>((i + num_seats - sb_seat) % num_seats);
+                hand.m_names[seat_to_pos[i]] = seat_names[i];
+                hand.m_stacks[seat_to_pos[i]] = to_mbb(seat_stacks[i]);
+            }
+            const std::span<const std::string_view> names{hand.m_names.data(), num_seats};
+
+            // betting: chips in front of every player on the current street
+            std::array<int64_t, c_hh_max_players> street_chips{};
+            street_chips[seat_to_pos[sb_seat]] = sb;
+            street_chips[seat_to_pos[bb_seat]] = bb;
+            int64_t highest = bb;
+            bool summary = false;
+
+            while (!sv.empty())
+            {
+                line = detail::hh_next_line(sv);
+                if (line.empty())
+                {
+                    // hands are separated by blank lines
+                    if (summary)
+                    {
+                        break;
+                    }
+                    continue;
+                }
+
+                if (line.starts_with("*** "))
+                {
+                    if (line.starts_with("*** FLOP") || line.starts_with("*** TURN") || line.starts_with("*** RIVER"))
+                    {
+                        street_chips = {};
+                        highest = 0;
+                    }
+                    else if (line.starts_with("*** SUMMARY"))
+                    {
+                        summary = true;
+                    }
+                    continue;
+                }
+
+                if (summary)
+                {
+                    if (line.starts_with("Board "))
+                    {
+                        const int n = detail::hh_parse_cards(line, hand.m_board);
+                        if (n < 0)
+                        {
+                            return false;
+                        }
+                        hand.m_num_board_cards = static_cast<uint8_t>(n);
+                    }
+                    else if (line.starts_with("Total pot "))
+                    {
+                        if (const auto rake = line.find("| Rake "); rake != std::string_view::npos)
+                        {
+                            hand.m_rake = to_mbb(detail::hh_parse_amount(line.substr(rake)));
+                        }
+                    }
+                    else if (const auto bracket = line.find('[');
+                             line.starts_with("Seat ") && bracket != std::string_view::npos &&
+                             (line.substr(0, bracket).ends_with(" showed ") || line.substr(0, bracket).ends_with(" mucked ")))
+                    {
+                        const auto colon = line.find(':');
+                        const auto seat_number = detail::hh_parse_amount(line.substr(5, colon - 5)) / 100;
+                        const auto it = std::find(seat_numbers.cbegin(), seat_numbers.cbegin() + num_seats, seat_number);
+                        if (it != seat_numbers.cbegin() + num_seats)
+                        {
+                            const auto pos = seat_to_pos[static_cast<std::size_t>(it - seat_numbers.cbegin())];
+                            if (detail::hh_parse_cards(line.substr(colon), hand.m_hole_cards[pos]) != 2)
+                            {
+                                return false;
+                            }
+                            hand.m_known_hands |= static_cast<uint8_t>(1u << pos);
+                        }
+                    }
+                    continue;
+                }
+
+                if (line.starts_with("Dealt to "))
+                {
+                    const int pos = detail::hh_find_player(line.substr(9), names);
+                    if (pos >= 0 && detail::hh_parse_cards(line.substr(9 + names[pos].size()), hand.m_hole_cards[pos]) == 2)
+                    {
+                        hand.m_known_hands |= static_cast<uint8_t>(1u << pos);
+                    }
+                    continue;
+                }
+
+                const int pos = detail::hh_find_player(line, names);
+                if (pos < 0)
+                {
+                    // uncalled bets, chat, players joining or leaving, ...
+                    continue;
+                }
+                auto rest = line.substr(names[pos].size());
+                if (rest.starts_with(" collected "))
+                {
+                    hand.m_collected[pos] += to_mbb(detail::hh_parse_amount(rest));
+                    continue;
+                }
+                if (!rest.starts_with(": "))
+                {
+                    continue;
+                }
+                rest.remove_prefix(2);
+
+                if (rest.empty())
+                {
+                    continue;
+                }
+
+                // dispatch on the first character, most lines are actions
+                const auto add_action = [&](const int64_t amount, const gb_action_t action) {
+                    street_chips[pos] += amount;
+                    highest = std::max(highest, street_chips[pos]);
+                    const bool allin = rest.ends_with(" and is all-in");
+                    actions.emplace_back(to_mbb(amount), allin ? gb_action_t::ALLIN : action, static_cast<gb_pos_t>(pos));
+                };
+                switch (rest[0])
+                {
+                    case 'f':
+                        if (rest.starts_with("folds"))
+                        {
+                            actions.emplace_back(0, gb_action_t::FOLD, static_cast<gb_pos_t>(pos));
+                        }
+                        break;
+                    case 'c':
+                        if (rest.starts_with("checks"))
+                        {
+                            actions.emplace_back(0, gb_action_t::CHECK, static_cast<gb_pos_t>(pos));
+                        }
+                        else if (rest.starts_with("calls "))
+                        {
+                            add_action(detail::hh_parse_amount(rest.substr(6)), gb_action_t::CALL);
+                        }
+                        break;
+                    case 'b':
+                        if (rest.starts_with("bets "))
+                        {
+                            add_action(detail::hh_parse_amount(rest.substr(5)), gb_action_t::RAISE);
+                        }
+                        break;
+                    case 'r':
+                        if (rest.starts_with("raises "))
+                        {
+                            // "raises X to Y": X is the raise on top of the highest bet, Y is either the total of the street or of the hand
+                            add_action(detail::hh_parse_amount(rest.substr(7)) + highest - street_chips[pos], gb_action_t::RAISE);
+                        }
+                        break;
+                    case 's':
+                    case 'm':
+                        if ((rest.starts_with("shows ") || rest.starts_with("mucks ")) &&
+                            detail::hh_parse_cards(rest, hand.m_hole_cards[pos]) == 2)
+                        {
+                            hand.m_known_hands |= static_cast<uint8_t>(1u << pos);
+                        }
+                        break;
+                    case 'p':
+                        if (rest.starts_with("posts "))
+                        {
+                            // blinds after the hole cards are dealt
+                            actions.resize(hand.m_actions_begin);
+                            return false;
+                        }
+                        break;
+                    default:
+                        break;
+                }
+            }
+
+            if (!summary || !exact)
+            {
+                actions.resize(hand.m_actions_begin);
+                return false;
+            }
+        }
+        catch (const std::runtime_error&)
+        {
+            // invalid cards
+            actions.resize(hand.m_actions_begin);
+            return false;
+        }
+
+        hand.m_num_actions = static_cast<uint32_t>(actions.size() - hand.m_actions_begin);
+        return true;
+    }
+
+    // memory-mapped PokerStars hand history file, the file is split at hand boundaries and parsed in parallel
+    // all string_views of the hands point into the mapping and are valid as long as the object lives
+    class hh_file_ps
+    {
+        mapped_file m_file;
+        std::vector<hh_hand_t> m_hands;
+        std::vector<player_action_t> m_actions;
+        uint64_t m_num_skipped = 0;
+
+       public:
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // CTORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        explicit hh_file_ps(const std::string& filename, const unsigned num_threads = default_num_threads(),
+                            const uint64_t chunk_size = uint64_t(1) << 22)
+            : m_file(filename, mapped_file_advice_t::SEQUENTIAL)
+        {
+            if (chunk_size == 0)
+            {
+                throw std::runtime_error("hh_file_ps(const string&, unsigned, uint64_t): chunk size is zero");
+            }
+
+            // every chunk parses the hands which start in [begin, end), results are concatenated in file order
+            struct chunk_t
+            {
+                std::vector<hh_hand_t> m_hands;
+                std::vector<player_action_t> m_actions;
+                uint64_t m_num_skipped = 0;
+            };
+            const std::string_view text(reinterpret_cast<const char*>(m_file.data()), m_file.size());
+            std::vector<chunk_t> chunks((text.size() + chunk_size - 1) / chunk_size);
+
+            parallel_for_chunks(text.size(), num_threads, chunk_size, [&](const unsigned, const uint64_t begin, const uint64_t end) {
+                auto& chunk = chunks[begin / chunk_size];
+                hh_hand_t hand;
+                for (auto pos = detail::hh_find_hand_start(text, begin); pos < end;)
+                {
+                    const auto next = detail::hh_find_hand_start(text, pos + 1);
+                    const auto hand_text = text.substr(pos, next == std::string_view::npos ? std::string_view::npos : next - pos);
+                    if (parse_hand_ps(hand_text, hand, chunk.m_actions))
+                    {
+                        chunk.m_hands.push_back(hand);
+                    }
+                    else
+                    {
+                        ++chunk.m_num_skipped;
+                    }
+                    pos = next;
+                }
+            });
+
+            std::size_t num_hands = 0;
+            std::size_t num_actions = 0;
+            for (auto&& c : chunks)
+            {
+                num_hands += c.m_hands.size();
+                num_actions += c.m_actions.size();
+            }
+            m_hands.reserve(num_hands);
+            m_actions.reserve(num_actions);
+            for (auto&& c : chunks)
+            {
+                const auto offset = static_cast<uint32_t>(m_actions.size());
+                for (auto&& h : c.m_hands)
+                {
+                    m_hands.push_back(h);
+                    m_hands.back().m_actions_begin += offset;
+                }
+                m_actions.insert(m_actions.end(), c.m_actions.cbegin(), c.m_actions.cend());
+                m_num_skipped += c.m_num_skipped;
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // ACCESSORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] const std::vector<hh_hand_t>& hands() const noexcept { return m_hands; }
+
+        [[nodiscard]] std::span<const player_action_t> actions(const hh_hand_t& hand) const noexcept
+        {
+            return {m_actions.data() + hand.m_actions_begin, hand.m_num_actions};
+        }
+
+        // number of hands which could not be parsed or are not supported
+        [[nodiscard]] uint64_t num_skipped() const noexcept { return m_num_skipped; }
+
+        // size of the file in bytes
+        [[nodiscard]] std::size_t size() const noexcept { return m_file.size(); }
+    };
+
+    // the cards of a parsed hand, unknown hole cards (and missing board cards) are dealt randomly from the remaining deck
+    template <std::size_t N>
+    [[nodiscard]] gamecards<N> hh_gamecards(const hh_hand_t& hand, card_dealer<>& dealer)
+    {
+        if (hand.m_num_players != N)
+        {
+            throw std::runtime_error("hh_gamecards(hh_hand_t, card_dealer): hand has " + std::to_string(hand.m_num_players) +
+                                     " players, expected " + std::to_string(N));
+        }
+
+        const auto random = dealer.deal<c_num_board_cards + 2 * N>(hand.known_cards());
+        uint8_t next = 0;
+        std::array<card, c_num_board_cards> board = make_array<card, c_num_board_cards>(
+            [&](const uint8_t i) { return i < hand.m_num_board_cards ? card(hand.m_board[i]) : random[next++]; });
+        std::array<hand_2c, N> hands = make_array<hand_2c, N>([&](const uint8_t pos) {
+            if (hand.hand_known(pos))
+            {
+                return hand.hand(pos);
+            }
+            next += 2;
+            return hand_2c(random[next - 2], random[next - 1]);
+        });
+        return gamecards<N>(board, hands);
+    }
+
+    // replays the actions of a parsed hand, calls f(game, action) before every action and returns the final game state
+    // throws if the hand does not match N or an action is not one of the possible actions of the game (in every build type, unlike
+    // gamestate::execute_action which only checks without NDEBUG)
+    template <std::size_t N, std::size_t A, std::size_t B, typename F>
+    gamestate<N, A, B> hh_replay(const hh_hand_t& hand, const std::span<const player_action_t> actions, F&& f)
+    {
+        if (hand.m_num_players != N)
+        {
+            throw std::runtime_error("hh_replay(hh_hand_t, span<player_action_t>): hand has " + std::to_string(hand.m_num_players) +
+                                     " players, expected " + std::to_string(N));
+        }
+
+        gamestate<N, A, B> game(make_array<int32_t, N>([&](const uint8_t pos) { return hand.m_stacks[pos]; }));
+        for (auto&& a : actions)
+        {
+            if (const auto possible = game.possible_actions(); std::find(possible.cbegin(), possible.cend(), a) == possible.cend())
+            {
+                throw std::runtime_error("hh_replay(hh_hand_t, span<player_action_t>): action " + a.str() + " of player " +
+                                         std::to_string(static_cast<unsigned>(a.m_pos)) + " does not match the game");
+            }
+            f(std::as_const(game), a);
+            game.execute_action(a);
+        }
+        return game;
+    }
+
+    template <std::size_t N, std::size_t A, std::size_t B>
+    gamestate<N, A, B> hh_replay(const hh_hand_t& hand, const std::span<const player_action_t> actions)
+    {
+        return hh_replay<N, A, B>(hand, actions, [](auto&&, auto&&) {});
+    }
+
+}    // namespace mkp
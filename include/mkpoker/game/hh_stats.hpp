@@ -0,0 +1,485 @@
+/*
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#pragma once
+
+#include <mkpoker/game/game.hpp>
+#include <mkpoker/game/game_def.hpp>
+#include <mkpoker/game/hh_binary.hpp>
+#include <mkpoker/game/hh_parser.hpp>
+#include <mkpoker/util/file.hpp>
+#include <mkpoker/util/parallel.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace mkp
+{
+    // counters of a player, all rates are derived from them which makes stats of different hands and files additive
+    struct player_stats_t
+    {
+        uint64_t m_hands = 0;
+        // voluntarily put money in pot and preflop raise
+        uint64_t m_vpip = 0;
+        uint64_t m_pfr = 0;
+        // facing exactly one preflop raise
+        uint64_t m_3bet_opportunities = 0;
+        uint64_t m_3bets = 0;
+        // preflop aggressor on the flop before anybody else bet
+        uint64_t m_cbet_opportunities = 0;
+        uint64_t m_cbets = 0;
+        uint64_t m_saw_flop = 0;
+        uint64_t m_showdowns = 0;
+        uint64_t m_showdowns_won = 0;
+        // postflop bets and raises, calls, checks and folds
+        uint64_t m_postflop_aggressive = 0;
+        uint64_t m_postflop_calls = 0;
+        uint64_t m_postflop_passive = 0;
+        // net result in mBB after rake
+        int64_t m_won = 0;
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // ACCESSORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] double vpip() const noexcept { return ratio(m_vpip, m_hands); }
+
+        [[nodiscard]] double pfr() const noexcept { return ratio(m_pfr, m_hands); }
+
+        [[nodiscard]] double three_bet() const noexcept { return ratio(m_3bets, m_3bet_opportunities); }
+
+        [[nodiscard]] double cbet() const noexcept { return ratio(m_cbets, m_cbet_opportunities); }
+
+        // went to showdown (after seeing the flop) and won money at showdown
+        [[nodiscard]] double wtsd() const noexcept { return ratio(m_showdowns, m_saw_flop); }
+
+        [[nodiscard]] double wsd() const noexcept { return ratio(m_showdowns_won, m_showdowns); }
+
+        // (bets + raises) / calls
+        [[nodiscard]] double aggression_factor() const noexcept { return ratio(m_postflop_aggressive, m_postflop_calls); }
+
+        // (bets + raises) / all postflop actions
+        [[nodiscard]] double aggression_frequency() const noexcept
+        {
+            return ratio(m_postflop_aggressive, m_postflop_aggressive + m_postflop_calls + m_postflop_passive);
+        }
+
+        // big blinds won per 100 hands
+        [[nodiscard]] double bb_per_100() const noexcept { return m_hands == 0 ? 0.0 : 0.1 * static_cast<double>(m_won) / m_hands; }
+
+        auto operator<=>(const player_stats_t&) const noexcept = delete;
+        bool operator==(const player_stats_t&) const noexcept = default;
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // MUTATORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        player_stats_t& operator+=(const player_stats_t& other) noexcept
+        {
+            m_hands += other.m_hands;
+            m_vpip += other.m_vpip;
+            m_pfr += other.m_pfr;
+            m_3bet_opportunities += other.m_3bet_opportunities;
+            m_3bets += other.m_3bets;
+            m_cbet_opportunities += other.m_cbet_opportunities;
+            m_cbets += other.m_cbets;
+            m_saw_flop += other.m_saw_flop;
+            m_showdowns += other.m_showdowns;
+            m_showdowns_won += other.m_showdowns_won;
+            m_postflop_aggressive += other.m_postflop_aggressive;
+            m_postflop_calls += other.m_postflop_calls;
+            m_postflop_passive += other.m_postflop_passive;
+            m_won += other.m_won;
+            return *this;
+        }
+
+       private:
+        [[nodiscard]] static double ratio(const uint64_t a, const uint64_t b) noexcept
+        {
+            return b == 0 ? 0.0 : static_cast<double>(a) / static_cast<double>(b);
+        }
+    };
+
+    static_assert(std::is_trivially_copyable_v<player_stats_t>, "player_stats_t is stored as raw bytes");
+    static_assert(sizeof(player_stats_t) == 14 * sizeof(uint64_t), "player_stats_t should have no padding");
+
+    namespace detail
+    {
+        // classifies every action of a hand by replaying it, see hh_hand_stats
+        template <std::size_t N>
+        void hh_hand_stats_n(const hh_hand_t& hand, const std::span<const player_action_t> actions,
+                             std::array<player_stats_t, c_hh_max_players>& stats)
+        {
+            gb_gamestate_t street = gb_gamestate_t::PREFLOP_BET;
+            // raises in the current betting round, the big blind does not count
+            unsigned num_raises = 0;
+            int preflop_aggressor = -1;
+            bool flop_seen = false;
+            // players who already had a 3bet opportunity / acted on the flop
+            uint8_t faced_raise = 0;
+            uint8_t acted_flop = 0;
+
+            const auto see_flop = [&](const auto& game) {
+                flop_seen = true;
+                const auto states = game.all_players_state();
+                for (uint8_t pos = 0; pos < N; ++pos)
+                {
+                    stats[pos].m_saw_flop = states[pos] != gb_playerstate_t::OUT;
+                }
+            };
+
+            const auto f = [&](const auto& game, const player_action_t& a) {
+                if (game.gamestate_v() != street)
+                {
+                    street = game.gamestate_v();
+                    num_raises = 0;
+                    if (street == gb_gamestate_t::FLOP_BET)
+                    {
+                        see_flop(game);
+                    }
+                }
+
+                const auto pos = static_cast<uint8_t>(a.m_pos);
+                const auto bit = static_cast<uint8_t>(1u << pos);
+                auto& s = stats[pos];
+                // an allin is a raise if it is more than a call
+                const bool aggressive =
+                    a.m_action == gb_action_t::RAISE ||
+                    (a.m_action == gb_action_t::ALLIN && game.chips_front()[pos] + a.m_amount > game.current_highest_bet());
+
+                if (street == gb_gamestate_t::PREFLOP_BET)
+                {
+                    s.m_vpip |= a.m_action != gb_action_t::FOLD && a.m_action != gb_action_t::CHECK;
+                    if (num_raises == 1 && !(faced_raise & bit))
+                    {
+                        faced_raise |= bit;
+                        s.m_3bet_opportunities = 1;
+                        s.m_3bets = aggressive;
+                    }
+                    if (aggressive)
+                    {
+                        s.m_pfr = 1;
+                        preflop_aggressor = pos;
+                    }
+                }
+                else
+                {
+                    if (street == gb_gamestate_t::FLOP_BET)
+                    {
+                        if (pos == preflop_aggressor && num_raises == 0 && !(acted_flop & bit))
+                        {
+                            s.m_cbet_opportunities = 1;
+                            s.m_cbets = aggressive;
+                        }
+                        acted_flop |= bit;
+                    }
+                    if (aggressive)
+                    {
+                        ++s.m_postflop_aggressive;
+                    }
+                    else if (a.m_action == gb_action_t::CALL || a.m_action == gb_action_t::ALLIN)
+                    {
+                        ++s.m_postflop_calls;
+                    }
+                    else
+                    {
+                        ++s.m_postflop_passive;
+                    }
+                }
+
+                if (aggressive)
+                {
+                    ++num_raises;
+                }
+            };
+
+            const auto game = hh_replay<N, 0, 1>(hand, actions, f);
+            if (!game.in_terminal_state())
+            {
+                throw std::runtime_error("hh_hand_stats(hh_hand_t, span<player_action_t>): hand is not finished");
+            }
+
+            const auto states = game.all_players_state();
+            if (game.is_showdown())
+            {
+                // all players allin before the flop
+                if (!flop_seen)
+                {
+                    see_flop(game);
+                }
+                for (uint8_t pos = 0; pos < N; ++pos)
+                {
+                    if (states[pos] != gb_playerstate_t::OUT)
+                    {
+                        stats[pos].m_showdowns = 1;
+                        stats[pos].m_showdowns_won = hand.m_collected[pos] > 0;
+                    }
+                }
+            }
+
+            // uncalled bets are returned and not part of the investment
+            const auto [return_pos, return_amount] = game.chips_to_return();
+            const auto chips_behind = game.chips_behind();
+            for (uint8_t pos = 0; pos < N; ++pos)
+            {
+                const int32_t returned = pos == static_cast<uint8_t>(return_pos) ? return_amount : 0;
+                const int32_t invested = hand.m_stacks[pos] - chips_behind[pos] - returned;
+                stats[pos].m_hands = 1;
+                stats[pos].m_won = hand.m_collected[pos] - invested;
+            }
+        }
+
+        // heterogeneous lookup of names (string_views into hand histories or blocks)
+        struct hh_name_hash
+        {
+            using is_transparent = void;
+
+            [[nodiscard]] std::size_t operator()(const std::string_view sv) const noexcept { return std::hash<std::string_view>{}(sv); }
+        };
+    }    // namespace detail
+
+    // stats of every player (by position) in a single hand, throws if the actions do not match the hand or the hand is not finished
+    // the net results require the stacks and payouts of the hand
+    [[nodiscard]] inline std::array<player_stats_t, c_hh_max_players> hh_hand_stats(const hh_hand_t& hand,
+                                                                                   const std::span<const player_action_t> actions)
+    {
+        std::array<player_stats_t, c_hh_max_players> ret{};
+        switch (hand.m_num_players)
+        {
+            case 2:
+                detail::hh_hand_stats_n<2>(hand, actions, ret);
+                break;
+            case 3:
+                detail::hh_hand_stats_n<3>(hand, actions, ret);
+                break;
+            case 4:
+                detail::hh_hand_stats_n<4>(hand, actions, ret);
+                break;
+            case 5:
+                detail::hh_hand_stats_n<5>(hand, actions, ret);
+                break;
+            case 6:
+                detail::hh_hand_stats_n<6>(hand, actions, ret);
+                break;
+            default:
+                throw std::runtime_error("hh_hand_stats(hh_hand_t, span<player_action_t>): invalid number of players");
+        }
+        return ret;
+    }
+
+    struct hh_stats_file_header_t
+    {
+        static constexpr std::array<char, 8> c_magic{'M', 'K', 'P', 'S', 'T', 'A', 'T', '\0'};
+        static constexpr uint32_t c_version = 1;
+
+        std::array<char, 8> m_magic = c_magic;
+        uint32_t m_version = c_version;
+        uint32_t m_stats_size = sizeof(player_stats_t);
+        uint64_t m_num_players = 0;
+        uint64_t m_num_hands = 0;
+        uint64_t m_num_skipped = 0;
+
+        // throws if the header does not belong to a valid stats file
+        void validate(const std::string& filename) const
+        {
+            if (m_magic != c_magic || m_version == 0 || m_version > c_version || m_stats_size != sizeof(player_stats_t))
+            {
+                throw std::runtime_error("player stats file '" + filename + "': invalid magic or unsupported version");
+            }
+        }
+    };
+
+    static_assert(sizeof(hh_stats_file_header_t) == 40, "hh_stats_file_header_t should have no padding");
+
+    // player stats aggregated over hand histories, keyed by player name
+    // stats are additive: new files are added to existing (e.g. loaded) stats without rescanning older hands
+    class hh_stats
+    {
+       public:
+        using map_t = std::unordered_map<std::string, player_stats_t, detail::hh_name_hash, std::equal_to<>>;
+
+       private:
+        map_t m_players;
+        uint64_t m_num_hands = 0;
+        uint64_t m_num_skipped = 0;
+
+        [[nodiscard]] player_stats_t& player(const std::string_view name)
+        {
+            if (auto it = m_players.find(name); it != m_players.end())
+            {
+                return it->second;
+            }
+            return m_players.emplace(std::string(name), player_stats_t{}).first->second;
+        }
+
+        // one instance per thread, merged into this at the end
+        template <typename F>
+        void add_parallel(const uint64_t n, const unsigned num_threads, const uint64_t chunk_size, F&& f)
+        {
+            std::vector<hh_stats> partial(std::max(1u, num_threads));
+            parallel_for_chunks(n, num_threads, chunk_size, [&](const unsigned thread_id, const uint64_t begin, const uint64_t end) {
+                for (uint64_t i = begin; i < end; ++i)
+                {
+                    f(partial[thread_id], i);
+                }
+            });
+            for (auto&& e : partial)
+            {
+                merge(e);
+            }
+        }
+
+       public:
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // CTORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        hh_stats() = default;
+
+        // load stats written by save()
+        explicit hh_stats(const std::string& filename)
+        {
+            const auto file = detail::open_file(filename, "rb");
+            hh_stats_file_header_t header;
+            detail::read_binary(file.get(), &header, 1);
+            header.validate(filename);
+
+            m_num_hands = header.m_num_hands;
+            m_num_skipped = header.m_num_skipped;
+            m_players.reserve(header.m_num_players);
+            std::string name;
+            for (uint64_t i = 0; i < header.m_num_players; ++i)
+            {
+                uint32_t len = 0;
+                detail::read_binary(file.get(), &len, 1);
+                name.resize(len);
+                detail::read_binary(file.get(), name.data(), len);
+                detail::read_binary(file.get(), &m_players[name], 1);
+            }
+            if (m_players.size() != header.m_num_players)
+            {
+                throw std::runtime_error("player stats file '" + filename + "': duplicate player names");
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // ACCESSORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] const map_t& players() const noexcept { return m_players; }
+
+        // stats of a player or nullptr if the player is unknown
+        [[nodiscard]] const player_stats_t* find(const std::string_view name) const
+        {
+            const auto it = m_players.find(name);
+            return it != m_players.end() ? &it->second : nullptr;
+        }
+
+        // number of added hands, hands which could not be replayed are skipped
+        [[nodiscard]] uint64_t num_hands() const noexcept { return m_num_hands; }
+
+        [[nodiscard]] uint64_t num_skipped() const noexcept { return m_num_skipped; }
+
+        // write stats to file (native byte order)
+        void save(const std::string& filename) const
+        {
+            const auto file = detail::open_file(filename, "wb");
+            hh_stats_file_header_t header{};
+            header.m_num_players = m_players.size();
+            header.m_num_hands = m_num_hands;
+            header.m_num_skipped = m_num_skipped;
+            detail::write_binary(file.get(), &header, 1);
+            for (auto&& [name, stats] : m_players)
+            {
+                const auto len = static_cast<uint32_t>(name.size());
+                detail::write_binary(file.get(), &len, 1);
+                detail::write_binary(file.get(), name.data(), len);
+                detail::write_binary(file.get(), &stats, 1);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // MUTATORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // adds a single hand, returns false (and counts the hand as skipped) if it can not be replayed
+        bool add(const hh_hand_t& hand, const std::span<const player_action_t> actions)
+        {
+            std::array<player_stats_t, c_hh_max_players> stats;
+            try
+            {
+                stats = hh_hand_stats(hand, actions);
+            }
+            catch (const std::runtime_error&)
+            {
+                ++m_num_skipped;
+                return false;
+            }
+            for (uint8_t pos = 0; pos < hand.m_num_players; ++pos)
+            {
+                player(hand.m_names[pos]) += stats[pos];
+            }
+            ++m_num_hands;
+            return true;
+        }
+
+        // adds all hands of a parsed file, work is split into chunks of hands
+        void add(const hh_file_ps& file, const unsigned num_threads = default_num_threads())
+        {
+            constexpr uint64_t c_chunk_size = 4096;
+            const auto& hands = file.hands();
+            add_parallel(hands.size(), num_threads, c_chunk_size,
+                         [&](hh_stats& stats, const uint64_t i) { stats.add(hands[i], file.actions(hands[i])); });
+        }
+
+        // adds all hands of a binary file, work is split by blocks and the cards are not decoded
+        void add(const hh_binary_reader& file, const unsigned num_threads = default_num_threads())
+        {
+            constexpr uint8_t c_columns = c_hh_all_columns & ~hh_column_bit(hh_column_t::CARDS);
+            add_parallel(file.num_blocks(), num_threads, 1, [&](hh_stats& stats, const uint64_t i) {
+                const auto block = file.read_block(i, c_columns);
+                for (auto&& hand : block.hands())
+                {
+                    stats.add(hand, block.actions(hand));
+                }
+            });
+        }
+
+        void merge(const hh_stats& other)
+        {
+            for (auto&& [name, stats] : other.m_players)
+            {
+                player(name) += stats;
+            }
+            m_num_hands += other.m_num_hands;
+            m_num_skipped += other.m_num_skipped;
+        }
+    };
+
+}    // namespace mkp
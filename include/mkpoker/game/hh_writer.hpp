@@ -0,0 +1,298 @@
+/*
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <fmt/format.h>    // fmt::memory_buffer
+
+namespace mkp
+{
+    // single sink for hand histories from many threads: producers queue blocks of complete hands
+    // (lock-free, multi producer / single consumer) and a background thread writes them to the file.
+    // blocks are recycled through a free list and at most max_blocks are queued at the same time, submit
+    // waits for the writer if the disk is too slow. all hh_buffers must be destroyed before the sink is closed
+    class hh_sink
+    {
+       public:
+        struct block_t
+        {
+            fmt::memory_buffer m_data;
+            block_t* m_next = nullptr;
+        };
+
+       private:
+        std::FILE* m_f;
+        std::size_t m_max_blocks;
+        std::atomic<block_t*> m_queue{nullptr};
+        std::atomic<std::size_t> m_num_queued{0};
+        std::atomic<bool> m_stop{false};
+        std::atomic<bool> m_failed{false};
+        std::mutex m_free_mtx;
+        block_t* m_free = nullptr;
+        std::thread m_writer;
+
+        void push(block_t* block) noexcept
+        {
+            block->m_next = m_queue.load(std::memory_order_relaxed);
+            while (!m_queue.compare_exchange_weak(block->m_next, block, std::memory_order_release, std::memory_order_relaxed))
+            {
+            }
+            m_queue.notify_one();
+        }
+
+        void write_block(block_t* block) noexcept
+        {
+            if (std::fwrite(block->m_data.data(), 1, block->m_data.size(), m_f) != block->m_data.size())
+            {
+                m_failed.store(true, std::memory_order_relaxed);
+            }
+        }
+
+        void write_loop()
+        {
+            for (;;)
+            {
+                m_queue.wait(nullptr, std::memory_order_acquire);
+                block_t* block = m_queue.exchange(nullptr, std::memory_order_acquire);
+
+                // the queue is a stack, reverse it to write the blocks in order of submission
+                block_t* ordered = nullptr;
+                while (block != nullptr)
+                {
+                    block_t* next = block->m_next;
+                    block->m_next = ordered;
+                    ordered = block;
+                    block = next;
+                }
+                while (ordered != nullptr)
+                {
+                    write_block(ordered);
+                    block_t* next = ordered->m_next;
+                    release(ordered);
+                    ordered = next;
+                    m_num_queued.fetch_sub(1, std::memory_order_release);
+                    m_num_queued.notify_all();
+                }
+
+                if (m_stop.load(std::memory_order_acquire) && m_queue.load(std::memory_order_acquire) == nullptr)
+                {
+                    break;
+                }
+            }
+            if (std::fflush(m_f) != 0)
+            {
+                m_failed.store(true, std::memory_order_relaxed);
+            }
+        }
+
+        // stops the writer after all queued blocks are written, blocks it did not see any more are written here
+        void stop() noexcept
+        {
+            if (!m_writer.joinable())
+            {
+                return;
+            }
+            m_stop.store(true, std::memory_order_release);
+            // empty block to wake up the writer, it may also exit before it sees this block
+            m_num_queued.fetch_add(1, std::memory_order_relaxed);
+            push(acquire());
+            m_writer.join();
+            for (block_t* block = m_queue.exchange(nullptr, std::memory_order_acquire); block != nullptr;)
+            {
+                write_block(block);
+                block_t* next = block->m_next;
+                delete block;
+                block = next;
+            }
+        }
+
+       public:
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // CTORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // the file stays owned by the caller, it must remain open until the sink is closed
+        explicit hh_sink(std::FILE* f, const std::size_t max_blocks = 16) : m_f(f), m_max_blocks(max_blocks)
+        {
+            if (m_f == nullptr)
+            {
+                throw std::runtime_error("hh_sink(FILE*, size_t): invalid file");
+            }
+            if (m_max_blocks == 0)
+            {
+                throw std::runtime_error("hh_sink(FILE*, size_t): at least one block has to be allowed");
+            }
+            m_writer = std::thread([this]() { write_loop(); });
+        }
+
+        hh_sink(const hh_sink&) = delete;
+        hh_sink& operator=(const hh_sink&) = delete;
+
+        // writes all queued blocks, write errors are only reported by close()
+        ~hh_sink()
+        {
+            stop();
+            while (m_free != nullptr)
+            {
+                block_t* next = m_free->m_next;
+                delete m_free;
+                m_free = next;
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // ACCESSORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // false if a write to the file failed so far (e.g. disk full)
+        [[nodiscard]] bool good() const noexcept { return !m_failed.load(std::memory_order_relaxed); }
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // MUTATORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // writes all queued blocks and stops the writer, throws if any write failed
+        void close()
+        {
+            stop();
+            if (!good())
+            {
+                throw std::runtime_error("hh_sink::close(): could not write all hand histories");
+            }
+        }
+
+        // an empty block from the free list (or a new one), thread safe
+        [[nodiscard]] block_t* acquire()
+        {
+            {
+                const std::lock_guard<std::mutex> lock(m_free_mtx);
+                if (m_free != nullptr)
+                {
+                    block_t* ret = std::exchange(m_free, m_free->m_next);
+                    ret->m_next = nullptr;
+                    return ret;
+                }
+            }
+            return new block_t{};
+        }
+
+        // return an unused block to the free list, its memory is kept, thread safe
+        void release(block_t* block) noexcept
+        {
+            block->m_data.clear();
+            const std::lock_guard<std::mutex> lock(m_free_mtx);
+            block->m_next = m_free;
+            m_free = block;
+        }
+
+        // queue the block for writing (the sink takes ownership), waits while max_blocks are queued, thread safe
+        void submit(block_t* block)
+        {
+            for (std::size_t n = m_num_queued.load(std::memory_order_acquire);;)
+            {
+                if (n >= m_max_blocks)
+                {
+                    m_num_queued.wait(n, std::memory_order_acquire);
+                    n = m_num_queued.load(std::memory_order_acquire);
+                }
+                else if (m_num_queued.compare_exchange_weak(n, n + 1, std::memory_order_acq_rel, std::memory_order_acquire))
+                {
+                    break;
+                }
+            }
+            push(block);
+        }
+    };
+
+    // per thread buffer for hand histories (see hh_ps), the memory is reused and handed to the sink in large blocks
+    class hh_buffer
+    {
+        hh_sink* m_sink;
+        hh_sink::block_t* m_block;
+        std::size_t m_flush_size;
+
+       public:
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // CTORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        explicit hh_buffer(hh_sink& sink, const std::size_t flush_size = std::size_t(1) << 20)
+            : m_sink(&sink), m_block(sink.acquire()), m_flush_size(flush_size)
+        {
+            m_block->m_data.reserve(flush_size);
+        }
+
+        hh_buffer(const hh_buffer&) = delete;
+        hh_buffer& operator=(const hh_buffer&) = delete;
+
+        ~hh_buffer()
+        {
+            if (m_block->m_data.size() > 0)
+            {
+                m_sink->submit(m_block);
+            }
+            else
+            {
+                m_sink->release(m_block);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // ACCESSORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // the buffer to write the current hand into
+        [[nodiscard]] fmt::memory_buffer& buffer() noexcept { return m_block->m_data; }
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // MUTATORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // call after every complete hand, hands are never split between blocks
+        void commit()
+        {
+            if (m_block->m_data.size() >= m_flush_size)
+            {
+                flush();
+            }
+        }
+
+        // hand the block to the sink and continue with a recycled one
+        void flush()
+        {
+            if (m_block->m_data.size() > 0)
+            {
+                m_sink->submit(m_block);
+                m_block = m_sink->acquire();
+                m_block->m_data.reserve(m_flush_size);
+            }
+        }
+    };
+
+}    // namespace mkp
@@ -0,0 +1,220 @@
+/*
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+
+#pragma once
+
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/hand.hpp>
+#include <mkpoker/game/game.hpp>
+#include <mkpoker/util/card_generator.hpp>
+#include <mkpoker/util/parallel.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mkp
+{
+    // a policy decides the action of an agent given the game state, its hand and the visible board,
+    // it is called concurrently from all worker threads and must return one of game.possible_actions()
+    template <std::size_t N, std::size_t A = 0, std::size_t B = 1>
+    using policy_t = std::function<player_action_t(const gamestate<N, A, B>& game, const hand_2c hand, const cardset board,
+                                                   xoshiro256ss& rng)>;
+
+    // pick a random action
+    template <std::size_t N, std::size_t A = 0, std::size_t B = 1>
+    [[nodiscard]] player_action_t random_policy(const gamestate<N, A, B>& game, const hand_2c, const cardset, xoshiro256ss& rng)
+    {
+        const auto actions = game.possible_actions();
+        return actions[rng.bounded(static_cast<uint32_t>(actions.size()))];
+    }
+
+    // check or call, never fold or raise
+    template <std::size_t N, std::size_t A = 0, std::size_t B = 1>
+    [[nodiscard]] player_action_t calling_station_policy(const gamestate<N, A, B>& game, const hand_2c, const cardset, xoshiro256ss&)
+    {
+        const auto amount = game.amount_to_call();
+        const auto behind = game.chips_behind()[game.active_player()];
+        if (amount == 0)
+        {
+            return player_action_t{0, gb_action_t::CHECK, game.active_player_v()};
+        }
+        return amount < behind ? player_action_t{amount, gb_action_t::CALL, game.active_player_v()}
+                               : player_action_t{behind, gb_action_t::ALLIN, game.active_player_v()};
+    }
+
+    struct simulation_options_t
+    {
+        // number of deals, with duplicate deals every deal is played N times
+        uint64_t m_num_deals = 1'000'000;
+        uint64_t m_seed = 1927;
+        unsigned m_num_threads = default_num_threads();
+        // starting stack of every player for every hand (in mBB)
+        int32_t m_stacksize = 100'000;
+        // play every deal once per seat rotation, i.e., every agent plays every seat with the same cards
+        bool m_duplicate = true;
+    };
+
+    struct agent_result_t
+    {
+        // winnings in mBB per hand, standard deviation per deal and half width of the 95% confidence interval of the mean
+        double m_mean = 0.0;
+        double m_stddev = 0.0;
+        double m_ci95 = 0.0;
+
+        [[nodiscard]] double bb_per_100() const noexcept { return m_mean / 10.0; }
+    };
+
+    struct simulation_result_t
+    {
+        std::vector<agent_result_t> m_agents;
+        uint64_t m_num_hands = 0;
+    };
+
+    // plays batches of hands between N agents (one per seat) on all threads
+    // results only depend on the options (not on the number of threads), since every chunk of deals has its own random stream
+    template <std::size_t N, std::size_t A = 0, std::size_t B = 1>
+    class hand_simulator
+    {
+        using game_type = gamestate<N, A, B>;
+
+        // fixed number of chunks, so the random streams do not depend on the number of threads
+        static constexpr uint64_t c_num_chunks = 256;
+
+        std::vector<policy_t<N, A, B>> m_policies;
+
+        struct chunk_sums_t
+        {
+            std::array<int64_t, N> m_sum{};
+            std::array<double, N> m_sum_sq{};
+        };
+
+        // play one hand, agent_at_seat[i] is the agent sitting in seat i, add winnings to the agents
+        void play_hand(const gamecards<N>& cards, const std::array<uint8_t, N>& agent_at_seat, const int32_t stacksize,
+                       xoshiro256ss& rng, std::array<int64_t, N>& winnings) const
+        {
+            constexpr std::array<uint8_t, 5> c_visible_board_cards{0, 3, 4, 5, 5};
+
+            game_type game(stacksize);
+            while (!game.in_terminal_state())
+            {
+                const uint8_t pos = game.active_player();
+                const auto board = cards.board_n_as_cs(c_visible_board_cards[static_cast<uint8_t>(game.gamestate_v())]);
+                game.execute_action(m_policies[agent_at_seat[pos]](game, cards.m_hands[pos], board, rng));
+            }
+
+            const auto payouts = game.is_showdown() ? game.payouts_showdown(cards) : game.payouts_noshowdown();
+            for (uint8_t pos = 0; pos < N; ++pos)
+            {
+                winnings[agent_at_seat[pos]] += payouts[pos];
+            }
+        }
+
+       public:
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // CTORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // one policy per agent, the number of agents must equal the number of seats
+        explicit hand_simulator(std::vector<policy_t<N, A, B>> policies) : m_policies(std::move(policies))
+        {
+            if (m_policies.size() != N)
+            {
+                throw std::runtime_error("hand_simulator(vector<policy_t>): number of policies (" + std::to_string(m_policies.size()) +
+                                         ") must equal the number of players (" + std::to_string(N) + ")");
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // ACCESSORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] simulation_result_t run(const simulation_options_t& options) const
+        {
+            if (options.m_num_deals < 2)
+            {
+                throw std::runtime_error("hand_simulator::run(): at least two deals are required");
+            }
+
+            const uint64_t num_chunks = std::min(c_num_chunks, options.m_num_deals);
+            const uint64_t deals_per_chunk = (options.m_num_deals + num_chunks - 1) / num_chunks;
+            const uint8_t num_rotations = options.m_duplicate ? static_cast<uint8_t>(N) : 1;
+            std::vector<chunk_sums_t> chunk_sums(num_chunks);
+
+            parallel_for_chunks(num_chunks, options.m_num_threads, 1, [&](const unsigned, const uint64_t chunk, const uint64_t) {
+                card_dealer dealer(options.m_seed, static_cast<uint32_t>(chunk));
+                auto& sums = chunk_sums[chunk];
+                const uint64_t end = std::min(options.m_num_deals, (chunk + 1) * deals_per_chunk);
+                for (uint64_t deal = chunk * deals_per_chunk; deal < end; ++deal)
+                {
+                    const gamecards<N> cards(dealer.template deal<2 * N + c_num_board_cards>());
+
+                    // every sample is the result of one deal, i.e. of all rotations with the same cards
+                    std::array<int64_t, N> winnings{};
+                    for (uint8_t r = 0; r < num_rotations; ++r)
+                    {
+                        // without duplicate deals, rotate the seats from deal to deal
+                        const auto offset = static_cast<uint8_t>(options.m_duplicate ? r : deal % N);
+                        const auto agent_at_seat =
+                            make_array<uint8_t, N>([&](const auto seat) { return static_cast<uint8_t>((seat + offset) % N); });
+                        play_hand(cards, agent_at_seat, options.m_stacksize, dealer.rng(), winnings);
+                    }
+                    for (uint8_t a = 0; a < N; ++a)
+                    {
+                        const double x = static_cast<double>(winnings[a]) / num_rotations;
+                        sums.m_sum[a] += winnings[a];
+                        sums.m_sum_sq[a] += x * x;
+                    }
+                }
+            });
+
+            // merge in a fixed order
+            chunk_sums_t total{};
+            for (auto&& sums : chunk_sums)
+            {
+                for (uint8_t a = 0; a < N; ++a)
+                {
+                    total.m_sum[a] += sums.m_sum[a];
+                    total.m_sum_sq[a] += sums.m_sum_sq[a];
+                }
+            }
+
+            simulation_result_t ret{};
+            ret.m_num_hands = options.m_num_deals * num_rotations;
+            const auto n = static_cast<double>(options.m_num_deals);
+            for (uint8_t a = 0; a < N; ++a)
+            {
+                agent_result_t res{};
+                res.m_mean = static_cast<double>(total.m_sum[a]) / static_cast<double>(ret.m_num_hands);
+                res.m_stddev = std::sqrt(std::max(0.0, (total.m_sum_sq[a] - n * res.m_mean * res.m_mean) / (n - 1)));
+                res.m_ci95 = 1.96 * res.m_stddev / std::sqrt(n);
+                ret.m_agents.push_back(res);
+            }
+            return ret;
+        }
+    };
+
+}    // namespace mkp
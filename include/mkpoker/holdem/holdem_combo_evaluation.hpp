@@ -0,0 +1,142 @@
+/*
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+
+#pragma once
+
+#include <mkpoker/base/card.hpp>
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/combo.hpp>
+#include <mkpoker/holdem/holdem_evaluation.hpp>
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace mkp
+{
+    // suits of a board which can still make a flush with two more (hole) cards
+    struct board_flush_suits_t
+    {
+        // all cards of suits with exactly 3 board cards, a combo needs both cards of that suit
+        uint64_t m_need_two = 0;
+        // all cards of suits with 4 or more board cards, a combo needs one card of that suit (any card for 5)
+        uint64_t m_need_one = 0;
+
+        // true if a combo (cardset bits) can make a flush on the board
+        [[nodiscard]] constexpr bool can_flush(const uint64_t combo) const noexcept
+        {
+            return (combo & m_need_one) != 0 || (combo & ~m_need_two) == 0;
+        }
+
+        // true if no combo can make a flush, e.g. rainbow boards or boards with at most two cards of every suit
+        [[nodiscard]] constexpr bool none() const noexcept { return m_need_two == 0 && m_need_one == 0; }
+    };
+
+    [[nodiscard]] constexpr board_flush_suits_t board_flush_suits(const cardset board) noexcept
+    {
+        board_flush_suits_t ret{};
+        const uint64_t mask = board.as_bitset();
+        for (uint8_t s = 0; s < c_num_suits; ++s)
+        {
+            const uint64_t suit_cards = uint64_t(c_mask_ranks) << (s * c_num_ranks);
+            switch (std::popcount(mask & suit_cards))
+            {
+                case 3:
+                    ret.m_need_two |= suit_cards;
+                    break;
+                case 4:
+                    ret.m_need_one |= suit_cards;
+                    break;
+                case 5:
+                    // the board itself is a flush
+                    ret.m_need_one = c_cardset_full;
+                    break;
+                default:
+                    break;
+            }
+        }
+        return ret;
+    }
+
+    namespace detail
+    {
+        // rank pair (hi * c_num_ranks + lo) of every combo
+        inline constexpr auto c_combo_rank_pairs = []() {
+            std::array<uint8_t, c_num_combos> ret{};
+            for (uint16_t i = 0; i < c_num_combos; ++i)
+            {
+                const auto r1 = static_cast<uint8_t>(c_combo_cards[i][0] % c_num_ranks);
+                const auto r2 = static_cast<uint8_t>(c_combo_cards[i][1] % c_num_ranks);
+                ret[i] = static_cast<uint8_t>(std::max(r1, r2) * c_num_ranks + std::min(r1, r2));
+            }
+            return ret;
+        }();
+    }    // namespace detail
+
+    // evaluation (holdem_result::as_bitset()) of every combo (indexed by combo_index) with a board of 3 to 5 cards,
+    // combos colliding with the board are 0; throws if the board size is invalid
+    //
+    // combos which can not make a flush (see board_flush_suits) only depend on the ranks of the hole cards, so they are
+    // evaluated once per rank pair (e.g. all 16 AK or all 6 AA combos share one evaluation) with rank count masks
+    [[nodiscard]] inline std::array<uint32_t, c_num_combos> evaluate_combos(const cardset board)
+    {
+        if (board.size() < 3 || board.size() > 5)
+        {
+            throw std::runtime_error("evaluate_combos(const cardset): invalid board size " + std::to_string(board.size()));
+        }
+
+        const auto flush_suits = board_flush_suits(board);
+        detail::rank_count_masks_t board_ranks{};
+        std::array<uint8_t, c_num_ranks> board_rank_counts{};
+        for (uint64_t mask = board.as_bitset(); mask != 0; mask &= mask - 1)
+        {
+            const auto r = static_cast<uint8_t>(cross_idx_low64(mask) % c_num_ranks);
+            detail::add_rank(board_ranks, r);
+            ++board_rank_counts[r];
+        }
+
+        // rank only evaluation of every possible rank pair
+        std::array<uint32_t, c_num_ranks * c_num_ranks> by_ranks{};
+        for (uint8_t hi = 0; hi < c_num_ranks; ++hi)
+        {
+            for (uint8_t lo = 0; lo <= hi; ++lo)
+            {
+                if (board_rank_counts[hi] + 1 + (hi == lo) > c_num_suits || board_rank_counts[lo] + 1 > c_num_suits)
+                {
+                    continue;
+                }
+                auto masks = board_ranks;
+                detail::add_rank(masks, hi);
+                detail::add_rank(masks, lo);
+                by_ranks[hi * c_num_ranks + lo] = detail::evaluate_no_flush(masks[0], masks[1], masks[2], masks[3]).as_bitset();
+            }
+        }
+
+        std::array<uint32_t, c_num_combos> ret{};
+        (~blocked_combos(board)).for_each([&](const uint16_t i) {
+            const uint64_t combo = detail::c_combo_bitsets[i];
+            ret[i] = flush_suits.can_flush(combo) ? evaluate_unsafe(cardset{board.as_bitset() | combo}).as_bitset()
+                                                  : by_ranks[detail::c_combo_rank_pairs[i]];
+        });
+        return ret;
+    }
+
+}    // namespace mkp
@@ -21,13 +21,18 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <mkpoker/base/card.hpp>
 #include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/cardset_combinations.hpp>
 #include <mkpoker/base/hand.hpp>
 #include <mkpoker/holdem/holdem_evaluation.hpp>
+#include <mkpoker/holdem/holdem_state_table.hpp>
 
 #include <algorithm>    // std::max_element, std::count
+#include <cstddef>
 #include <cstdint>
 #include <numeric>      // std::reduce
 #include <stdexcept>    // std::runtime_error
+#include <utility>      // std::pair
+#include <vector>
 
 namespace mkp
 {
@@ -39,209 +44,197 @@ namespace mkp
         std::vector<float> m_equities;
     };
 
-    // calculate equities for variable number of hands and board (optional)
-    equity_calculation_result_t calculate_equities(const std::vector<hand_2c>& hands, const std::vector<card>& vec_board = {})
+    namespace detail
     {
-        if (const auto sz = hands.size(); sz < 2 || sz > 9)
+        // checks hands and board, returns the board and all fixed cards (board + hole cards)
+        [[nodiscard]] inline std::pair<cardset, cardset> equity_calculation_cards(const std::vector<hand_2c>& hands,
+                                                                                 const std::vector<card>& vec_board)
         {
-            throw std::runtime_error(fmt::format("invalid number of hands (should be in the range of [2,9], given {})", sz));
-        }
-
-        const auto all_hole_cards = [&]() {
-            cardset cs{};
-            for (auto&& hand : hands)
+            if (const auto sz = hands.size(); sz < 2 || sz > 9)
             {
-                cs = cs.combine(hand.as_cardset());
+                throw std::runtime_error(fmt::format("invalid number of hands (should be in the range of [2,9], given {})", sz));
             }
-            return cs;
-        }();
 
-        if (all_hole_cards.size() != hands.size() * 2)
-        {
-            throw std::runtime_error(
-                fmt::format("hands contain duplicate cards: number of unique cards ({}) is smaller than {} (2 * {}[number of hands])",
-                            all_hole_cards.size(), hands.size() * 2, hands.size()));
-        }
+            const auto all_hole_cards = [&]() {
+                cardset cs{};
+                for (auto&& hand : hands)
+                {
+                    cs = cs.combine(hand.as_cardset());
+                }
+                return cs;
+            }();
 
-        if (vec_board.size() > 5)
-        {
-            throw std::runtime_error(
-                fmt::format("invalid number of board cards (should be less or equal to five, given {})", vec_board.size()));
-        }
-        const auto board = [&]() {
-            cardset cs{};
-            for (auto&& card : vec_board)
+            if (all_hole_cards.size() != hands.size() * 2)
             {
-                cs.insert(card);
+                throw std::runtime_error(
+                    fmt::format("hands contain duplicate cards: number of unique cards ({}) is smaller than {} (2 * {}[number of hands])",
+                                all_hole_cards.size(), hands.size() * 2, hands.size()));
             }
-            return cs;
-        }();
-        if (board.size() != vec_board.size())
-        {
-            throw std::runtime_error(fmt::format("board contains duplicate cards ({} cards given but only {} of them are unique)",
-                                                 vec_board.size(), board.size()));
-        }
-        const auto all_fixed_cards = board.combine(all_hole_cards);
-        if (all_fixed_cards.size() != board.size() + all_hole_cards.size())
-        {
-            throw std::runtime_error(
-                fmt::format("hands and board contain duplicate cards: number of unique cards ({}) is smaller than {} ({}[number of board "
-                            "cards] + {}[number of cards in all hands])",
-                            all_fixed_cards.size(), board.size() + all_hole_cards.size(), board.size(), all_hole_cards.size()));
+
+            if (vec_board.size() > 5)
+            {
+                throw std::runtime_error(
+                    fmt::format("invalid number of board cards (should be less or equal to five, given {})", vec_board.size()));
+            }
+            const auto board = [&]() {
+                cardset cs{};
+                for (auto&& card : vec_board)
+                {
+                    cs.insert(card);
+                }
+                return cs;
+            }();
+            if (board.size() != vec_board.size())
+            {
+                throw std::runtime_error(fmt::format("board contains duplicate cards ({} cards given but only {} of them are unique)",
+                                                     vec_board.size(), board.size()));
+            }
+            const auto all_fixed_cards = board.combine(all_hole_cards);
+            if (all_fixed_cards.size() != board.size() + all_hole_cards.size())
+            {
+                throw std::runtime_error(fmt::format(
+                    "hands and board contain duplicate cards: number of unique cards ({}) is smaller than {} ({}[number of board "
+                    "cards] + {}[number of cards in all hands])",
+                    all_fixed_cards.size(), board.size() + all_hole_cards.size(), board.size(), all_hole_cards.size()));
+            }
+
+            return {board, all_fixed_cards};
         }
 
-        std::vector<uint32_t> wins;
-        std::vector<uint32_t> ties;
-        std::vector<uint32_t> score;
-        std::vector<float> equities;
-        for (unsigned i = 0; i < hands.size(); ++i)
+        // wins / ties of all runouts so far
+        class equity_counter
         {
-            wins.push_back(0);
-            ties.push_back(0);
-            score.push_back(0);
-            equities.push_back(0.0f);
-        }
+            std::vector<uint32_t> m_wins;
+            std::vector<uint32_t> m_ties;
+            std::vector<uint32_t> m_score;
 
-        // calculate wins / losses and store them
-        auto calculate_and_store_results = [&](const cardset& additional_cards) {
-            const auto runout = additional_cards.combine(board);
-            std::vector<holdem_result> results;
-            for (auto&& hand : hands)
-            {
-                results.emplace_back(evaluate_unsafe(runout.combine(hand.as_cardset())));
-            }
+           public:
+            explicit equity_counter(const std::size_t num_hands) : m_wins(num_hands, 0), m_ties(num_hands, 0), m_score(num_hands, 0) {}
 
-            const auto it_max = std::max_element(results.cbegin(), results.cend());
-            const auto num_max = std::count(results.cbegin(), results.cend(), *it_max);
-            if (num_max > 1)
+            // results of all hands for one runout (holdem_result or its bits)
+            template <typename T>
+            void add(const std::vector<T>& results)
             {
-                // more than one winner -> tie
-                for (unsigned n = 0; n < results.size(); ++n)
+                const auto it_max = std::max_element(results.cbegin(), results.cend());
+                const auto num_max = std::count(results.cbegin(), results.cend(), *it_max);
+                if (num_max > 1)
                 {
-                    if (results[n] == *it_max)
+                    // more than one winner -> tie
+                    for (unsigned n = 0; n < results.size(); ++n)
                     {
-                        ties[n] += 1;
-                        score[n] += 1;
+                        if (results[n] == *it_max)
+                        {
+                            m_ties[n] += 1;
+                            m_score[n] += 1;
+                        }
                     }
                 }
+                else
+                {
+                    // only one winner
+                    const auto n = it_max - results.cbegin();
+                    m_wins[n] += 1;
+                    m_score[n] += static_cast<uint32_t>(results.size());
+                }
             }
-            else
+
+            // counts of another counter for the same hands, e.g. from another thread
+            void merge(const equity_counter& other) noexcept
             {
-                // only one winner
-                for (unsigned n = 0; n < results.size(); ++n)
+                for (unsigned n = 0; n < m_score.size(); ++n)
                 {
-                    if (results[n] == *it_max)
-                    {
-                        wins[n] += 1;
-                        score[n] += static_cast<uint32_t>(hands.size());
-                        break;
-                    }
+                    m_wins[n] += other.m_wins[n];
+                    m_ties[n] += other.m_ties[n];
+                    m_score[n] += other.m_score[n];
+                }
+            }
+
+            // calc actual equity and return
+            [[nodiscard]] equity_calculation_result_t result() const
+            {
+                const auto total_score = std::reduce(m_score.cbegin(), m_score.cend(), uint32_t(0));
+                std::vector<float> equities(m_score.size(), 0.0f);
+                for (unsigned i = 0; i < m_score.size(); ++i)
+                {
+                    equities[i] = static_cast<float>(m_score[i]) / total_score;
+                    equities[i] *= 100;
                 }
+                return equity_calculation_result_t{m_wins, m_ties, equities};
             }
         };
+    }    // namespace detail
+
+    // calculate equities for variable number of hands and board (optional)
+    inline equity_calculation_result_t calculate_equities(const std::vector<hand_2c>& hands, const std::vector<card>& vec_board = {})
+    {
+        const auto [board, all_fixed_cards] = detail::equity_calculation_cards(hands, vec_board);
+        detail::equity_counter counter(hands.size());
 
-        if (board.size() == 5)
+        // calculate wins / losses and store them
+        std::vector<holdem_result> results;
+        auto calculate_and_store_results = [&](const cardset& additional_cards) {
+            const auto runout = additional_cards.combine(board);
+            results.clear();
+            for (auto&& hand : hands)
+            {
+                results.emplace_back(evaluate_unsafe(runout.combine(hand.as_cardset())));
+            }
+            counter.add(results);
+        };
+
+        // every runout of the remaining deck
+        const cardset deck{c_cardset_full & ~all_fixed_cards.as_bitset()};
+        cardset_combinations(deck, static_cast<uint8_t>(5 - board.size())).for_each(calculate_and_store_results);
+
+        return counter.result();
+    }
+
+    // same as above, but evaluated with a state table: the states of hole cards + board are computed once and
+    // every runout card is a single lookup per hand, shared by all runouts with the same prefix
+    inline equity_calculation_result_t calculate_equities(const std::vector<hand_2c>& hands, const std::vector<card>& vec_board,
+                                                          const holdem_state_table& table)
+    {
+        const auto [board, all_fixed_cards] = detail::equity_calculation_cards(hands, vec_board);
+        detail::equity_counter counter(hands.size());
+
+        // states of all hands for every number of runout cards
+        const auto num_missing = static_cast<uint8_t>(5 - board.size());
+        std::vector<std::vector<holdem_state_table::cursor>> states(num_missing + 1, std::vector(hands.size(), table.start()));
+        for (unsigned n = 0; n < hands.size(); ++n)
         {
-            // calculate immediately - we already have 5 cards
-            calculate_and_store_results(cardset{});
+            states[0][n].add(board.combine(hands[n].as_cardset()));
         }
-        else
-        {
-            for (uint8_t i = 0; i < c_deck_size; ++i)
+
+        std::vector<uint32_t> results(hands.size());
+        auto enumerate_runouts = [&](auto& self, const uint8_t depth, const uint8_t first_card) -> void {
+            if (depth == num_missing)
             {
-                card c1{i};
-                if (all_fixed_cards.contains(c1))
+                for (unsigned n = 0; n < hands.size(); ++n)
                 {
-                    continue;
+                    results[n] = states[depth][n].result_bits();
                 }
+                counter.add(results);
+                return;
+            }
 
-                if (board.size() == 4)
+            for (uint8_t i = first_card; i < c_deck_size; ++i)
+            {
+                const card c{i};
+                if (all_fixed_cards.contains(c))
                 {
-                    // calculate immediately - we already have 5 cards
-                    const auto additional_cards = cardset{c1};
-                    calculate_and_store_results(additional_cards);
+                    continue;
                 }
-                else
+                for (unsigned n = 0; n < hands.size(); ++n)
                 {
-                    for (uint8_t j = i + 1; j < c_deck_size; ++j)
-                    {
-                        card c2{j};
-                        if (all_fixed_cards.contains(c2))
-                        {
-                            continue;
-                        }
-
-                        if (board.size() == 3)
-                        {
-                            // calculate immediately - we already have 5 cards
-                            const auto additional_cards = cardset{c1, c2};
-                            calculate_and_store_results(additional_cards);
-                        }
-                        else
-                        {
-                            for (uint8_t k = j + 1; k < c_deck_size; ++k)
-                            {
-                                card c3{k};
-                                if (all_fixed_cards.contains(c3))
-                                {
-                                    continue;
-                                }
-
-                                if (board.size() == 2)
-                                {
-                                    // calculate immediately - we already have 5 cards
-                                    const auto additional_cards = cardset{c1, c2, c3};
-                                    calculate_and_store_results(additional_cards);
-                                }
-                                else
-                                {
-                                    for (uint8_t l = k + 1; l < c_deck_size; ++l)
-                                    {
-                                        card c4{l};
-                                        if (all_fixed_cards.contains(c4))
-                                        {
-                                            continue;
-                                        }
-
-                                        if (board.size() == 1)
-                                        {
-                                            // calculate immediately - we already have 5 cards
-                                            const auto additional_cards = cardset{c1, c2, c3, c4};
-                                            calculate_and_store_results(additional_cards);
-                                        }
-                                        else
-                                        {
-                                            // draw 5th card
-                                            for (uint8_t m = l + 1; m < c_deck_size; ++m)
-                                            {
-                                                card c5{m};
-                                                if (all_fixed_cards.contains(c5))
-                                                {
-                                                    continue;
-                                                }
-                                                // calc and store results
-                                                const auto additional_cards = cardset{c1, c2, c3, c4, c5};
-                                                calculate_and_store_results(additional_cards);
-                                            }
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                    }
+                    states[depth + 1][n] = states[depth][n];
+                    states[depth + 1][n].add(c);
                 }
+                self(self, static_cast<uint8_t>(depth + 1), static_cast<uint8_t>(i + 1));
             }
-        }
-
-        // calc actual equity and return
-        const auto total_score = std::reduce(score.cbegin(), score.cend(), uint32_t(0));
-        for (unsigned i = 0; i < hands.size(); ++i)
-        {
-            equities[i] = static_cast<float>(score[i]) / total_score;
-            equities[i] *= 100;
-        }
+        };
+        enumerate_runouts(enumerate_runouts, 0, 0);
 
-        return equity_calculation_result_t{wins, ties, equities};
+        return counter.result();
     }
 
 }    // namespace mkp
\ No newline at end of file
@@ -20,146 +20,352 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #pragma once
 
 #include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/cardset16.hpp>
 #include <mkpoker/holdem/holdem_lookup_tables.hpp>
 #include <mkpoker/holdem/holdem_result.hpp>
 #include <mkpoker/util/bit.hpp>
+#include <mkpoker/util/cpu_dispatch.hpp>
 
+#include <array>
+#include <bit>
+#include <cstddef>
 #include <cstdint>
+#include <span>
 #include <stdexcept>
 
 namespace mkp
 {
-    // this algorithm assumes that the cardset contains at most 7 cards; otherwise, the behavior is undefined
-    [[nodiscard]] auto evaluate_unsafe(const cardset cs) noexcept
+    namespace detail
     {
-        // general idea:
-        // check the different hand types from highest to lowest, i.e. straight flush -> quads -> full house -> etc.
-
-        // break down into suits
-        const uint64_t mask = cs.as_bitset();
-        const uint16_t mask_c = (mask >> (0 * c_num_ranks)) & c_mask_ranks;
-        const uint16_t mask_d = (mask >> (1 * c_num_ranks)) & c_mask_ranks;
-        const uint16_t mask_h = (mask >> (2 * c_num_ranks)) & c_mask_ranks;
-        const uint16_t mask_s = (mask >> (3 * c_num_ranks)) & c_mask_ranks;
+        // mask i contains all ranks with more than i cards, i.e. the suit masks of an equivalent hand with the suits assigned
+        // in order; since evaluate_no_flush only depends on the number of cards per rank, these can replace the actual suit masks
+        using rank_count_masks_t = std::array<uint16_t, c_num_suits>;
 
-        // 1)
-        // check flush first, if we found one, there can be no quads / fh
-        // so we return (straight) flush as a result
+        constexpr void add_rank(rank_count_masks_t& masks, const uint8_t r) noexcept
         {
-            // if we have a straight, return straight flush high, else return flush
-            auto flush_or_straight_flush = [](const uint16_t mask_flush) {
-                const auto x = mkpoker_table_straight[mask_flush];
-                if (x > 0)
+            const uint16_t rank_bit = uint16_t(1) << r;
+            for (auto&& mask : masks)
+            {
+                if (!(mask & rank_bit))
                 {
-                    return holdem_result(c_straight_flush, x, 0, 0);
+                    mask |= rank_bit;
+                    return;
                 }
-                else
+            }
+        }
+
+        // everything but flushes, i.e. quads -> full house -> straight -> trips -> (two) pair -> no pair
+        // straight_table maps a rank mask to the high card of its best straight (other decks have other straights)
+        template <const auto& straight_table = mkpoker_table_straight>
+        [[nodiscard]] inline holdem_result evaluate_no_flush(const uint16_t mask_c, const uint16_t mask_d, const uint16_t mask_h,
+                                                             const uint16_t mask_s) noexcept
+        {
+            // 2)
+            // check for quads, full house
+
+            // this mask is used for quads, fh and pairs
+            const uint16_t mask_all_cards = mask_c | mask_d | mask_h | mask_s;
+
+#if MKP_EVAL_TABLE_SIZE >= 1
+            // no pair or one pair (the most common cases) are a single lookup with the larger tables
+            if constexpr (&straight_table == &mkpoker_table_straight)
+            {
+                const uint16_t mask_trips = ((mask_c & mask_d) | (mask_h & mask_s)) & ((mask_c & mask_h) | (mask_d & mask_s));
+                const uint16_t mask_pair = mask_all_cards ^ (mask_c ^ mask_d ^ mask_h ^ mask_s);
+                if (mask_trips == 0)
                 {
-                    return holdem_result(c_flush, 0, 0, mkpoker_table_top5[mask_flush]);
+                    if (mask_pair == 0)
+                    {
+                        return holdem_result_from_bitset(mkpoker_table_unique[mask_all_cards]);
+                    }
+#if MKP_EVAL_TABLE_SIZE >= 2
+                    if ((mask_pair & (mask_pair - 1)) == 0)
+                    {
+                        return holdem_result_from_bitset(mkpoker_table_pair[(std::size_t(cross_idx_high16(mask_pair)) << c_num_ranks) |
+                                                                            mask_all_cards]);
+                    }
+#endif
                 }
-            };
+            }
+#endif
 
-            if (std::popcount(mask_c) >= 5)
+            // check quads
+            if (const uint16_t mask_quads = (mask_c & mask_d & mask_h & mask_s); mask_quads)
             {
-                return flush_or_straight_flush(mask_c);
+                return holdem_result(c_four_of_a_kind, cross_idx_high16(mask_quads), 0,
+                                     (uint16_t(1) << cross_idx_high16(mask_all_cards & ~mask_quads)));
             }
-            else if (std::popcount(mask_d) >= 5)
+
+            // this mask is used for for full house and trips
+            const uint16_t mask_trips = ((mask_c & mask_d) | (mask_h & mask_s)) & ((mask_c & mask_h) | (mask_d & mask_s));
+
+            // check for full house (trips + pair)
+            if (mask_trips)
             {
-                return flush_or_straight_flush(mask_d);
+                // mask_pair_fh below checks for exactly 2 identical cards and can thus miss if we have trips + trips
+                // since we only evaluate 7 cards at max, there can be no other pairs in case of double trips
+                if (std::popcount(mask_trips) > 1)
+                {
+                    return holdem_result(c_full_house, cross_idx_high16(mask_trips), cross_idx_low16(mask_trips), 0);
+                }
+
+                // this finds all the duplicated cards, but no trips/quads
+                if (const uint16_t mask_pair_fh = (mask_all_cards ^ (mask_c ^ mask_d ^ mask_h ^ mask_s)); mask_pair_fh)
+                {
+                    return holdem_result(c_full_house, cross_idx_high16(mask_trips), cross_idx_high16(mask_pair_fh), 0);
+                }
             }
-            else if (std::popcount(mask_h) >= 5)
+
+            // 3)
+            // check for straight
+            const auto rank_straight = straight_table[mask_all_cards];
+            if (rank_straight > 0)
             {
-                return flush_or_straight_flush(mask_h);
+                return holdem_result(c_straight, rank_straight, 0, 0);
             }
-            else if (std::popcount(mask_s) >= 5)
+
+            // 4)
+            // check trips
+            if (mask_trips)
             {
-                return flush_or_straight_flush(mask_s);
+                const uint16_t mask_kickers = mask_all_cards & ~(mask_trips);
+                const auto high_kicker = cross_idx_high16(mask_kickers);
+                const auto low_kicker = cross_idx_high16(mask_kickers & ~(uint16_t(1) << high_kicker));
+                return holdem_result(c_three_of_a_kind, cross_idx_high16(mask_trips), 0,
+                                     uint16_t(1) << high_kicker | uint16_t(1) << low_kicker);
             }
-        }
 
-        // 2)
-        // check for quads, full house
+            // 5)
+            // pair / two pair
+            const uint16_t mask_pair = (mask_all_cards ^ (mask_c ^ mask_d ^ mask_h ^ mask_s));
+            if (const auto num_pairs = std::popcount(mask_pair); num_pairs > 1)
+            {
+                // get the two highest ranks from the mask (keep in mind - with 6/7 cards, there can be 3 pairs)
+                const auto high_rank = cross_idx_high16(mask_pair);
+                const auto low_rank = cross_idx_high16(mask_pair & ~(uint16_t(1) << high_rank));
+                // from the remaining cards, get the highest rank
+                const auto kicker_rank = cross_idx_high16(mask_all_cards & ~(uint16_t(1) << high_rank | uint16_t(1) << low_rank));
+                return holdem_result(c_two_pair, high_rank, low_rank, uint16_t(1) << kicker_rank);
+            }
+            else if (num_pairs > 0)
+            {
+                const uint16_t mask_kickers = mask_all_cards & ~(mask_pair);
+                return holdem_result(c_one_pair, cross_idx_high16(mask_pair), 0, mkpoker_table_top3[mask_kickers]);
+            }
 
-        // this mask is used for quads, fh and pairs
-        const uint16_t mask_all_cards = mask_c | mask_d | mask_h | mask_s;
+            // 6)
+            // no pair
+            return holdem_result(c_no_pair, 0, 0, mkpoker_table_top5[mask_all_cards]);
+        }
 
-        // check quads
-        if (const uint16_t mask_quads = (mask_c & mask_d & mask_h & mask_s); mask_quads)
+        // bit 4 of a 16 bit lane is set if the suit (c, d, h, s from low to high) has at least 5 cards
+        // counts the bits of all suits at once (swar), std::popcount is a library call without the popcnt instruction
+        [[nodiscard]] constexpr uint64_t flush_lanes(const uint16_t mask_c, const uint16_t mask_d, const uint16_t mask_h,
+                                                     const uint16_t mask_s) noexcept
         {
-            return holdem_result(c_four_of_a_kind, cross_idx_high16(mask_quads), 0,
-                                 (uint16_t(1) << cross_idx_high16(mask_all_cards & ~mask_quads)));
+            uint64_t x = mask_c | (uint64_t(mask_d) << 16) | (uint64_t(mask_h) << 32) | (uint64_t(mask_s) << 48);
+            x = x - ((x >> 1) & 0x5555'5555'5555'5555);
+            x = (x & 0x3333'3333'3333'3333) + ((x >> 2) & 0x3333'3333'3333'3333);
+            x = (x + (x >> 4)) & 0x0F0F'0F0F'0F0F'0F0F;
+            x = (x + (x >> 8)) & 0x00FF'00FF'00FF'00FF;
+            return (x + 0x000B'000B'000B'000B) & 0x0010'0010'0010'0010;
         }
 
-        // this mask is used for for full house and trips
-        const uint16_t mask_trips = ((mask_c & mask_d) | (mask_h & mask_s)) & ((mask_c & mask_h) | (mask_d & mask_s));
-
-        // check for full house (trips + pair)
-        if (mask_trips)
+        // if we have a straight, return straight flush high, else return flush
+        template <const auto& straight_table = mkpoker_table_straight>
+        [[nodiscard]] inline holdem_result flush_or_straight_flush(const uint16_t mask_flush) noexcept
         {
-            // mask_pair_fh below checks for exactly 2 identical cards and can thus miss if we have trips + trips
-            // since we only evaluate 7 cards at max, there can be no other pairs in case of double trips
-            if (std::popcount(mask_trips) > 1)
+#if MKP_EVAL_TABLE_SIZE >= 1
+            if constexpr (&straight_table == &mkpoker_table_straight)
             {
-                return holdem_result(c_full_house, cross_idx_high16(mask_trips), cross_idx_low16(mask_trips), 0);
+                return holdem_result_from_bitset(mkpoker_table_flush[mask_flush]);
             }
-
-            // this finds all the duplicated cards, but no trips/quads
-            if (const uint16_t mask_pair_fh = (mask_all_cards ^ (mask_c ^ mask_d ^ mask_h ^ mask_s)); mask_pair_fh)
+#endif
+            const auto x = straight_table[mask_flush];
+            if (x > 0)
+            {
+                return holdem_result(c_straight_flush, x, 0, 0);
+            }
+            else
             {
-                return holdem_result(c_full_house, cross_idx_high16(mask_trips), cross_idx_high16(mask_pair_fh), 0);
+                return holdem_result(c_flush, 0, 0, mkpoker_table_top5[mask_flush]);
             }
         }
+    }    // namespace detail
 
-        // 3)
-        // check for straight
-        const auto rank_straight = mkpoker_table_straight[mask_all_cards];
-        if (rank_straight > 0)
+    namespace detail
+    {
+        // evaluation of the ranks of every suit
+        [[nodiscard]] inline holdem_result evaluate_suit_masks(const uint16_t mask_c, const uint16_t mask_d, const uint16_t mask_h,
+                                                               const uint16_t mask_s) noexcept
         {
-            return holdem_result(c_straight, rank_straight, 0, 0);
-        }
+            // general idea:
+            // check the different hand types from highest to lowest, i.e. straight flush -> quads -> full house -> etc.
 
-        // 4)
-        // check trips
-        if (mask_trips)
-        {
-            const uint16_t mask_kickers = mask_all_cards & ~(mask_trips);
-            const auto high_kicker = cross_idx_high16(mask_kickers);
-            const auto low_kicker = cross_idx_high16(mask_kickers & ~(uint16_t(1) << high_kicker));
-            return holdem_result(c_three_of_a_kind, cross_idx_high16(mask_trips), 0,
-                                 uint16_t(1) << high_kicker | uint16_t(1) << low_kicker);
+            // 1)
+            // check flush first, if we found one, there can be no quads / fh
+            // so we return (straight) flush as a result
+            {
+                if (std::popcount(mask_c) >= 5)
+                {
+                    return flush_or_straight_flush(mask_c);
+                }
+                else if (std::popcount(mask_d) >= 5)
+                {
+                    return flush_or_straight_flush(mask_d);
+                }
+                else if (std::popcount(mask_h) >= 5)
+                {
+                    return flush_or_straight_flush(mask_h);
+                }
+                else if (std::popcount(mask_s) >= 5)
+                {
+                    return flush_or_straight_flush(mask_s);
+                }
+            }
+
+            // 2) - 6)
+            return evaluate_no_flush(mask_c, mask_d, mask_h, mask_s);
         }
+    }    // namespace detail
 
-        // 5)
-        // pair / two pair
-        const uint16_t mask_pair = (mask_all_cards ^ (mask_c ^ mask_d ^ mask_h ^ mask_s));
-        if (const auto num_pairs = std::popcount(mask_pair); num_pairs > 1)
+    // this algorithm assumes that the cardset contains at most 7 cards; otherwise, the behavior is undefined
+    [[nodiscard]] auto evaluate_unsafe(const cardset cs) noexcept
+    {
+        // break down into suits
+        const uint64_t mask = cs.as_bitset();
+        const uint16_t mask_c = (mask >> (0 * c_num_ranks)) & c_mask_ranks;
+        const uint16_t mask_d = (mask >> (1 * c_num_ranks)) & c_mask_ranks;
+        const uint16_t mask_h = (mask >> (2 * c_num_ranks)) & c_mask_ranks;
+        const uint16_t mask_s = (mask >> (3 * c_num_ranks)) & c_mask_ranks;
+
+        return detail::evaluate_suit_masks(mask_c, mask_d, mask_h, mask_s);
+    }
+
+    // same as above for the 16 bit suit layout, the suits are already separated
+    [[nodiscard]] inline holdem_result evaluate_unsafe(const cardset16 cs) noexcept
+    {
+        const auto masks = cs.suit_masks();
+        return detail::evaluate_suit_masks(masks[0], masks[1], masks[2], masks[3]);
+    }
+
+    // evaluation for exactly K cards; otherwise, the behavior is undefined
+    // the number of distinct ranks tells which hand types are possible, e.g. 5 cards with 5 ranks are either a (straight) flush,
+    // a straight or no pair and 5 cards with 4 ranks are always one pair, so most checks and kicker lookups can be skipped
+    template <std::size_t K>
+        requires(K >= 5 && K <= 7)
+    [[nodiscard]] holdem_result evaluate(const cardset cs) noexcept
+    {
+        // break down into suits
+        const uint64_t mask = cs.as_bitset();
+        const uint16_t mask_c = (mask >> (0 * c_num_ranks)) & c_mask_ranks;
+        const uint16_t mask_d = (mask >> (1 * c_num_ranks)) & c_mask_ranks;
+        const uint16_t mask_h = (mask >> (2 * c_num_ranks)) & c_mask_ranks;
+        const uint16_t mask_s = (mask >> (3 * c_num_ranks)) & c_mask_ranks;
+        const uint16_t mask_all_cards = mask_c | mask_d | mask_h | mask_s;
+        const auto num_ranks = std::popcount(mask_all_cards);
+
+        if constexpr (K == 5)
         {
-            // get the two highest ranks from the mask (keep in mind - with 6/7 cards, there can be 3 pairs)
-            const auto high_rank = cross_idx_high16(mask_pair);
-            const auto low_rank = cross_idx_high16(mask_pair & ~(uint16_t(1) << high_rank));
-            // from the remaining cards, get the highest rank
-            const auto kicker_rank = cross_idx_high16(mask_all_cards & ~(uint16_t(1) << high_rank | uint16_t(1) << low_rank));
-            return holdem_result(c_two_pair, high_rank, low_rank, uint16_t(1) << kicker_rank);
+            // all kickers are used, so no top3/top5 lookups
+            switch (num_ranks)
+            {
+                case 5:
+                {
+#if MKP_EVAL_TABLE_SIZE >= 1
+                    const bool is_flush =
+                        mask_all_cards == mask_c || mask_all_cards == mask_d || mask_all_cards == mask_h || mask_all_cards == mask_s;
+                    return holdem_result_from_bitset((is_flush ? mkpoker_table_flush : mkpoker_table_unique)[mask_all_cards]);
+#else
+                    const auto rank_straight = mkpoker_table_straight[mask_all_cards];
+                    if (mask_all_cards == mask_c || mask_all_cards == mask_d || mask_all_cards == mask_h || mask_all_cards == mask_s)
+                    {
+                        return rank_straight > 0 ? holdem_result(c_straight_flush, rank_straight, 0, 0)
+                                                 : holdem_result(c_flush, 0, 0, mask_all_cards);
+                    }
+                    return rank_straight > 0 ? holdem_result(c_straight, rank_straight, 0, 0)
+                                             : holdem_result(c_no_pair, 0, 0, mask_all_cards);
+#endif
+                }
+                case 4:
+                {
+                    const uint16_t mask_pair = mask_all_cards ^ (mask_c ^ mask_d ^ mask_h ^ mask_s);
+                    return holdem_result(c_one_pair, cross_idx_high16(mask_pair), 0, mask_all_cards & ~mask_pair);
+                }
+                case 3:
+                {
+                    // trips + 2 kickers or two pair + kicker
+                    const uint16_t mask_trips = ((mask_c & mask_d) | (mask_h & mask_s)) & ((mask_c & mask_h) | (mask_d & mask_s));
+                    if (mask_trips)
+                    {
+                        return holdem_result(c_three_of_a_kind, cross_idx_high16(mask_trips), 0, mask_all_cards & ~mask_trips);
+                    }
+                    const uint16_t mask_pair = mask_all_cards ^ (mask_c ^ mask_d ^ mask_h ^ mask_s);
+                    return holdem_result(c_two_pair, cross_idx_high16(mask_pair), cross_idx_low16(mask_pair), mask_all_cards & ~mask_pair);
+                }
+                default:
+                {
+                    // quads + kicker or full house
+                    if (const uint16_t mask_quads = mask_c & mask_d & mask_h & mask_s; mask_quads)
+                    {
+                        return holdem_result(c_four_of_a_kind, cross_idx_high16(mask_quads), 0, mask_all_cards & ~mask_quads);
+                    }
+                    const uint16_t mask_trips = ((mask_c & mask_d) | (mask_h & mask_s)) & ((mask_c & mask_h) | (mask_d & mask_s));
+                    return holdem_result(c_full_house, cross_idx_high16(mask_trips), cross_idx_high16(mask_all_cards & ~mask_trips), 0);
+                }
+            }
         }
-        else if (num_pairs > 0)
+        else
         {
-            const uint16_t mask_kickers = mask_all_cards & ~(mask_pair);
-            return holdem_result(c_one_pair, cross_idx_high16(mask_pair), 0, mkpoker_table_top3[mask_kickers]);
-        }
+            // at most one suit can have 5 or more cards
+            if (const auto lanes = detail::flush_lanes(mask_c, mask_d, mask_h, mask_s); lanes)
+            {
+                const auto suit = std::countr_zero(lanes) / 16;
+                return detail::flush_or_straight_flush((mask >> (suit * c_num_ranks)) & c_mask_ranks);
+            }
+
+            // no pair or exactly one pair (the most common cases): only a straight can beat it
+            if (num_ranks >= static_cast<int>(K) - 1)
+            {
+#if MKP_EVAL_TABLE_SIZE >= 2
+                // straight or no pair / one pair with the pair rank as part of the index
+                if (const uint16_t mask_pair = mask_all_cards ^ (mask_c ^ mask_d ^ mask_h ^ mask_s); mask_pair)
+                {
+                    return holdem_result_from_bitset(
+                        mkpoker_table_pair[(std::size_t(cross_idx_high16(mask_pair)) << c_num_ranks) | mask_all_cards]);
+                }
+                return holdem_result_from_bitset(mkpoker_table_unique[mask_all_cards]);
+#else
+                if (const auto rank_straight = mkpoker_table_straight[mask_all_cards]; rank_straight > 0)
+                {
+                    return holdem_result(c_straight, rank_straight, 0, 0);
+                }
+                // no pair and one pair are hard to predict, so select without branches
+                const uint16_t mask_pair = mask_all_cards ^ (mask_c ^ mask_d ^ mask_h ^ mask_s);
+                const bool is_pair = mask_pair != 0;
+                const uint16_t kickers = is_pair ? mkpoker_table_top3[mask_all_cards & ~mask_pair] : mkpoker_table_top5[mask_all_cards];
+                return holdem_result(is_pair ? c_one_pair : c_no_pair, cross_idx_high16(mask_pair), 0, kickers);
+#endif
+            }
 
-        // 6)
-        // no pair
-        return holdem_result(c_no_pair, 0, 0, mkpoker_table_top5[mask_all_cards]);
+            return detail::evaluate_no_flush(mask_c, mask_d, mask_h, mask_s);
+        }
     }
 
     // safe call, will check if the cardset provides a suitable cardset
     [[nodiscard]] auto evaluate_safe(const cardset cs)
     {
-        if (const auto size = cs.size(); size > 7 || size < 5)
+        switch (const auto size = cs.size(); size)
         {
-            throw std::runtime_error("evaluate_safe() called with cardset of wrong size: " + std::to_string(size));
+            case 5:
+                return evaluate<5>(cs);
+            case 6:
+                return evaluate<6>(cs);
+            case 7:
+                return evaluate<7>(cs);
+            default:
+                throw std::runtime_error("evaluate_safe() called with cardset of wrong size: " + std::to_string(size));
         }
-        return evaluate_unsafe(cs);
     }
 
     // variadic overload
@@ -169,4 +375,29 @@ namespace mkp
         return evaluate_safe(cs.combine(value), args...);
     }
 
-}    // namespace mkp
\ No newline at end of file
+    namespace detail
+    {
+        MKP_FORCE_INLINE void evaluate_batch_impl(const cardset* hands, uint32_t* results, const std::size_t n) noexcept
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                results[i] = evaluate_unsafe(hands[i]).as_bitset();
+            }
+        }
+
+        MKP_DISPATCH_KERNELS(evaluate_batch, void, (const cardset* hands, uint32_t* results, const std::size_t n), (hands, results, n))
+    }    // namespace detail
+
+    // results[i] = evaluate_unsafe(hands[i]).as_bitset() for hands of 5 to 7 cards, compiled for the best instruction set of the cpu
+    // (popcnt, bmi), throws if the sizes do not match
+    inline void evaluate_batch(const std::span<const cardset> hands, const std::span<uint32_t> results)
+    {
+        if (hands.size() != results.size())
+        {
+            throw std::runtime_error("evaluate_batch(span<const cardset>, span<uint32_t>): sizes do not match");
+        }
+        static const auto kernel = cpu_dispatch(detail::evaluate_batch_kernels);
+        kernel(hands.data(), results.data(), hands.size());
+    }
+
+}    // namespace mkp
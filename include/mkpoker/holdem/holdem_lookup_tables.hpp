@@ -19,997 +19,135 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #pragma once
 
+#include <mkpoker/base/rank.hpp>
+#include <mkpoker/holdem/holdem_result.hpp>
+
+#include <array>
+#include <cstddef>
 #include <cstdint>
 
-constexpr uint8_t mkpoker_table_straight[] = {
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  7,  7,  7,  7,  7,  7,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-    8,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  7,  7,  7,  7,  7,  7,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  4,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
-    9,  9,  9,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  6,  6,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  7,  7,  7,  7,  7,  7,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
-    8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  6,  6,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  7,  7,  7,  7,  7,  7,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
-    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
-    10, 10, 10, 10, 10, 10, 10, 10, 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  6,  6,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  7,  7,  7,  7,  7,  7,  7,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  8,  8,  8,  8,  8,
-    8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,
-    6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  7,  7,  7,  7,  7,  7,  7,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
-    9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  7,  7,  7,  7,  7,  7,  7,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  8,
-    8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  7,  7,  7,  7,  7,  7,  7,  7,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  6,  6,  11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
-    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  7,  7,  7,  7,  7,  7,  7,  7,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  3,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  7,  7,  7,  7,  7,  7,
-    7,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
-    9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  7,  7,  7,  7,
-    7,  7,  7,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  6,  6,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  3,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  7,  7,
-    7,  7,  7,  7,  7,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  6,  6,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  10, 10, 10, 10, 10, 10,
-    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
-    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,
-    7,  7,  7,  7,  7,  7,  7,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  6,  6,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,
-    0,  0,  7,  7,  7,  7,  7,  7,  7,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,
-    6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  9,  9,  9,  9,
-    9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,
-    0,  0,  0,  0,  7,  7,  7,  7,  7,  7,  7,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,
-    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,
-    0,  0,  0,  0,  0,  0,  7,  7,  7,  7,  7,  7,  7,  7,  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12};
+// size of the lookup tables used by the evaluators, more memory for fewer branches:
+// 0: straight, top3 and top5 kickers by rank mask (~40 KB, default)
+// 1: + complete results of flushes and of hands without pairs by rank mask (+64 KB)
+// 2: + complete results of one pair hands by pair rank and rank mask (+416 KB)
+#ifndef MKP_EVAL_TABLE_SIZE
+#define MKP_EVAL_TABLE_SIZE 0
+#endif
+
+namespace mkp
+{
+    inline namespace constants
+    {
+        // number of different rank masks, i.e. the size of all tables indexed by a rank mask
+        constexpr std::size_t c_num_rank_masks = std::size_t(1) << c_num_ranks;
+    }    // namespace constants
+
+    namespace detail
+    {
+        // highest rank of the best straight in a rank mask, 0 if there is none (a six high straight has to be 4 > 0)
+        // the lowest straight is the ace with the four lowest ranks, min_rank is the lowest rank of the deck
+        [[nodiscard]] consteval std::array<uint8_t, c_num_rank_masks> make_table_straight(const uint8_t min_rank)
+        {
+            const uint16_t wheel = (uint16_t(1) << c_rank_ace) | (uint16_t(0b1111) << min_rank);
+            std::array<uint8_t, c_num_rank_masks> ret{};
+            for (std::size_t mask = 0; mask < c_num_rank_masks; ++mask)
+            {
+                for (uint8_t high = c_rank_ace; high >= min_rank + 4; --high)
+                {
+                    if (const std::size_t straight = std::size_t(0b1'1111) << (high - 4); (mask & straight) == straight)
+                    {
+                        ret[mask] = high;
+                        break;
+                    }
+                }
+                if (ret[mask] == 0 && (mask & wheel) == wheel)
+                {
+                    ret[mask] = static_cast<uint8_t>(min_rank + 3);
+                }
+            }
+            return ret;
+        }
+
+        // the (at most) n highest ranks of a rank mask, i.e. the kickers
+        [[nodiscard]] consteval std::array<uint16_t, c_num_rank_masks> make_table_top(const unsigned n)
+        {
+            std::array<uint16_t, c_num_rank_masks> ret{};
+            for (std::size_t mask = 0; mask < c_num_rank_masks; ++mask)
+            {
+                unsigned count = 0;
+                for (int r = c_rank_ace; r >= c_rank_two && count < n; --r)
+                {
+                    if (mask & (std::size_t(1) << r))
+                    {
+                        ret[mask] |= uint16_t(1) << r;
+                        ++count;
+                    }
+                }
+            }
+            return ret;
+        }
+    }    // namespace detail
+}    // namespace mkp
+
+inline constexpr auto mkpoker_table_straight = mkp::detail::make_table_straight(mkp::c_rank_two);
+inline constexpr auto mkpoker_table_top3 = mkp::detail::make_table_top(3);
+inline constexpr auto mkpoker_table_top5 = mkp::detail::make_table_top(5);
+
+#if MKP_EVAL_TABLE_SIZE >= 1
+namespace mkp::detail
+{
+    // result bits of a (straight) flush by the rank mask of the flush suit (only valid for 5 to 7 ranks)
+    [[nodiscard]] consteval std::array<uint32_t, c_num_rank_masks> make_table_flush()
+    {
+        std::array<uint32_t, c_num_rank_masks> ret{};
+        for (std::size_t mask = 0; mask < c_num_rank_masks; ++mask)
+        {
+            const auto high = mkpoker_table_straight[mask];
+            ret[mask] = (high > 0 ? holdem_result(c_straight_flush, high, 0, 0) : holdem_result(c_flush, 0, 0, mkpoker_table_top5[mask]))
+                            .as_bitset();
+        }
+        return ret;
+    }
+
+    // result bits of a hand without pairs by its rank mask, i.e. straight or no pair
+    [[nodiscard]] consteval std::array<uint32_t, c_num_rank_masks> make_table_unique()
+    {
+        std::array<uint32_t, c_num_rank_masks> ret{};
+        for (std::size_t mask = 0; mask < c_num_rank_masks; ++mask)
+        {
+            const auto high = mkpoker_table_straight[mask];
+            ret[mask] = (high > 0 ? holdem_result(c_straight, high, 0, 0) : holdem_result(c_no_pair, 0, 0, mkpoker_table_top5[mask]))
+                            .as_bitset();
+        }
+        return ret;
+    }
+}    // namespace mkp::detail
+
+inline constexpr auto mkpoker_table_flush = mkp::detail::make_table_flush();
+inline constexpr auto mkpoker_table_unique = mkp::detail::make_table_unique();
+#endif
 
-constexpr uint16_t mkpoker_table_top3[] = {
-    0,    1,    2,    3,    4,    5,    6,    7,    8,    9,    10,   11,   12,   13,   14,   14,   16,   17,   18,   19,   20,   21,
-    22,   22,   24,   25,   26,   26,   28,   28,   28,   28,   32,   33,   34,   35,   36,   37,   38,   38,   40,   41,   42,   42,
-    44,   44,   44,   44,   48,   49,   50,   50,   52,   52,   52,   52,   56,   56,   56,   56,   56,   56,   56,   56,   64,   65,
-    66,   67,   68,   69,   70,   70,   72,   73,   74,   74,   76,   76,   76,   76,   80,   81,   82,   82,   84,   84,   84,   84,
-    88,   88,   88,   88,   88,   88,   88,   88,   96,   97,   98,   98,   100,  100,  100,  100,  104,  104,  104,  104,  104,  104,
-    104,  104,  112,  112,  112,  112,  112,  112,  112,  112,  112,  112,  112,  112,  112,  112,  112,  112,  128,  129,  130,  131,
-    132,  133,  134,  134,  136,  137,  138,  138,  140,  140,  140,  140,  144,  145,  146,  146,  148,  148,  148,  148,  152,  152,
-    152,  152,  152,  152,  152,  152,  160,  161,  162,  162,  164,  164,  164,  164,  168,  168,  168,  168,  168,  168,  168,  168,
-    176,  176,  176,  176,  176,  176,  176,  176,  176,  176,  176,  176,  176,  176,  176,  176,  192,  193,  194,  194,  196,  196,
-    196,  196,  200,  200,  200,  200,  200,  200,  200,  200,  208,  208,  208,  208,  208,  208,  208,  208,  208,  208,  208,  208,
-    208,  208,  208,  208,  224,  224,  224,  224,  224,  224,  224,  224,  224,  224,  224,  224,  224,  224,  224,  224,  224,  224,
-    224,  224,  224,  224,  224,  224,  224,  224,  224,  224,  224,  224,  224,  224,  256,  257,  258,  259,  260,  261,  262,  262,
-    264,  265,  266,  266,  268,  268,  268,  268,  272,  273,  274,  274,  276,  276,  276,  276,  280,  280,  280,  280,  280,  280,
-    280,  280,  288,  289,  290,  290,  292,  292,  292,  292,  296,  296,  296,  296,  296,  296,  296,  296,  304,  304,  304,  304,
-    304,  304,  304,  304,  304,  304,  304,  304,  304,  304,  304,  304,  320,  321,  322,  322,  324,  324,  324,  324,  328,  328,
-    328,  328,  328,  328,  328,  328,  336,  336,  336,  336,  336,  336,  336,  336,  336,  336,  336,  336,  336,  336,  336,  336,
-    352,  352,  352,  352,  352,  352,  352,  352,  352,  352,  352,  352,  352,  352,  352,  352,  352,  352,  352,  352,  352,  352,
-    352,  352,  352,  352,  352,  352,  352,  352,  352,  352,  384,  385,  386,  386,  388,  388,  388,  388,  392,  392,  392,  392,
-    392,  392,  392,  392,  400,  400,  400,  400,  400,  400,  400,  400,  400,  400,  400,  400,  400,  400,  400,  400,  416,  416,
-    416,  416,  416,  416,  416,  416,  416,  416,  416,  416,  416,  416,  416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-    416,  416,  416,  416,  416,  416,  416,  416,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,
-    448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,
-    448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,  448,
-    448,  448,  448,  448,  448,  448,  512,  513,  514,  515,  516,  517,  518,  518,  520,  521,  522,  522,  524,  524,  524,  524,
-    528,  529,  530,  530,  532,  532,  532,  532,  536,  536,  536,  536,  536,  536,  536,  536,  544,  545,  546,  546,  548,  548,
-    548,  548,  552,  552,  552,  552,  552,  552,  552,  552,  560,  560,  560,  560,  560,  560,  560,  560,  560,  560,  560,  560,
-    560,  560,  560,  560,  576,  577,  578,  578,  580,  580,  580,  580,  584,  584,  584,  584,  584,  584,  584,  584,  592,  592,
-    592,  592,  592,  592,  592,  592,  592,  592,  592,  592,  592,  592,  592,  592,  608,  608,  608,  608,  608,  608,  608,  608,
-    608,  608,  608,  608,  608,  608,  608,  608,  608,  608,  608,  608,  608,  608,  608,  608,  608,  608,  608,  608,  608,  608,
-    608,  608,  640,  641,  642,  642,  644,  644,  644,  644,  648,  648,  648,  648,  648,  648,  648,  648,  656,  656,  656,  656,
-    656,  656,  656,  656,  656,  656,  656,  656,  656,  656,  656,  656,  672,  672,  672,  672,  672,  672,  672,  672,  672,  672,
-    672,  672,  672,  672,  672,  672,  672,  672,  672,  672,  672,  672,  672,  672,  672,  672,  672,  672,  672,  672,  672,  672,
-    704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,
-    704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,
-    704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  704,  768,  769,
-    770,  770,  772,  772,  772,  772,  776,  776,  776,  776,  776,  776,  776,  776,  784,  784,  784,  784,  784,  784,  784,  784,
-    784,  784,  784,  784,  784,  784,  784,  784,  800,  800,  800,  800,  800,  800,  800,  800,  800,  800,  800,  800,  800,  800,
-    800,  800,  800,  800,  800,  800,  800,  800,  800,  800,  800,  800,  800,  800,  800,  800,  800,  800,  832,  832,  832,  832,
-    832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,
-    832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,
-    832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  832,  896,  896,  896,  896,  896,  896,
-    896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,
-    896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,
-    896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,
-    896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,
-    896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,
-    896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  896,  1024, 1025, 1026, 1027, 1028, 1029, 1030, 1030, 1032, 1033,
-    1034, 1034, 1036, 1036, 1036, 1036, 1040, 1041, 1042, 1042, 1044, 1044, 1044, 1044, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048,
-    1056, 1057, 1058, 1058, 1060, 1060, 1060, 1060, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1072, 1072, 1072, 1072, 1072, 1072,
-    1072, 1072, 1072, 1072, 1072, 1072, 1072, 1072, 1072, 1072, 1088, 1089, 1090, 1090, 1092, 1092, 1092, 1092, 1096, 1096, 1096, 1096,
-    1096, 1096, 1096, 1096, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1120, 1120,
-    1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120,
-    1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1152, 1153, 1154, 1154, 1156, 1156, 1156, 1156, 1160, 1160, 1160, 1160, 1160, 1160,
-    1160, 1160, 1168, 1168, 1168, 1168, 1168, 1168, 1168, 1168, 1168, 1168, 1168, 1168, 1168, 1168, 1168, 1168, 1184, 1184, 1184, 1184,
-    1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184, 1184,
-    1184, 1184, 1184, 1184, 1184, 1184, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
-    1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
-    1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216,
-    1216, 1216, 1216, 1216, 1280, 1281, 1282, 1282, 1284, 1284, 1284, 1284, 1288, 1288, 1288, 1288, 1288, 1288, 1288, 1288, 1296, 1296,
-    1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1312, 1312, 1312, 1312, 1312, 1312, 1312, 1312,
-    1312, 1312, 1312, 1312, 1312, 1312, 1312, 1312, 1312, 1312, 1312, 1312, 1312, 1312, 1312, 1312, 1312, 1312, 1312, 1312, 1312, 1312,
-    1312, 1312, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
-    1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
-    1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344,
-    1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408,
-    1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408,
-    1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408,
-    1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408,
-    1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408,
-    1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1536, 1537, 1538, 1538,
-    1540, 1540, 1540, 1540, 1544, 1544, 1544, 1544, 1544, 1544, 1544, 1544, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552,
-    1552, 1552, 1552, 1552, 1552, 1552, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568,
-    1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1600, 1600, 1600, 1600, 1600, 1600,
-    1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600,
-    1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600,
-    1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664,
-    1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664,
-    1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664,
-    1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664,
-    1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664,
-    1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664,
-    1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792,
-    1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792,
-    1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792,
-    1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792,
-    1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792,
-    1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792,
-    1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792,
-    1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792,
-    1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792,
-    1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792,
-    1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792,
-    1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792,
-    1792, 1792, 2048, 2049, 2050, 2051, 2052, 2053, 2054, 2054, 2056, 2057, 2058, 2058, 2060, 2060, 2060, 2060, 2064, 2065, 2066, 2066,
-    2068, 2068, 2068, 2068, 2072, 2072, 2072, 2072, 2072, 2072, 2072, 2072, 2080, 2081, 2082, 2082, 2084, 2084, 2084, 2084, 2088, 2088,
-    2088, 2088, 2088, 2088, 2088, 2088, 2096, 2096, 2096, 2096, 2096, 2096, 2096, 2096, 2096, 2096, 2096, 2096, 2096, 2096, 2096, 2096,
-    2112, 2113, 2114, 2114, 2116, 2116, 2116, 2116, 2120, 2120, 2120, 2120, 2120, 2120, 2120, 2120, 2128, 2128, 2128, 2128, 2128, 2128,
-    2128, 2128, 2128, 2128, 2128, 2128, 2128, 2128, 2128, 2128, 2144, 2144, 2144, 2144, 2144, 2144, 2144, 2144, 2144, 2144, 2144, 2144,
-    2144, 2144, 2144, 2144, 2144, 2144, 2144, 2144, 2144, 2144, 2144, 2144, 2144, 2144, 2144, 2144, 2144, 2144, 2144, 2144, 2176, 2177,
-    2178, 2178, 2180, 2180, 2180, 2180, 2184, 2184, 2184, 2184, 2184, 2184, 2184, 2184, 2192, 2192, 2192, 2192, 2192, 2192, 2192, 2192,
-    2192, 2192, 2192, 2192, 2192, 2192, 2192, 2192, 2208, 2208, 2208, 2208, 2208, 2208, 2208, 2208, 2208, 2208, 2208, 2208, 2208, 2208,
-    2208, 2208, 2208, 2208, 2208, 2208, 2208, 2208, 2208, 2208, 2208, 2208, 2208, 2208, 2208, 2208, 2208, 2208, 2240, 2240, 2240, 2240,
-    2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240,
-    2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240,
-    2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2304, 2305, 2306, 2306, 2308, 2308,
-    2308, 2308, 2312, 2312, 2312, 2312, 2312, 2312, 2312, 2312, 2320, 2320, 2320, 2320, 2320, 2320, 2320, 2320, 2320, 2320, 2320, 2320,
-    2320, 2320, 2320, 2320, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336,
-    2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368,
-    2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368,
-    2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368,
-    2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2368, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432,
-    2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432,
-    2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432,
-    2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432,
-    2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432,
-    2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432,
-    2432, 2432, 2432, 2432, 2432, 2432, 2432, 2432, 2560, 2561, 2562, 2562, 2564, 2564, 2564, 2564, 2568, 2568, 2568, 2568, 2568, 2568,
-    2568, 2568, 2576, 2576, 2576, 2576, 2576, 2576, 2576, 2576, 2576, 2576, 2576, 2576, 2576, 2576, 2576, 2576, 2592, 2592, 2592, 2592,
-    2592, 2592, 2592, 2592, 2592, 2592, 2592, 2592, 2592, 2592, 2592, 2592, 2592, 2592, 2592, 2592, 2592, 2592, 2592, 2592, 2592, 2592,
-    2592, 2592, 2592, 2592, 2592, 2592, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
-    2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
-    2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624, 2624,
-    2624, 2624, 2624, 2624, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688,
-    2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688,
-    2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688,
-    2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688,
-    2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688,
-    2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688, 2688,
-    2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816,
-    2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816,
-    2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816,
-    2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816,
-    2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816,
-    2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816,
-    2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816,
-    2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816,
-    2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816,
-    2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816,
-    2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816,
-    2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 3072, 3073, 3074, 3074, 3076, 3076, 3076, 3076,
-    3080, 3080, 3080, 3080, 3080, 3080, 3080, 3080, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088, 3088,
-    3088, 3088, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104,
-    3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3104, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136,
-    3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136,
-    3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136,
-    3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3136, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200,
-    3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200,
-    3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200,
-    3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200,
-    3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200,
-    3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200,
-    3200, 3200, 3200, 3200, 3200, 3200, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328,
-    3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328,
-    3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328,
-    3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328,
-    3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328,
-    3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328,
-    3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328,
-    3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328,
-    3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328,
-    3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328,
-    3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328,
-    3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3328, 3584, 3584,
-    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
-    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
-    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
-    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
-    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
-    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
-    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
-    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
-    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
-    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
-    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
-    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
-    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
-    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
-    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
-    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
-    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
-    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
-    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
-    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
-    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
-    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
-    3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584, 3584,
-    3584, 3584, 3584, 3584, 4096, 4097, 4098, 4099, 4100, 4101, 4102, 4102, 4104, 4105, 4106, 4106, 4108, 4108, 4108, 4108, 4112, 4113,
-    4114, 4114, 4116, 4116, 4116, 4116, 4120, 4120, 4120, 4120, 4120, 4120, 4120, 4120, 4128, 4129, 4130, 4130, 4132, 4132, 4132, 4132,
-    4136, 4136, 4136, 4136, 4136, 4136, 4136, 4136, 4144, 4144, 4144, 4144, 4144, 4144, 4144, 4144, 4144, 4144, 4144, 4144, 4144, 4144,
-    4144, 4144, 4160, 4161, 4162, 4162, 4164, 4164, 4164, 4164, 4168, 4168, 4168, 4168, 4168, 4168, 4168, 4168, 4176, 4176, 4176, 4176,
-    4176, 4176, 4176, 4176, 4176, 4176, 4176, 4176, 4176, 4176, 4176, 4176, 4192, 4192, 4192, 4192, 4192, 4192, 4192, 4192, 4192, 4192,
-    4192, 4192, 4192, 4192, 4192, 4192, 4192, 4192, 4192, 4192, 4192, 4192, 4192, 4192, 4192, 4192, 4192, 4192, 4192, 4192, 4192, 4192,
-    4224, 4225, 4226, 4226, 4228, 4228, 4228, 4228, 4232, 4232, 4232, 4232, 4232, 4232, 4232, 4232, 4240, 4240, 4240, 4240, 4240, 4240,
-    4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4240, 4256, 4256, 4256, 4256, 4256, 4256, 4256, 4256, 4256, 4256, 4256, 4256,
-    4256, 4256, 4256, 4256, 4256, 4256, 4256, 4256, 4256, 4256, 4256, 4256, 4256, 4256, 4256, 4256, 4256, 4256, 4256, 4256, 4288, 4288,
-    4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288,
-    4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288,
-    4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4288, 4352, 4353, 4354, 4354,
-    4356, 4356, 4356, 4356, 4360, 4360, 4360, 4360, 4360, 4360, 4360, 4360, 4368, 4368, 4368, 4368, 4368, 4368, 4368, 4368, 4368, 4368,
-    4368, 4368, 4368, 4368, 4368, 4368, 4384, 4384, 4384, 4384, 4384, 4384, 4384, 4384, 4384, 4384, 4384, 4384, 4384, 4384, 4384, 4384,
-    4384, 4384, 4384, 4384, 4384, 4384, 4384, 4384, 4384, 4384, 4384, 4384, 4384, 4384, 4384, 4384, 4416, 4416, 4416, 4416, 4416, 4416,
-    4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416,
-    4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416,
-    4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4416, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480,
-    4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480,
-    4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480,
-    4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480,
-    4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480,
-    4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480,
-    4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4480, 4608, 4609, 4610, 4610, 4612, 4612, 4612, 4612, 4616, 4616, 4616, 4616,
-    4616, 4616, 4616, 4616, 4624, 4624, 4624, 4624, 4624, 4624, 4624, 4624, 4624, 4624, 4624, 4624, 4624, 4624, 4624, 4624, 4640, 4640,
-    4640, 4640, 4640, 4640, 4640, 4640, 4640, 4640, 4640, 4640, 4640, 4640, 4640, 4640, 4640, 4640, 4640, 4640, 4640, 4640, 4640, 4640,
-    4640, 4640, 4640, 4640, 4640, 4640, 4640, 4640, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672,
-    4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672,
-    4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672, 4672,
-    4672, 4672, 4672, 4672, 4672, 4672, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736,
-    4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736,
-    4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736,
-    4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736,
-    4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736,
-    4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736, 4736,
-    4736, 4736, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864,
-    4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864,
-    4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864,
-    4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864,
-    4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864,
-    4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864,
-    4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864,
-    4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864,
-    4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864,
-    4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864,
-    4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864,
-    4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 5120, 5121, 5122, 5122, 5124, 5124,
-    5124, 5124, 5128, 5128, 5128, 5128, 5128, 5128, 5128, 5128, 5136, 5136, 5136, 5136, 5136, 5136, 5136, 5136, 5136, 5136, 5136, 5136,
-    5136, 5136, 5136, 5136, 5152, 5152, 5152, 5152, 5152, 5152, 5152, 5152, 5152, 5152, 5152, 5152, 5152, 5152, 5152, 5152, 5152, 5152,
-    5152, 5152, 5152, 5152, 5152, 5152, 5152, 5152, 5152, 5152, 5152, 5152, 5152, 5152, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184,
-    5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184,
-    5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184,
-    5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5184, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248,
-    5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248,
-    5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248,
-    5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248,
-    5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248,
-    5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248,
-    5248, 5248, 5248, 5248, 5248, 5248, 5248, 5248, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376,
-    5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376,
-    5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376,
-    5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376,
-    5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376,
-    5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376,
-    5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376,
-    5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376,
-    5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376,
-    5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376,
-    5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376,
-    5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376, 5376,
-    5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632,
-    5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632,
-    5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632,
-    5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632,
-    5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632,
-    5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632,
-    5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632,
-    5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632,
-    5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632,
-    5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632,
-    5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632,
-    5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632,
-    5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632,
-    5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632,
-    5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632,
-    5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632,
-    5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632,
-    5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632,
-    5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632,
-    5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632,
-    5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632,
-    5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632,
-    5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632, 5632,
-    5632, 5632, 5632, 5632, 5632, 5632, 6144, 6145, 6146, 6146, 6148, 6148, 6148, 6148, 6152, 6152, 6152, 6152, 6152, 6152, 6152, 6152,
-    6160, 6160, 6160, 6160, 6160, 6160, 6160, 6160, 6160, 6160, 6160, 6160, 6160, 6160, 6160, 6160, 6176, 6176, 6176, 6176, 6176, 6176,
-    6176, 6176, 6176, 6176, 6176, 6176, 6176, 6176, 6176, 6176, 6176, 6176, 6176, 6176, 6176, 6176, 6176, 6176, 6176, 6176, 6176, 6176,
-    6176, 6176, 6176, 6176, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208,
-    6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208,
-    6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208, 6208,
-    6208, 6208, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272,
-    6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272,
-    6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272,
-    6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272,
-    6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272,
-    6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6272, 6400, 6400,
-    6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400,
-    6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400,
-    6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400,
-    6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400,
-    6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400,
-    6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400,
-    6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400,
-    6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400,
-    6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400,
-    6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400,
-    6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400,
-    6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6400, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
-    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
-    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
-    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
-    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
-    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
-    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
-    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
-    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
-    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
-    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
-    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
-    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
-    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
-    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
-    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
-    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
-    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
-    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
-    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
-    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
-    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
-    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
-    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168,
-    7168, 7168, 7168, 7168, 7168, 7168, 7168, 7168};
+#if MKP_EVAL_TABLE_SIZE >= 2
+namespace mkp::detail
+{
+    // result bits of a hand with exactly one pair (and no trips) by (pair rank << 13) | rank mask, i.e. straight or one pair
+    [[nodiscard]] consteval std::array<uint32_t, c_num_ranks * c_num_rank_masks> make_table_pair()
+    {
+        std::array<uint32_t, c_num_ranks * c_num_rank_masks> ret{};
+        for (uint8_t pair = c_rank_two; pair <= c_rank_ace; ++pair)
+        {
+            for (std::size_t mask = 0; mask < c_num_rank_masks; ++mask)
+            {
+                const auto high = mkpoker_table_straight[mask];
+                ret[(std::size_t(pair) << c_num_ranks) | mask] =
+                    (high > 0 ? holdem_result(c_straight, high, 0, 0)
+                              : holdem_result(c_one_pair, pair, 0, mkpoker_table_top3[mask & ~(std::size_t(1) << pair)]))
+                        .as_bitset();
+            }
+        }
+        return ret;
+    }
+}    // namespace mkp::detail
 
-constexpr uint16_t mkpoker_table_top5[] = {
-    0,    1,    2,    3,    4,    5,    6,    7,    8,    9,    10,   11,   12,   13,   14,   15,   16,   17,   18,   19,   20,   21,
-    22,   23,   24,   25,   26,   27,   28,   29,   30,   31,   32,   33,   34,   35,   36,   37,   38,   39,   40,   41,   42,   43,
-    44,   45,   46,   47,   48,   49,   50,   51,   52,   53,   54,   55,   56,   57,   58,   59,   60,   61,   62,   62,   64,   65,
-    66,   67,   68,   69,   70,   71,   72,   73,   74,   75,   76,   77,   78,   79,   80,   81,   82,   83,   84,   85,   86,   87,
-    88,   89,   90,   91,   92,   93,   94,   94,   96,   97,   98,   99,   100,  101,  102,  103,  104,  105,  106,  107,  108,  109,
-    110,  110,  112,  113,  114,  115,  116,  117,  118,  118,  120,  121,  122,  122,  124,  124,  124,  124,  128,  129,  130,  131,
-    132,  133,  134,  135,  136,  137,  138,  139,  140,  141,  142,  143,  144,  145,  146,  147,  148,  149,  150,  151,  152,  153,
-    154,  155,  156,  157,  158,  158,  160,  161,  162,  163,  164,  165,  166,  167,  168,  169,  170,  171,  172,  173,  174,  174,
-    176,  177,  178,  179,  180,  181,  182,  182,  184,  185,  186,  186,  188,  188,  188,  188,  192,  193,  194,  195,  196,  197,
-    198,  199,  200,  201,  202,  203,  204,  205,  206,  206,  208,  209,  210,  211,  212,  213,  214,  214,  216,  217,  218,  218,
-    220,  220,  220,  220,  224,  225,  226,  227,  228,  229,  230,  230,  232,  233,  234,  234,  236,  236,  236,  236,  240,  241,
-    242,  242,  244,  244,  244,  244,  248,  248,  248,  248,  248,  248,  248,  248,  256,  257,  258,  259,  260,  261,  262,  263,
-    264,  265,  266,  267,  268,  269,  270,  271,  272,  273,  274,  275,  276,  277,  278,  279,  280,  281,  282,  283,  284,  285,
-    286,  286,  288,  289,  290,  291,  292,  293,  294,  295,  296,  297,  298,  299,  300,  301,  302,  302,  304,  305,  306,  307,
-    308,  309,  310,  310,  312,  313,  314,  314,  316,  316,  316,  316,  320,  321,  322,  323,  324,  325,  326,  327,  328,  329,
-    330,  331,  332,  333,  334,  334,  336,  337,  338,  339,  340,  341,  342,  342,  344,  345,  346,  346,  348,  348,  348,  348,
-    352,  353,  354,  355,  356,  357,  358,  358,  360,  361,  362,  362,  364,  364,  364,  364,  368,  369,  370,  370,  372,  372,
-    372,  372,  376,  376,  376,  376,  376,  376,  376,  376,  384,  385,  386,  387,  388,  389,  390,  391,  392,  393,  394,  395,
-    396,  397,  398,  398,  400,  401,  402,  403,  404,  405,  406,  406,  408,  409,  410,  410,  412,  412,  412,  412,  416,  417,
-    418,  419,  420,  421,  422,  422,  424,  425,  426,  426,  428,  428,  428,  428,  432,  433,  434,  434,  436,  436,  436,  436,
-    440,  440,  440,  440,  440,  440,  440,  440,  448,  449,  450,  451,  452,  453,  454,  454,  456,  457,  458,  458,  460,  460,
-    460,  460,  464,  465,  466,  466,  468,  468,  468,  468,  472,  472,  472,  472,  472,  472,  472,  472,  480,  481,  482,  482,
-    484,  484,  484,  484,  488,  488,  488,  488,  488,  488,  488,  488,  496,  496,  496,  496,  496,  496,  496,  496,  496,  496,
-    496,  496,  496,  496,  496,  496,  512,  513,  514,  515,  516,  517,  518,  519,  520,  521,  522,  523,  524,  525,  526,  527,
-    528,  529,  530,  531,  532,  533,  534,  535,  536,  537,  538,  539,  540,  541,  542,  542,  544,  545,  546,  547,  548,  549,
-    550,  551,  552,  553,  554,  555,  556,  557,  558,  558,  560,  561,  562,  563,  564,  565,  566,  566,  568,  569,  570,  570,
-    572,  572,  572,  572,  576,  577,  578,  579,  580,  581,  582,  583,  584,  585,  586,  587,  588,  589,  590,  590,  592,  593,
-    594,  595,  596,  597,  598,  598,  600,  601,  602,  602,  604,  604,  604,  604,  608,  609,  610,  611,  612,  613,  614,  614,
-    616,  617,  618,  618,  620,  620,  620,  620,  624,  625,  626,  626,  628,  628,  628,  628,  632,  632,  632,  632,  632,  632,
-    632,  632,  640,  641,  642,  643,  644,  645,  646,  647,  648,  649,  650,  651,  652,  653,  654,  654,  656,  657,  658,  659,
-    660,  661,  662,  662,  664,  665,  666,  666,  668,  668,  668,  668,  672,  673,  674,  675,  676,  677,  678,  678,  680,  681,
-    682,  682,  684,  684,  684,  684,  688,  689,  690,  690,  692,  692,  692,  692,  696,  696,  696,  696,  696,  696,  696,  696,
-    704,  705,  706,  707,  708,  709,  710,  710,  712,  713,  714,  714,  716,  716,  716,  716,  720,  721,  722,  722,  724,  724,
-    724,  724,  728,  728,  728,  728,  728,  728,  728,  728,  736,  737,  738,  738,  740,  740,  740,  740,  744,  744,  744,  744,
-    744,  744,  744,  744,  752,  752,  752,  752,  752,  752,  752,  752,  752,  752,  752,  752,  752,  752,  752,  752,  768,  769,
-    770,  771,  772,  773,  774,  775,  776,  777,  778,  779,  780,  781,  782,  782,  784,  785,  786,  787,  788,  789,  790,  790,
-    792,  793,  794,  794,  796,  796,  796,  796,  800,  801,  802,  803,  804,  805,  806,  806,  808,  809,  810,  810,  812,  812,
-    812,  812,  816,  817,  818,  818,  820,  820,  820,  820,  824,  824,  824,  824,  824,  824,  824,  824,  832,  833,  834,  835,
-    836,  837,  838,  838,  840,  841,  842,  842,  844,  844,  844,  844,  848,  849,  850,  850,  852,  852,  852,  852,  856,  856,
-    856,  856,  856,  856,  856,  856,  864,  865,  866,  866,  868,  868,  868,  868,  872,  872,  872,  872,  872,  872,  872,  872,
-    880,  880,  880,  880,  880,  880,  880,  880,  880,  880,  880,  880,  880,  880,  880,  880,  896,  897,  898,  899,  900,  901,
-    902,  902,  904,  905,  906,  906,  908,  908,  908,  908,  912,  913,  914,  914,  916,  916,  916,  916,  920,  920,  920,  920,
-    920,  920,  920,  920,  928,  929,  930,  930,  932,  932,  932,  932,  936,  936,  936,  936,  936,  936,  936,  936,  944,  944,
-    944,  944,  944,  944,  944,  944,  944,  944,  944,  944,  944,  944,  944,  944,  960,  961,  962,  962,  964,  964,  964,  964,
-    968,  968,  968,  968,  968,  968,  968,  968,  976,  976,  976,  976,  976,  976,  976,  976,  976,  976,  976,  976,  976,  976,
-    976,  976,  992,  992,  992,  992,  992,  992,  992,  992,  992,  992,  992,  992,  992,  992,  992,  992,  992,  992,  992,  992,
-    992,  992,  992,  992,  992,  992,  992,  992,  992,  992,  992,  992,  1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033,
-    1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1054,
-    1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1070, 1072, 1073, 1074, 1075, 1076, 1077,
-    1078, 1078, 1080, 1081, 1082, 1082, 1084, 1084, 1084, 1084, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099,
-    1100, 1101, 1102, 1102, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1110, 1112, 1113, 1114, 1114, 1116, 1116, 1116, 1116, 1120, 1121,
-    1122, 1123, 1124, 1125, 1126, 1126, 1128, 1129, 1130, 1130, 1132, 1132, 1132, 1132, 1136, 1137, 1138, 1138, 1140, 1140, 1140, 1140,
-    1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165,
-    1166, 1166, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1174, 1176, 1177, 1178, 1178, 1180, 1180, 1180, 1180, 1184, 1185, 1186, 1187,
-    1188, 1189, 1190, 1190, 1192, 1193, 1194, 1194, 1196, 1196, 1196, 1196, 1200, 1201, 1202, 1202, 1204, 1204, 1204, 1204, 1208, 1208,
-    1208, 1208, 1208, 1208, 1208, 1208, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1222, 1224, 1225, 1226, 1226, 1228, 1228, 1228, 1228,
-    1232, 1233, 1234, 1234, 1236, 1236, 1236, 1236, 1240, 1240, 1240, 1240, 1240, 1240, 1240, 1240, 1248, 1249, 1250, 1250, 1252, 1252,
-    1252, 1252, 1256, 1256, 1256, 1256, 1256, 1256, 1256, 1256, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264,
-    1264, 1264, 1264, 1264, 1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1294, 1296, 1297,
-    1298, 1299, 1300, 1301, 1302, 1302, 1304, 1305, 1306, 1306, 1308, 1308, 1308, 1308, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1318,
-    1320, 1321, 1322, 1322, 1324, 1324, 1324, 1324, 1328, 1329, 1330, 1330, 1332, 1332, 1332, 1332, 1336, 1336, 1336, 1336, 1336, 1336,
-    1336, 1336, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1350, 1352, 1353, 1354, 1354, 1356, 1356, 1356, 1356, 1360, 1361, 1362, 1362,
-    1364, 1364, 1364, 1364, 1368, 1368, 1368, 1368, 1368, 1368, 1368, 1368, 1376, 1377, 1378, 1378, 1380, 1380, 1380, 1380, 1384, 1384,
-    1384, 1384, 1384, 1384, 1384, 1384, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392,
-    1408, 1409, 1410, 1411, 1412, 1413, 1414, 1414, 1416, 1417, 1418, 1418, 1420, 1420, 1420, 1420, 1424, 1425, 1426, 1426, 1428, 1428,
-    1428, 1428, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1440, 1441, 1442, 1442, 1444, 1444, 1444, 1444, 1448, 1448, 1448, 1448,
-    1448, 1448, 1448, 1448, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1472, 1473,
-    1474, 1474, 1476, 1476, 1476, 1476, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
-    1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
-    1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1536, 1537, 1538, 1539,
-    1540, 1541, 1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549, 1550, 1550, 1552, 1553, 1554, 1555, 1556, 1557, 1558, 1558, 1560, 1561,
-    1562, 1562, 1564, 1564, 1564, 1564, 1568, 1569, 1570, 1571, 1572, 1573, 1574, 1574, 1576, 1577, 1578, 1578, 1580, 1580, 1580, 1580,
-    1584, 1585, 1586, 1586, 1588, 1588, 1588, 1588, 1592, 1592, 1592, 1592, 1592, 1592, 1592, 1592, 1600, 1601, 1602, 1603, 1604, 1605,
-    1606, 1606, 1608, 1609, 1610, 1610, 1612, 1612, 1612, 1612, 1616, 1617, 1618, 1618, 1620, 1620, 1620, 1620, 1624, 1624, 1624, 1624,
-    1624, 1624, 1624, 1624, 1632, 1633, 1634, 1634, 1636, 1636, 1636, 1636, 1640, 1640, 1640, 1640, 1640, 1640, 1640, 1640, 1648, 1648,
-    1648, 1648, 1648, 1648, 1648, 1648, 1648, 1648, 1648, 1648, 1648, 1648, 1648, 1648, 1664, 1665, 1666, 1667, 1668, 1669, 1670, 1670,
-    1672, 1673, 1674, 1674, 1676, 1676, 1676, 1676, 1680, 1681, 1682, 1682, 1684, 1684, 1684, 1684, 1688, 1688, 1688, 1688, 1688, 1688,
-    1688, 1688, 1696, 1697, 1698, 1698, 1700, 1700, 1700, 1700, 1704, 1704, 1704, 1704, 1704, 1704, 1704, 1704, 1712, 1712, 1712, 1712,
-    1712, 1712, 1712, 1712, 1712, 1712, 1712, 1712, 1712, 1712, 1712, 1712, 1728, 1729, 1730, 1730, 1732, 1732, 1732, 1732, 1736, 1736,
-    1736, 1736, 1736, 1736, 1736, 1736, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744,
-    1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760,
-    1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1792, 1793, 1794, 1795, 1796, 1797, 1798, 1798, 1800, 1801, 1802, 1802,
-    1804, 1804, 1804, 1804, 1808, 1809, 1810, 1810, 1812, 1812, 1812, 1812, 1816, 1816, 1816, 1816, 1816, 1816, 1816, 1816, 1824, 1825,
-    1826, 1826, 1828, 1828, 1828, 1828, 1832, 1832, 1832, 1832, 1832, 1832, 1832, 1832, 1840, 1840, 1840, 1840, 1840, 1840, 1840, 1840,
-    1840, 1840, 1840, 1840, 1840, 1840, 1840, 1840, 1856, 1857, 1858, 1858, 1860, 1860, 1860, 1860, 1864, 1864, 1864, 1864, 1864, 1864,
-    1864, 1864, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1872, 1888, 1888, 1888, 1888,
-    1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888, 1888,
-    1888, 1888, 1888, 1888, 1888, 1888, 1920, 1921, 1922, 1922, 1924, 1924, 1924, 1924, 1928, 1928, 1928, 1928, 1928, 1928, 1928, 1928,
-    1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1936, 1952, 1952, 1952, 1952, 1952, 1952,
-    1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952, 1952,
-    1952, 1952, 1952, 1952, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984,
-    1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984,
-    1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984, 1984,
-    1984, 1984, 2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2064, 2065, 2066, 2067,
-    2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2078, 2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089,
-    2090, 2091, 2092, 2093, 2094, 2094, 2096, 2097, 2098, 2099, 2100, 2101, 2102, 2102, 2104, 2105, 2106, 2106, 2108, 2108, 2108, 2108,
-    2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2126, 2128, 2129, 2130, 2131, 2132, 2133,
-    2134, 2134, 2136, 2137, 2138, 2138, 2140, 2140, 2140, 2140, 2144, 2145, 2146, 2147, 2148, 2149, 2150, 2150, 2152, 2153, 2154, 2154,
-    2156, 2156, 2156, 2156, 2160, 2161, 2162, 2162, 2164, 2164, 2164, 2164, 2168, 2168, 2168, 2168, 2168, 2168, 2168, 2168, 2176, 2177,
-    2178, 2179, 2180, 2181, 2182, 2183, 2184, 2185, 2186, 2187, 2188, 2189, 2190, 2190, 2192, 2193, 2194, 2195, 2196, 2197, 2198, 2198,
-    2200, 2201, 2202, 2202, 2204, 2204, 2204, 2204, 2208, 2209, 2210, 2211, 2212, 2213, 2214, 2214, 2216, 2217, 2218, 2218, 2220, 2220,
-    2220, 2220, 2224, 2225, 2226, 2226, 2228, 2228, 2228, 2228, 2232, 2232, 2232, 2232, 2232, 2232, 2232, 2232, 2240, 2241, 2242, 2243,
-    2244, 2245, 2246, 2246, 2248, 2249, 2250, 2250, 2252, 2252, 2252, 2252, 2256, 2257, 2258, 2258, 2260, 2260, 2260, 2260, 2264, 2264,
-    2264, 2264, 2264, 2264, 2264, 2264, 2272, 2273, 2274, 2274, 2276, 2276, 2276, 2276, 2280, 2280, 2280, 2280, 2280, 2280, 2280, 2280,
-    2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2288, 2304, 2305, 2306, 2307, 2308, 2309,
-    2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2318, 2318, 2320, 2321, 2322, 2323, 2324, 2325, 2326, 2326, 2328, 2329, 2330, 2330,
-    2332, 2332, 2332, 2332, 2336, 2337, 2338, 2339, 2340, 2341, 2342, 2342, 2344, 2345, 2346, 2346, 2348, 2348, 2348, 2348, 2352, 2353,
-    2354, 2354, 2356, 2356, 2356, 2356, 2360, 2360, 2360, 2360, 2360, 2360, 2360, 2360, 2368, 2369, 2370, 2371, 2372, 2373, 2374, 2374,
-    2376, 2377, 2378, 2378, 2380, 2380, 2380, 2380, 2384, 2385, 2386, 2386, 2388, 2388, 2388, 2388, 2392, 2392, 2392, 2392, 2392, 2392,
-    2392, 2392, 2400, 2401, 2402, 2402, 2404, 2404, 2404, 2404, 2408, 2408, 2408, 2408, 2408, 2408, 2408, 2408, 2416, 2416, 2416, 2416,
-    2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2416, 2432, 2433, 2434, 2435, 2436, 2437, 2438, 2438, 2440, 2441,
-    2442, 2442, 2444, 2444, 2444, 2444, 2448, 2449, 2450, 2450, 2452, 2452, 2452, 2452, 2456, 2456, 2456, 2456, 2456, 2456, 2456, 2456,
-    2464, 2465, 2466, 2466, 2468, 2468, 2468, 2468, 2472, 2472, 2472, 2472, 2472, 2472, 2472, 2472, 2480, 2480, 2480, 2480, 2480, 2480,
-    2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2480, 2496, 2497, 2498, 2498, 2500, 2500, 2500, 2500, 2504, 2504, 2504, 2504,
-    2504, 2504, 2504, 2504, 2512, 2512, 2512, 2512, 2512, 2512, 2512, 2512, 2512, 2512, 2512, 2512, 2512, 2512, 2512, 2512, 2528, 2528,
-    2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528,
-    2528, 2528, 2528, 2528, 2528, 2528, 2528, 2528, 2560, 2561, 2562, 2563, 2564, 2565, 2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573,
-    2574, 2574, 2576, 2577, 2578, 2579, 2580, 2581, 2582, 2582, 2584, 2585, 2586, 2586, 2588, 2588, 2588, 2588, 2592, 2593, 2594, 2595,
-    2596, 2597, 2598, 2598, 2600, 2601, 2602, 2602, 2604, 2604, 2604, 2604, 2608, 2609, 2610, 2610, 2612, 2612, 2612, 2612, 2616, 2616,
-    2616, 2616, 2616, 2616, 2616, 2616, 2624, 2625, 2626, 2627, 2628, 2629, 2630, 2630, 2632, 2633, 2634, 2634, 2636, 2636, 2636, 2636,
-    2640, 2641, 2642, 2642, 2644, 2644, 2644, 2644, 2648, 2648, 2648, 2648, 2648, 2648, 2648, 2648, 2656, 2657, 2658, 2658, 2660, 2660,
-    2660, 2660, 2664, 2664, 2664, 2664, 2664, 2664, 2664, 2664, 2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672,
-    2672, 2672, 2672, 2672, 2688, 2689, 2690, 2691, 2692, 2693, 2694, 2694, 2696, 2697, 2698, 2698, 2700, 2700, 2700, 2700, 2704, 2705,
-    2706, 2706, 2708, 2708, 2708, 2708, 2712, 2712, 2712, 2712, 2712, 2712, 2712, 2712, 2720, 2721, 2722, 2722, 2724, 2724, 2724, 2724,
-    2728, 2728, 2728, 2728, 2728, 2728, 2728, 2728, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736, 2736,
-    2736, 2736, 2752, 2753, 2754, 2754, 2756, 2756, 2756, 2756, 2760, 2760, 2760, 2760, 2760, 2760, 2760, 2760, 2768, 2768, 2768, 2768,
-    2768, 2768, 2768, 2768, 2768, 2768, 2768, 2768, 2768, 2768, 2768, 2768, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784,
-    2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784, 2784,
-    2816, 2817, 2818, 2819, 2820, 2821, 2822, 2822, 2824, 2825, 2826, 2826, 2828, 2828, 2828, 2828, 2832, 2833, 2834, 2834, 2836, 2836,
-    2836, 2836, 2840, 2840, 2840, 2840, 2840, 2840, 2840, 2840, 2848, 2849, 2850, 2850, 2852, 2852, 2852, 2852, 2856, 2856, 2856, 2856,
-    2856, 2856, 2856, 2856, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2880, 2881,
-    2882, 2882, 2884, 2884, 2884, 2884, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2888, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896,
-    2896, 2896, 2896, 2896, 2896, 2896, 2896, 2896, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912,
-    2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2912, 2944, 2945, 2946, 2946,
-    2948, 2948, 2948, 2948, 2952, 2952, 2952, 2952, 2952, 2952, 2952, 2952, 2960, 2960, 2960, 2960, 2960, 2960, 2960, 2960, 2960, 2960,
-    2960, 2960, 2960, 2960, 2960, 2960, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976,
-    2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 2976, 3008, 3008, 3008, 3008, 3008, 3008,
-    3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008,
-    3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008,
-    3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008, 3072, 3073, 3074, 3075, 3076, 3077, 3078, 3079,
-    3080, 3081, 3082, 3083, 3084, 3085, 3086, 3086, 3088, 3089, 3090, 3091, 3092, 3093, 3094, 3094, 3096, 3097, 3098, 3098, 3100, 3100,
-    3100, 3100, 3104, 3105, 3106, 3107, 3108, 3109, 3110, 3110, 3112, 3113, 3114, 3114, 3116, 3116, 3116, 3116, 3120, 3121, 3122, 3122,
-    3124, 3124, 3124, 3124, 3128, 3128, 3128, 3128, 3128, 3128, 3128, 3128, 3136, 3137, 3138, 3139, 3140, 3141, 3142, 3142, 3144, 3145,
-    3146, 3146, 3148, 3148, 3148, 3148, 3152, 3153, 3154, 3154, 3156, 3156, 3156, 3156, 3160, 3160, 3160, 3160, 3160, 3160, 3160, 3160,
-    3168, 3169, 3170, 3170, 3172, 3172, 3172, 3172, 3176, 3176, 3176, 3176, 3176, 3176, 3176, 3176, 3184, 3184, 3184, 3184, 3184, 3184,
-    3184, 3184, 3184, 3184, 3184, 3184, 3184, 3184, 3184, 3184, 3200, 3201, 3202, 3203, 3204, 3205, 3206, 3206, 3208, 3209, 3210, 3210,
-    3212, 3212, 3212, 3212, 3216, 3217, 3218, 3218, 3220, 3220, 3220, 3220, 3224, 3224, 3224, 3224, 3224, 3224, 3224, 3224, 3232, 3233,
-    3234, 3234, 3236, 3236, 3236, 3236, 3240, 3240, 3240, 3240, 3240, 3240, 3240, 3240, 3248, 3248, 3248, 3248, 3248, 3248, 3248, 3248,
-    3248, 3248, 3248, 3248, 3248, 3248, 3248, 3248, 3264, 3265, 3266, 3266, 3268, 3268, 3268, 3268, 3272, 3272, 3272, 3272, 3272, 3272,
-    3272, 3272, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3280, 3296, 3296, 3296, 3296,
-    3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296, 3296,
-    3296, 3296, 3296, 3296, 3296, 3296, 3328, 3329, 3330, 3331, 3332, 3333, 3334, 3334, 3336, 3337, 3338, 3338, 3340, 3340, 3340, 3340,
-    3344, 3345, 3346, 3346, 3348, 3348, 3348, 3348, 3352, 3352, 3352, 3352, 3352, 3352, 3352, 3352, 3360, 3361, 3362, 3362, 3364, 3364,
-    3364, 3364, 3368, 3368, 3368, 3368, 3368, 3368, 3368, 3368, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376, 3376,
-    3376, 3376, 3376, 3376, 3392, 3393, 3394, 3394, 3396, 3396, 3396, 3396, 3400, 3400, 3400, 3400, 3400, 3400, 3400, 3400, 3408, 3408,
-    3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3408, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424,
-    3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424, 3424,
-    3424, 3424, 3456, 3457, 3458, 3458, 3460, 3460, 3460, 3460, 3464, 3464, 3464, 3464, 3464, 3464, 3464, 3464, 3472, 3472, 3472, 3472,
-    3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3472, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488,
-    3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488, 3488,
-    3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520,
-    3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520,
-    3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3520, 3584, 3585,
-    3586, 3587, 3588, 3589, 3590, 3590, 3592, 3593, 3594, 3594, 3596, 3596, 3596, 3596, 3600, 3601, 3602, 3602, 3604, 3604, 3604, 3604,
-    3608, 3608, 3608, 3608, 3608, 3608, 3608, 3608, 3616, 3617, 3618, 3618, 3620, 3620, 3620, 3620, 3624, 3624, 3624, 3624, 3624, 3624,
-    3624, 3624, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3632, 3648, 3649, 3650, 3650,
-    3652, 3652, 3652, 3652, 3656, 3656, 3656, 3656, 3656, 3656, 3656, 3656, 3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664, 3664,
-    3664, 3664, 3664, 3664, 3664, 3664, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680,
-    3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3680, 3712, 3713, 3714, 3714, 3716, 3716,
-    3716, 3716, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 3720, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
-    3728, 3728, 3728, 3728, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744,
-    3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3744, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776,
-    3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776,
-    3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776,
-    3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3776, 3840, 3841, 3842, 3842, 3844, 3844, 3844, 3844, 3848, 3848,
-    3848, 3848, 3848, 3848, 3848, 3848, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856, 3856,
-    3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872,
-    3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3872, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904,
-    3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904,
-    3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904,
-    3904, 3904, 3904, 3904, 3904, 3904, 3904, 3904, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968,
-    3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968,
-    3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968,
-    3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968,
-    3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968,
-    3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968, 3968,
-    3968, 3968, 3968, 3968, 4096, 4097, 4098, 4099, 4100, 4101, 4102, 4103, 4104, 4105, 4106, 4107, 4108, 4109, 4110, 4111, 4112, 4113,
-    4114, 4115, 4116, 4117, 4118, 4119, 4120, 4121, 4122, 4123, 4124, 4125, 4126, 4126, 4128, 4129, 4130, 4131, 4132, 4133, 4134, 4135,
-    4136, 4137, 4138, 4139, 4140, 4141, 4142, 4142, 4144, 4145, 4146, 4147, 4148, 4149, 4150, 4150, 4152, 4153, 4154, 4154, 4156, 4156,
-    4156, 4156, 4160, 4161, 4162, 4163, 4164, 4165, 4166, 4167, 4168, 4169, 4170, 4171, 4172, 4173, 4174, 4174, 4176, 4177, 4178, 4179,
-    4180, 4181, 4182, 4182, 4184, 4185, 4186, 4186, 4188, 4188, 4188, 4188, 4192, 4193, 4194, 4195, 4196, 4197, 4198, 4198, 4200, 4201,
-    4202, 4202, 4204, 4204, 4204, 4204, 4208, 4209, 4210, 4210, 4212, 4212, 4212, 4212, 4216, 4216, 4216, 4216, 4216, 4216, 4216, 4216,
-    4224, 4225, 4226, 4227, 4228, 4229, 4230, 4231, 4232, 4233, 4234, 4235, 4236, 4237, 4238, 4238, 4240, 4241, 4242, 4243, 4244, 4245,
-    4246, 4246, 4248, 4249, 4250, 4250, 4252, 4252, 4252, 4252, 4256, 4257, 4258, 4259, 4260, 4261, 4262, 4262, 4264, 4265, 4266, 4266,
-    4268, 4268, 4268, 4268, 4272, 4273, 4274, 4274, 4276, 4276, 4276, 4276, 4280, 4280, 4280, 4280, 4280, 4280, 4280, 4280, 4288, 4289,
-    4290, 4291, 4292, 4293, 4294, 4294, 4296, 4297, 4298, 4298, 4300, 4300, 4300, 4300, 4304, 4305, 4306, 4306, 4308, 4308, 4308, 4308,
-    4312, 4312, 4312, 4312, 4312, 4312, 4312, 4312, 4320, 4321, 4322, 4322, 4324, 4324, 4324, 4324, 4328, 4328, 4328, 4328, 4328, 4328,
-    4328, 4328, 4336, 4336, 4336, 4336, 4336, 4336, 4336, 4336, 4336, 4336, 4336, 4336, 4336, 4336, 4336, 4336, 4352, 4353, 4354, 4355,
-    4356, 4357, 4358, 4359, 4360, 4361, 4362, 4363, 4364, 4365, 4366, 4366, 4368, 4369, 4370, 4371, 4372, 4373, 4374, 4374, 4376, 4377,
-    4378, 4378, 4380, 4380, 4380, 4380, 4384, 4385, 4386, 4387, 4388, 4389, 4390, 4390, 4392, 4393, 4394, 4394, 4396, 4396, 4396, 4396,
-    4400, 4401, 4402, 4402, 4404, 4404, 4404, 4404, 4408, 4408, 4408, 4408, 4408, 4408, 4408, 4408, 4416, 4417, 4418, 4419, 4420, 4421,
-    4422, 4422, 4424, 4425, 4426, 4426, 4428, 4428, 4428, 4428, 4432, 4433, 4434, 4434, 4436, 4436, 4436, 4436, 4440, 4440, 4440, 4440,
-    4440, 4440, 4440, 4440, 4448, 4449, 4450, 4450, 4452, 4452, 4452, 4452, 4456, 4456, 4456, 4456, 4456, 4456, 4456, 4456, 4464, 4464,
-    4464, 4464, 4464, 4464, 4464, 4464, 4464, 4464, 4464, 4464, 4464, 4464, 4464, 4464, 4480, 4481, 4482, 4483, 4484, 4485, 4486, 4486,
-    4488, 4489, 4490, 4490, 4492, 4492, 4492, 4492, 4496, 4497, 4498, 4498, 4500, 4500, 4500, 4500, 4504, 4504, 4504, 4504, 4504, 4504,
-    4504, 4504, 4512, 4513, 4514, 4514, 4516, 4516, 4516, 4516, 4520, 4520, 4520, 4520, 4520, 4520, 4520, 4520, 4528, 4528, 4528, 4528,
-    4528, 4528, 4528, 4528, 4528, 4528, 4528, 4528, 4528, 4528, 4528, 4528, 4544, 4545, 4546, 4546, 4548, 4548, 4548, 4548, 4552, 4552,
-    4552, 4552, 4552, 4552, 4552, 4552, 4560, 4560, 4560, 4560, 4560, 4560, 4560, 4560, 4560, 4560, 4560, 4560, 4560, 4560, 4560, 4560,
-    4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576,
-    4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4576, 4608, 4609, 4610, 4611, 4612, 4613, 4614, 4615, 4616, 4617, 4618, 4619,
-    4620, 4621, 4622, 4622, 4624, 4625, 4626, 4627, 4628, 4629, 4630, 4630, 4632, 4633, 4634, 4634, 4636, 4636, 4636, 4636, 4640, 4641,
-    4642, 4643, 4644, 4645, 4646, 4646, 4648, 4649, 4650, 4650, 4652, 4652, 4652, 4652, 4656, 4657, 4658, 4658, 4660, 4660, 4660, 4660,
-    4664, 4664, 4664, 4664, 4664, 4664, 4664, 4664, 4672, 4673, 4674, 4675, 4676, 4677, 4678, 4678, 4680, 4681, 4682, 4682, 4684, 4684,
-    4684, 4684, 4688, 4689, 4690, 4690, 4692, 4692, 4692, 4692, 4696, 4696, 4696, 4696, 4696, 4696, 4696, 4696, 4704, 4705, 4706, 4706,
-    4708, 4708, 4708, 4708, 4712, 4712, 4712, 4712, 4712, 4712, 4712, 4712, 4720, 4720, 4720, 4720, 4720, 4720, 4720, 4720, 4720, 4720,
-    4720, 4720, 4720, 4720, 4720, 4720, 4736, 4737, 4738, 4739, 4740, 4741, 4742, 4742, 4744, 4745, 4746, 4746, 4748, 4748, 4748, 4748,
-    4752, 4753, 4754, 4754, 4756, 4756, 4756, 4756, 4760, 4760, 4760, 4760, 4760, 4760, 4760, 4760, 4768, 4769, 4770, 4770, 4772, 4772,
-    4772, 4772, 4776, 4776, 4776, 4776, 4776, 4776, 4776, 4776, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784, 4784,
-    4784, 4784, 4784, 4784, 4800, 4801, 4802, 4802, 4804, 4804, 4804, 4804, 4808, 4808, 4808, 4808, 4808, 4808, 4808, 4808, 4816, 4816,
-    4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4816, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832,
-    4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832, 4832,
-    4832, 4832, 4864, 4865, 4866, 4867, 4868, 4869, 4870, 4870, 4872, 4873, 4874, 4874, 4876, 4876, 4876, 4876, 4880, 4881, 4882, 4882,
-    4884, 4884, 4884, 4884, 4888, 4888, 4888, 4888, 4888, 4888, 4888, 4888, 4896, 4897, 4898, 4898, 4900, 4900, 4900, 4900, 4904, 4904,
-    4904, 4904, 4904, 4904, 4904, 4904, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912, 4912,
-    4928, 4929, 4930, 4930, 4932, 4932, 4932, 4932, 4936, 4936, 4936, 4936, 4936, 4936, 4936, 4936, 4944, 4944, 4944, 4944, 4944, 4944,
-    4944, 4944, 4944, 4944, 4944, 4944, 4944, 4944, 4944, 4944, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960,
-    4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4960, 4992, 4993,
-    4994, 4994, 4996, 4996, 4996, 4996, 5000, 5000, 5000, 5000, 5000, 5000, 5000, 5000, 5008, 5008, 5008, 5008, 5008, 5008, 5008, 5008,
-    5008, 5008, 5008, 5008, 5008, 5008, 5008, 5008, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024,
-    5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5024, 5056, 5056, 5056, 5056,
-    5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056,
-    5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056,
-    5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5056, 5120, 5121, 5122, 5123, 5124, 5125,
-    5126, 5127, 5128, 5129, 5130, 5131, 5132, 5133, 5134, 5134, 5136, 5137, 5138, 5139, 5140, 5141, 5142, 5142, 5144, 5145, 5146, 5146,
-    5148, 5148, 5148, 5148, 5152, 5153, 5154, 5155, 5156, 5157, 5158, 5158, 5160, 5161, 5162, 5162, 5164, 5164, 5164, 5164, 5168, 5169,
-    5170, 5170, 5172, 5172, 5172, 5172, 5176, 5176, 5176, 5176, 5176, 5176, 5176, 5176, 5184, 5185, 5186, 5187, 5188, 5189, 5190, 5190,
-    5192, 5193, 5194, 5194, 5196, 5196, 5196, 5196, 5200, 5201, 5202, 5202, 5204, 5204, 5204, 5204, 5208, 5208, 5208, 5208, 5208, 5208,
-    5208, 5208, 5216, 5217, 5218, 5218, 5220, 5220, 5220, 5220, 5224, 5224, 5224, 5224, 5224, 5224, 5224, 5224, 5232, 5232, 5232, 5232,
-    5232, 5232, 5232, 5232, 5232, 5232, 5232, 5232, 5232, 5232, 5232, 5232, 5248, 5249, 5250, 5251, 5252, 5253, 5254, 5254, 5256, 5257,
-    5258, 5258, 5260, 5260, 5260, 5260, 5264, 5265, 5266, 5266, 5268, 5268, 5268, 5268, 5272, 5272, 5272, 5272, 5272, 5272, 5272, 5272,
-    5280, 5281, 5282, 5282, 5284, 5284, 5284, 5284, 5288, 5288, 5288, 5288, 5288, 5288, 5288, 5288, 5296, 5296, 5296, 5296, 5296, 5296,
-    5296, 5296, 5296, 5296, 5296, 5296, 5296, 5296, 5296, 5296, 5312, 5313, 5314, 5314, 5316, 5316, 5316, 5316, 5320, 5320, 5320, 5320,
-    5320, 5320, 5320, 5320, 5328, 5328, 5328, 5328, 5328, 5328, 5328, 5328, 5328, 5328, 5328, 5328, 5328, 5328, 5328, 5328, 5344, 5344,
-    5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344,
-    5344, 5344, 5344, 5344, 5344, 5344, 5344, 5344, 5376, 5377, 5378, 5379, 5380, 5381, 5382, 5382, 5384, 5385, 5386, 5386, 5388, 5388,
-    5388, 5388, 5392, 5393, 5394, 5394, 5396, 5396, 5396, 5396, 5400, 5400, 5400, 5400, 5400, 5400, 5400, 5400, 5408, 5409, 5410, 5410,
-    5412, 5412, 5412, 5412, 5416, 5416, 5416, 5416, 5416, 5416, 5416, 5416, 5424, 5424, 5424, 5424, 5424, 5424, 5424, 5424, 5424, 5424,
-    5424, 5424, 5424, 5424, 5424, 5424, 5440, 5441, 5442, 5442, 5444, 5444, 5444, 5444, 5448, 5448, 5448, 5448, 5448, 5448, 5448, 5448,
-    5456, 5456, 5456, 5456, 5456, 5456, 5456, 5456, 5456, 5456, 5456, 5456, 5456, 5456, 5456, 5456, 5472, 5472, 5472, 5472, 5472, 5472,
-    5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472, 5472,
-    5472, 5472, 5472, 5472, 5504, 5505, 5506, 5506, 5508, 5508, 5508, 5508, 5512, 5512, 5512, 5512, 5512, 5512, 5512, 5512, 5520, 5520,
-    5520, 5520, 5520, 5520, 5520, 5520, 5520, 5520, 5520, 5520, 5520, 5520, 5520, 5520, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536,
-    5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536, 5536,
-    5536, 5536, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568,
-    5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568,
-    5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568, 5568,
-    5632, 5633, 5634, 5635, 5636, 5637, 5638, 5638, 5640, 5641, 5642, 5642, 5644, 5644, 5644, 5644, 5648, 5649, 5650, 5650, 5652, 5652,
-    5652, 5652, 5656, 5656, 5656, 5656, 5656, 5656, 5656, 5656, 5664, 5665, 5666, 5666, 5668, 5668, 5668, 5668, 5672, 5672, 5672, 5672,
-    5672, 5672, 5672, 5672, 5680, 5680, 5680, 5680, 5680, 5680, 5680, 5680, 5680, 5680, 5680, 5680, 5680, 5680, 5680, 5680, 5696, 5697,
-    5698, 5698, 5700, 5700, 5700, 5700, 5704, 5704, 5704, 5704, 5704, 5704, 5704, 5704, 5712, 5712, 5712, 5712, 5712, 5712, 5712, 5712,
-    5712, 5712, 5712, 5712, 5712, 5712, 5712, 5712, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728,
-    5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5728, 5760, 5761, 5762, 5762,
-    5764, 5764, 5764, 5764, 5768, 5768, 5768, 5768, 5768, 5768, 5768, 5768, 5776, 5776, 5776, 5776, 5776, 5776, 5776, 5776, 5776, 5776,
-    5776, 5776, 5776, 5776, 5776, 5776, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792,
-    5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5792, 5824, 5824, 5824, 5824, 5824, 5824,
-    5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824,
-    5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824,
-    5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5888, 5889, 5890, 5890, 5892, 5892, 5892, 5892,
-    5896, 5896, 5896, 5896, 5896, 5896, 5896, 5896, 5904, 5904, 5904, 5904, 5904, 5904, 5904, 5904, 5904, 5904, 5904, 5904, 5904, 5904,
-    5904, 5904, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920,
-    5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5920, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952,
-    5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952,
-    5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952,
-    5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 5952, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016,
-    6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016,
-    6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016,
-    6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016,
-    6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016,
-    6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016, 6016,
-    6016, 6016, 6016, 6016, 6016, 6016, 6144, 6145, 6146, 6147, 6148, 6149, 6150, 6151, 6152, 6153, 6154, 6155, 6156, 6157, 6158, 6158,
-    6160, 6161, 6162, 6163, 6164, 6165, 6166, 6166, 6168, 6169, 6170, 6170, 6172, 6172, 6172, 6172, 6176, 6177, 6178, 6179, 6180, 6181,
-    6182, 6182, 6184, 6185, 6186, 6186, 6188, 6188, 6188, 6188, 6192, 6193, 6194, 6194, 6196, 6196, 6196, 6196, 6200, 6200, 6200, 6200,
-    6200, 6200, 6200, 6200, 6208, 6209, 6210, 6211, 6212, 6213, 6214, 6214, 6216, 6217, 6218, 6218, 6220, 6220, 6220, 6220, 6224, 6225,
-    6226, 6226, 6228, 6228, 6228, 6228, 6232, 6232, 6232, 6232, 6232, 6232, 6232, 6232, 6240, 6241, 6242, 6242, 6244, 6244, 6244, 6244,
-    6248, 6248, 6248, 6248, 6248, 6248, 6248, 6248, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256,
-    6256, 6256, 6272, 6273, 6274, 6275, 6276, 6277, 6278, 6278, 6280, 6281, 6282, 6282, 6284, 6284, 6284, 6284, 6288, 6289, 6290, 6290,
-    6292, 6292, 6292, 6292, 6296, 6296, 6296, 6296, 6296, 6296, 6296, 6296, 6304, 6305, 6306, 6306, 6308, 6308, 6308, 6308, 6312, 6312,
-    6312, 6312, 6312, 6312, 6312, 6312, 6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320, 6320,
-    6336, 6337, 6338, 6338, 6340, 6340, 6340, 6340, 6344, 6344, 6344, 6344, 6344, 6344, 6344, 6344, 6352, 6352, 6352, 6352, 6352, 6352,
-    6352, 6352, 6352, 6352, 6352, 6352, 6352, 6352, 6352, 6352, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368,
-    6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6368, 6400, 6401,
-    6402, 6403, 6404, 6405, 6406, 6406, 6408, 6409, 6410, 6410, 6412, 6412, 6412, 6412, 6416, 6417, 6418, 6418, 6420, 6420, 6420, 6420,
-    6424, 6424, 6424, 6424, 6424, 6424, 6424, 6424, 6432, 6433, 6434, 6434, 6436, 6436, 6436, 6436, 6440, 6440, 6440, 6440, 6440, 6440,
-    6440, 6440, 6448, 6448, 6448, 6448, 6448, 6448, 6448, 6448, 6448, 6448, 6448, 6448, 6448, 6448, 6448, 6448, 6464, 6465, 6466, 6466,
-    6468, 6468, 6468, 6468, 6472, 6472, 6472, 6472, 6472, 6472, 6472, 6472, 6480, 6480, 6480, 6480, 6480, 6480, 6480, 6480, 6480, 6480,
-    6480, 6480, 6480, 6480, 6480, 6480, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496,
-    6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6496, 6528, 6529, 6530, 6530, 6532, 6532,
-    6532, 6532, 6536, 6536, 6536, 6536, 6536, 6536, 6536, 6536, 6544, 6544, 6544, 6544, 6544, 6544, 6544, 6544, 6544, 6544, 6544, 6544,
-    6544, 6544, 6544, 6544, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560,
-    6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6560, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592,
-    6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592,
-    6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592,
-    6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6592, 6656, 6657, 6658, 6659, 6660, 6661, 6662, 6662, 6664, 6665,
-    6666, 6666, 6668, 6668, 6668, 6668, 6672, 6673, 6674, 6674, 6676, 6676, 6676, 6676, 6680, 6680, 6680, 6680, 6680, 6680, 6680, 6680,
-    6688, 6689, 6690, 6690, 6692, 6692, 6692, 6692, 6696, 6696, 6696, 6696, 6696, 6696, 6696, 6696, 6704, 6704, 6704, 6704, 6704, 6704,
-    6704, 6704, 6704, 6704, 6704, 6704, 6704, 6704, 6704, 6704, 6720, 6721, 6722, 6722, 6724, 6724, 6724, 6724, 6728, 6728, 6728, 6728,
-    6728, 6728, 6728, 6728, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6736, 6752, 6752,
-    6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752,
-    6752, 6752, 6752, 6752, 6752, 6752, 6752, 6752, 6784, 6785, 6786, 6786, 6788, 6788, 6788, 6788, 6792, 6792, 6792, 6792, 6792, 6792,
-    6792, 6792, 6800, 6800, 6800, 6800, 6800, 6800, 6800, 6800, 6800, 6800, 6800, 6800, 6800, 6800, 6800, 6800, 6816, 6816, 6816, 6816,
-    6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816, 6816,
-    6816, 6816, 6816, 6816, 6816, 6816, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848,
-    6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848,
-    6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848, 6848,
-    6848, 6848, 6848, 6848, 6912, 6913, 6914, 6914, 6916, 6916, 6916, 6916, 6920, 6920, 6920, 6920, 6920, 6920, 6920, 6920, 6928, 6928,
-    6928, 6928, 6928, 6928, 6928, 6928, 6928, 6928, 6928, 6928, 6928, 6928, 6928, 6928, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944,
-    6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944, 6944,
-    6944, 6944, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976,
-    6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976,
-    6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976, 6976,
-    7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040,
-    7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040,
-    7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040,
-    7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040,
-    7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040,
-    7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7040, 7168, 7169, 7170, 7171,
-    7172, 7173, 7174, 7174, 7176, 7177, 7178, 7178, 7180, 7180, 7180, 7180, 7184, 7185, 7186, 7186, 7188, 7188, 7188, 7188, 7192, 7192,
-    7192, 7192, 7192, 7192, 7192, 7192, 7200, 7201, 7202, 7202, 7204, 7204, 7204, 7204, 7208, 7208, 7208, 7208, 7208, 7208, 7208, 7208,
-    7216, 7216, 7216, 7216, 7216, 7216, 7216, 7216, 7216, 7216, 7216, 7216, 7216, 7216, 7216, 7216, 7232, 7233, 7234, 7234, 7236, 7236,
-    7236, 7236, 7240, 7240, 7240, 7240, 7240, 7240, 7240, 7240, 7248, 7248, 7248, 7248, 7248, 7248, 7248, 7248, 7248, 7248, 7248, 7248,
-    7248, 7248, 7248, 7248, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264,
-    7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264, 7296, 7297, 7298, 7298, 7300, 7300, 7300, 7300,
-    7304, 7304, 7304, 7304, 7304, 7304, 7304, 7304, 7312, 7312, 7312, 7312, 7312, 7312, 7312, 7312, 7312, 7312, 7312, 7312, 7312, 7312,
-    7312, 7312, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328,
-    7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7328, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360,
-    7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360,
-    7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360,
-    7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7360, 7424, 7425, 7426, 7426, 7428, 7428, 7428, 7428, 7432, 7432, 7432, 7432,
-    7432, 7432, 7432, 7432, 7440, 7440, 7440, 7440, 7440, 7440, 7440, 7440, 7440, 7440, 7440, 7440, 7440, 7440, 7440, 7440, 7456, 7456,
-    7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456,
-    7456, 7456, 7456, 7456, 7456, 7456, 7456, 7456, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488,
-    7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488,
-    7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488, 7488,
-    7488, 7488, 7488, 7488, 7488, 7488, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552,
-    7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552,
-    7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552,
-    7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552,
-    7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552,
-    7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552, 7552,
-    7552, 7552, 7680, 7681, 7682, 7682, 7684, 7684, 7684, 7684, 7688, 7688, 7688, 7688, 7688, 7688, 7688, 7688, 7696, 7696, 7696, 7696,
-    7696, 7696, 7696, 7696, 7696, 7696, 7696, 7696, 7696, 7696, 7696, 7696, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712,
-    7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712, 7712,
-    7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744,
-    7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744,
-    7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7744, 7808, 7808,
-    7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808,
-    7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808,
-    7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808,
-    7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808,
-    7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808,
-    7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7808, 7936, 7936, 7936, 7936, 7936, 7936,
-    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936,
-    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936,
-    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936,
-    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936,
-    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936,
-    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936,
-    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936,
-    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936,
-    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936,
-    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936,
-    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936,
-    7936, 7936, 7936, 7936, 7936, 7936, 7936, 7936};
+inline constexpr auto mkpoker_table_pair = mkp::detail::make_table_pair();
+#endif
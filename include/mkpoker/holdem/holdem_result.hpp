@@ -198,6 +198,14 @@ namespace mkp
         }
     };
 
+    // inverse of holdem_result::as_bitset(), e.g. for results stored in tables
+    [[nodiscard]] constexpr holdem_result holdem_result_from_bitset(const uint32_t bits) noexcept
+    {
+        return holdem_result(static_cast<uint8_t>((bits >> c_offset_type) & c_mask_type),
+                             static_cast<uint8_t>((bits >> c_offset_major) & 0xF), static_cast<uint8_t>((bits >> c_offset_minor) & 0xF),
+                             static_cast<uint16_t>(bits & c_mask_ranks));
+    }
+
     [[nodiscard]] constexpr auto make_he_result(uint8_t type, uint8_t major, uint8_t minor, uint16_t kickers)
     {
         // check type an major rank
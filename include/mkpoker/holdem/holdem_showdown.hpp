@@ -0,0 +1,196 @@
+/*
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+
+#pragma once
+
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/combo.hpp>
+#include <mkpoker/base/combo_range.hpp>
+#include <mkpoker/holdem/holdem_combo_evaluation.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+namespace mkp
+{
+    // all combos of a river board ordered by their evaluation
+    struct river_combo_order_t
+    {
+        // combo indices of all combos not colliding with the board, weakest first
+        std::array<uint16_t, c_num_combos> m_combos{};
+        // holdem_result::as_bitset() of every combo (indexed by combo_index), 0 for combos colliding with the board
+        std::array<uint32_t, c_num_combos> m_values{};
+        // rank of every combo (indexed by combo_index) among all combos, 0 is the weakest hand and combos with equal values
+        // have the same rank; 0 for combos colliding with the board
+        std::array<uint16_t, c_num_combos> m_ranks{};
+        // number of valid entries in m_combos
+        uint16_t m_size = 0;
+    };
+
+    // evaluates all combos once (evaluate_combos) and sorts them, throws if the board does not have 5 cards
+    [[nodiscard]] inline river_combo_order_t river_combo_order(const cardset board)
+    {
+        if (board.size() != 5)
+        {
+            throw std::runtime_error("river_combo_order(const cardset): invalid board size " + std::to_string(board.size()));
+        }
+
+        river_combo_order_t ret{};
+        ret.m_values = evaluate_combos(board);
+        (~blocked_combos(board)).for_each([&](const uint16_t i) { ret.m_combos[ret.m_size++] = i; });
+        std::sort(ret.m_combos.begin(), ret.m_combos.begin() + ret.m_size,
+                  [&](const uint16_t lhs, const uint16_t rhs) { return ret.m_values[lhs] < ret.m_values[rhs]; });
+
+        uint16_t rank = 0;
+        for (uint16_t k = 1; k < ret.m_size; ++k)
+        {
+            rank += ret.m_values[ret.m_combos[k]] != ret.m_values[ret.m_combos[k - 1]];
+            ret.m_ranks[ret.m_combos[k]] = rank;
+        }
+        return ret;
+    }
+
+    // weights of the villain combos which lose to / tie with / beat a hero combo at showdown
+    struct showdown_weights_t
+    {
+        float m_win = 0.0f;
+        float m_tie = 0.0f;
+        float m_lose = 0.0f;
+
+        // share of the pot (ties are split), 0 if there is no villain combo left
+        [[nodiscard]] float equity() const noexcept
+        {
+            const float total = m_win + m_tie + m_lose;
+            return total > 0.0f ? (m_win + 0.5f * m_tie) / total : 0.0f;
+        }
+    };
+
+    namespace detail
+    {
+        // single sweep over the ordered combos of a river board: for every combo the summed weights of the villain combos
+        // which it beats / ties with / all villain combos, calls f(combo, channel, win, tie, all) for every channel < num_channels
+        //
+        // villain combos are split into channels (channel(combo) < NumChannels, e.g. opponent clusters) with weight(combo).
+        // the sums of weaker / equal villain combos are accumulated per card, so villain combos sharing a card with the combo
+        // are removed with inclusion–exclusion over both hole cards (the combo itself is the only one sharing both cards and
+        // is removed twice, so it is added once again)
+        template <typename T, std::size_t NumChannels, typename Channel, typename Weight, typename F>
+        void river_sweep(const river_combo_order_t& order, const uint32_t num_channels, Channel&& channel, Weight&& weight, F&& f)
+        {
+            using per_card_t = std::array<std::array<T, c_deck_size>, NumChannels>;
+            std::array<T, NumChannels> total{};
+            std::array<T, NumChannels> weaker{};
+            std::array<T, NumChannels> equal{};
+            per_card_t total_per_card{};
+            per_card_t weaker_per_card{};
+            per_card_t equal_per_card{};
+
+            for (uint16_t k = 0; k < order.m_size; ++k)
+            {
+                const auto combo = order.m_combos[k];
+                const auto& [c1, c2] = c_combo_cards[combo];
+                const auto ch = channel(combo);
+                const T w = weight(combo);
+                total[ch] += w;
+                total_per_card[ch][c1] += w;
+                total_per_card[ch][c2] += w;
+            }
+
+            for (uint16_t i = 0; i < order.m_size;)
+            {
+                // [i,j) is a group of combos with equal value
+                uint16_t j = i;
+                for (; j < order.m_size && order.m_values[order.m_combos[j]] == order.m_values[order.m_combos[i]]; ++j)
+                {
+                    const auto combo = order.m_combos[j];
+                    const auto& [c1, c2] = c_combo_cards[combo];
+                    const auto ch = channel(combo);
+                    const T w = weight(combo);
+                    equal[ch] += w;
+                    equal_per_card[ch][c1] += w;
+                    equal_per_card[ch][c2] += w;
+                }
+
+                for (uint16_t k = i; k < j; ++k)
+                {
+                    const auto combo = order.m_combos[k];
+                    const auto& [c1, c2] = c_combo_cards[combo];
+                    const auto own_channel = channel(combo);
+                    const T own = weight(combo);
+                    for (uint32_t c = 0; c < num_channels; ++c)
+                    {
+                        const T self = c == own_channel ? own : T(0);
+                        const T win = weaker[c] - weaker_per_card[c][c1] - weaker_per_card[c][c2];
+                        const T tie = equal[c] - equal_per_card[c][c1] - equal_per_card[c][c2] + self;
+                        const T all = total[c] - total_per_card[c][c1] - total_per_card[c][c2] + self;
+                        f(combo, c, win, tie, all);
+                    }
+                }
+
+                // all equal combos belong to this group
+                for (uint16_t k = i; k < j; ++k)
+                {
+                    const auto combo = order.m_combos[k];
+                    const auto& [c1, c2] = c_combo_cards[combo];
+                    const auto ch = channel(combo);
+                    const T w = weight(combo);
+                    equal_per_card[ch][c1] = T(0);
+                    equal_per_card[ch][c2] = T(0);
+                    weaker_per_card[ch][c1] += w;
+                    weaker_per_card[ch][c2] += w;
+                }
+                for (uint32_t c = 0; c < num_channels; ++c)
+                {
+                    weaker[c] += equal[c];
+                    equal[c] = T(0);
+                }
+                i = j;
+            }
+        }
+    }    // namespace detail
+
+    // showdown of every hero combo (indexed by combo_index) against the villain weights in a single sweep over the ordered combos
+    // (detail::river_sweep), combos colliding with the board are zero
+    [[nodiscard]] inline std::array<showdown_weights_t, c_num_combos> river_showdown(const river_combo_order_t& order,
+                                                                                     const std::span<const float, c_num_combos> villain)
+    {
+        // double, the sums of 1000+ weights are subtracted from each other
+        std::array<showdown_weights_t, c_num_combos> ret{};
+        detail::river_sweep<double, 1>(
+            order, 1, [](const uint16_t) { return 0u; }, [&](const uint16_t combo) { return double(villain[combo]); },
+            [&](const uint16_t combo, const uint32_t, const double win, const double tie, const double all) {
+                ret[combo] = {static_cast<float>(std::max(win, 0.0)), static_cast<float>(std::max(tie, 0.0)),
+                              static_cast<float>(std::max(all - win - tie, 0.0))};
+            });
+        return ret;
+    }
+
+    // same as above for a single board and a villain range
+    [[nodiscard]] inline std::array<showdown_weights_t, c_num_combos> river_showdown(const cardset board, const combo_range& villain)
+    {
+        return river_showdown(river_combo_order(board), villain.weights());
+    }
+
+}    // namespace mkp
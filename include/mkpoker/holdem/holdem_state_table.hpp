@@ -0,0 +1,352 @@
+/*
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+
+#pragma once
+
+#include <mkpoker/base/card.hpp>
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/holdem/holdem_evaluation.hpp>
+#include <mkpoker/holdem/holdem_result.hpp>
+#include <mkpoker/util/file.hpp>
+#include <mkpoker/util/mapped_file.hpp>
+#include <mkpoker/util/parallel.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace mkp
+{
+    inline namespace constants
+    {
+        // a state has one entry per card (the next state) and one for its own result
+        constexpr uint32_t c_state_table_stride = c_deck_size + 1;
+        constexpr uint8_t c_state_table_max_cards = 7;
+    }    // namespace constants
+
+    // file layout: header, followed by m_num_states * m_stride uint32_t entries starting at m_offset bytes from the beginning of the file
+    // entry [s * stride + c] is the position (s' * stride) of the state after adding card c to state s, for states with 6 cards it is
+    // the result (holdem_result::as_bitset()) of all 7 cards instead; entry [s * stride + c_deck_size] is the result of a state with
+    // 5 or 6 cards; invalid transitions (card already part of the state) are 0
+    struct state_table_file_header_t
+    {
+        static constexpr std::array<char, 8> c_magic{'M', 'K', 'P', 'S', 'T', 'T', '\0', '\0'};
+        static constexpr uint32_t c_version = 1;
+        static constexpr uint64_t c_alignment = 64;
+
+        std::array<char, 8> m_magic = c_magic;
+        uint32_t m_version = c_version;
+        uint32_t m_stride = c_state_table_stride;
+        uint64_t m_num_states = 0;
+        uint64_t m_offset = c_alignment;
+
+        // total file size
+        [[nodiscard]] uint64_t file_size() const noexcept { return m_offset + m_num_states * m_stride * sizeof(uint32_t); }
+
+        // throws if the header does not belong to a valid state table file
+        void validate(const std::string& filename, const uint64_t actual_file_size) const
+        {
+            if (m_magic != c_magic || m_version == 0 || m_version > c_version)
+            {
+                throw std::runtime_error("state table file '" + filename + "': invalid magic or unsupported version");
+            }
+            if (m_stride != c_state_table_stride || m_num_states == 0 || m_offset % c_alignment != 0 ||
+                m_num_states * m_stride > std::numeric_limits<uint32_t>::max() || file_size() != actual_file_size)
+            {
+                throw std::runtime_error("state table file '" + filename + "': invalid table");
+            }
+        }
+    };
+
+    static_assert(std::is_standard_layout_v<state_table_file_header_t>, "state_table_file_header_t should have standard layout");
+    static_assert(sizeof(state_table_file_header_t) == 32, "state_table_file_header_t should have no padding");
+
+    namespace detail
+    {
+        // a state is the sorted (descending) list of its cards packed into 8 bits each: (rank + 1) << 3 | (suit + 1)
+        // the suit of a card is dropped (0) once its suit can no longer make a flush with the remaining cards,
+        // which merges all states that only differ in irrelevant suits (~600k instead of ~23M states)
+        using state_key_t = uint64_t;
+
+        // state after adding card c, 0 if the state already contains the card
+        [[nodiscard]] constexpr state_key_t state_key_add(const state_key_t key, const card c) noexcept
+        {
+            std::array<uint8_t, c_state_table_max_cards> cards{};
+            uint8_t num_cards = 0;
+            for (state_key_t k = key; k != 0 && num_cards < c_state_table_max_cards; k >>= 8)
+            {
+                cards[num_cards++] = static_cast<uint8_t>(k);
+            }
+
+            const uint8_t rank_bits = static_cast<uint8_t>((c.rank().m_rank + 1) << 3);
+            const uint8_t card_bits = static_cast<uint8_t>(rank_bits | (c.suit().m_suit + 1));
+            uint8_t num_same_rank = 0;
+            for (uint8_t i = 0; i < num_cards; ++i)
+            {
+                if (cards[i] == card_bits)
+                {
+                    return 0;
+                }
+                num_same_rank += (cards[i] & ~7) == rank_bits;
+            }
+            // if the suit of a card was dropped, duplicates are only detected by the number of cards of that rank
+            if (num_cards == c_state_table_max_cards || num_same_rank == c_num_suits)
+            {
+                return 0;
+            }
+            cards[num_cards++] = card_bits;
+
+            // index 0 counts cards without suit
+            std::array<uint8_t, c_num_suits + 1> num_suited{};
+            for (uint8_t i = 0; i < num_cards; ++i)
+            {
+                ++num_suited[cards[i] & 7];
+            }
+            for (uint8_t i = 0; i < num_cards; ++i)
+            {
+                if (num_suited[cards[i] & 7] + (c_state_table_max_cards - num_cards) < 5)
+                {
+                    cards[i] &= ~7;
+                }
+            }
+
+            // insertion sort (descending), dropping suits can change the order of cards with the same rank
+            for (uint8_t i = 1; i < num_cards; ++i)
+            {
+                const uint8_t x = cards[i];
+                uint8_t j = i;
+                for (; j > 0 && cards[j - 1] < x; --j)
+                {
+                    cards[j] = cards[j - 1];
+                }
+                cards[j] = x;
+            }
+            state_key_t ret = 0;
+            for (uint8_t i = 0; i < num_cards; ++i)
+            {
+                ret |= state_key_t(cards[i]) << (8 * i);
+            }
+            return ret;
+        }
+
+        // result bits of all cards of a state (at least 5)
+        [[nodiscard]] inline uint32_t state_key_evaluate(const state_key_t key) noexcept
+        {
+            // for quads, full house, straight, pairs etc. only the number of cards per rank matters (see rank_count_masks_t),
+            // flushes are checked with the actual suits
+            rank_count_masks_t by_count{};
+            std::array<uint16_t, c_num_suits> by_suit{};
+            for (state_key_t k = key; k != 0; k >>= 8)
+            {
+                const auto r = static_cast<uint8_t>(((k & 0xFF) >> 3) - 1);
+                add_rank(by_count, r);
+                if (const auto suit = k & 7; suit != 0)
+                {
+                    by_suit[suit - 1] |= uint16_t(1) << r;
+                }
+            }
+
+            auto ret = evaluate_no_flush(by_count[0], by_count[1], by_count[2], by_count[3]);
+            for (auto&& mask : by_suit)
+            {
+                if (std::popcount(mask) >= 5)
+                {
+                    // with at most 7 cards, there can be no quads or full house besides a flush
+                    ret = std::max(ret, flush_or_straight_flush(mask));
+                }
+            }
+            return ret.as_bitset();
+        }
+    }    // namespace detail
+
+    // create the state table for all states with up to 7 cards (~130 MB), see state_table_file_header_t for the layout
+    [[nodiscard]] inline std::vector<uint32_t> make_state_table(const unsigned num_threads = default_num_threads())
+    {
+        // states grouped by number of cards and sorted, so the position of a state is its layer offset + index in the layer
+        std::array<std::vector<detail::state_key_t>, c_state_table_max_cards> layers;
+        layers[0].push_back(0);
+        for (uint8_t n = 1; n < c_state_table_max_cards; ++n)
+        {
+            auto& layer = layers[n];
+            layer.reserve(layers[n - 1].size() * c_deck_size);
+            for (auto&& key : layers[n - 1])
+            {
+                for (uint8_t i = 0; i < c_deck_size; ++i)
+                {
+                    if (const auto next = detail::state_key_add(key, card{i}); next != 0)
+                    {
+                        layer.push_back(next);
+                    }
+                }
+            }
+            std::sort(layer.begin(), layer.end());
+            layer.erase(std::unique(layer.begin(), layer.end()), layer.end());
+            layer.shrink_to_fit();
+        }
+
+        std::array<uint64_t, c_state_table_max_cards + 1> first_state{};
+        for (uint8_t n = 0; n < c_state_table_max_cards; ++n)
+        {
+            first_state[n + 1] = first_state[n] + layers[n].size();
+        }
+        const uint64_t num_states = first_state.back();
+
+        std::vector<uint32_t> table(num_states * c_state_table_stride, 0);
+        for (uint8_t n = 0; n < c_state_table_max_cards; ++n)
+        {
+            const auto& layer = layers[n];
+            parallel_for_chunks(layer.size(), num_threads, 1024, [&](unsigned, const uint64_t begin, const uint64_t end) {
+                for (uint64_t s = begin; s < end; ++s)
+                {
+                    uint32_t* entries = table.data() + (first_state[n] + s) * c_state_table_stride;
+                    if (n >= 5)
+                    {
+                        entries[c_deck_size] = detail::state_key_evaluate(layer[s]);
+                    }
+                    for (uint8_t i = 0; i < c_deck_size; ++i)
+                    {
+                        const auto next = detail::state_key_add(layer[s], card{i});
+                        if (next == 0)
+                        {
+                            continue;
+                        }
+                        if (n + 1 == c_state_table_max_cards)
+                        {
+                            entries[i] = detail::state_key_evaluate(next);
+                        }
+                        else
+                        {
+                            const auto& next_layer = layers[n + 1];
+                            const auto idx = std::lower_bound(next_layer.cbegin(), next_layer.cend(), next) - next_layer.cbegin();
+                            entries[i] = static_cast<uint32_t>((first_state[n + 1] + idx) * c_state_table_stride);
+                        }
+                    }
+                }
+            });
+        }
+        return table;
+    }
+
+    // write a state table to file (native byte order)
+    inline void save_state_table(const std::string& filename, const std::vector<uint32_t>& table)
+    {
+        state_table_file_header_t header{};
+        header.m_num_states = table.size() / c_state_table_stride;
+        header.validate(filename, table.size() * sizeof(uint32_t) + header.m_offset);
+
+        const auto f = detail::open_file(filename, "wb");
+        detail::write_binary(f.get(), &header, 1);
+        const std::array<char, state_table_file_header_t::c_alignment> padding{};
+        detail::write_binary(f.get(), padding.data(), header.m_offset - sizeof(state_table_file_header_t));
+        detail::write_binary(f.get(), table.data(), table.size());
+    }
+
+    // evaluator backed by a read-only memory mapped state table (see make_state_table): every card is a single lookup
+    // and the state of the first cards can be reused for all cards that follow, e.g. hole cards + board while enumerating runouts
+    class holdem_state_table
+    {
+        mapped_file m_file;
+        const uint32_t* m_table = nullptr;
+        uint64_t m_num_states = 0;
+
+       public:
+        // position in the table, cheap to copy
+        class cursor
+        {
+            const uint32_t* m_table;
+            // start of the current state, after 7 cards the result bits
+            uint32_t m_pos = 0;
+            uint8_t m_num_cards = 0;
+
+           public:
+            explicit cursor(const uint32_t* table) noexcept : m_table(table) {}
+
+            // the card must not have been added before and at most 7 cards can be added; otherwise, the behavior is undefined
+            void add(const card c) noexcept
+            {
+                m_pos = m_table[m_pos + c.m_card];
+                ++m_num_cards;
+            }
+
+            void add(const cardset cs) noexcept
+            {
+                for (uint64_t mask = cs.as_bitset(); mask != 0; mask &= mask - 1)
+                {
+                    add(card{cross_idx_low64(mask)});
+                }
+            }
+
+            [[nodiscard]] uint8_t size() const noexcept { return m_num_cards; }
+
+            // result bits (holdem_result::as_bitset()) of a state with 5 to 7 cards, comparable like holdem_result
+            [[nodiscard]] uint32_t result_bits() const noexcept
+            {
+                return m_num_cards == c_state_table_max_cards ? m_pos : m_table[m_pos + c_deck_size];
+            }
+
+            // evaluation of a state with 5 to 7 cards
+            [[nodiscard]] holdem_result result() const noexcept { return holdem_result_from_bitset(result_bits()); }
+        };
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // CTORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        explicit holdem_state_table(const std::string& filename) : m_file(filename, mapped_file_advice_t::RANDOM)
+        {
+            if (m_file.size() < sizeof(state_table_file_header_t))
+            {
+                throw std::runtime_error("holdem_state_table(const string&): file '" + filename + "' too small");
+            }
+            state_table_file_header_t header{};
+            std::memcpy(&header, m_file.data(), sizeof(state_table_file_header_t));
+            header.validate(filename, m_file.size());
+            // the table is aligned, so it can be accessed directly
+            m_table = reinterpret_cast<const uint32_t*>(m_file.data() + header.m_offset);
+            m_num_states = header.m_num_states;
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // ACCESSORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // empty state
+        [[nodiscard]] cursor start() const noexcept { return cursor(m_table); }
+
+        // evaluation of 5 to 7 cards; otherwise, the behavior is undefined
+        [[nodiscard]] holdem_result evaluate(const cardset cs) const noexcept
+        {
+            auto c = start();
+            c.add(cs);
+            return c.result();
+        }
+
+        [[nodiscard]] uint64_t num_states() const noexcept { return m_num_states; }
+    };
+
+}    // namespace mkp
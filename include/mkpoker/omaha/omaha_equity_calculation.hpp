@@ -0,0 +1,110 @@
+/*
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+
+#pragma once
+
+#include <mkpoker/base/card.hpp>
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/cardset_combinations.hpp>
+#include <mkpoker/holdem/holdem_equity_calculation.hpp>
+#include <mkpoker/omaha/omaha_evaluation.hpp>
+#include <mkpoker/util/parallel.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <stdexcept>    // std::runtime_error
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace mkp
+{
+    // calculate equities for a variable number of omaha hands (4 hole cards each) and board (optional), same format as calculate_equities
+    // runouts are split into ranges of their colex indices between num_threads threads, every thread counts into its own counter
+    inline equity_calculation_result_t calculate_equities_omaha(const std::vector<cardset>& hands, const std::vector<card>& vec_board = {},
+                                                                const unsigned num_threads = default_num_threads())
+    {
+        if (const auto sz = hands.size(); sz < 2 || sz > 9)
+        {
+            throw std::runtime_error(fmt::format("invalid number of hands (should be in the range of [2,9], given {})", sz));
+        }
+        cardset all_hole_cards{};
+        for (auto&& hand : hands)
+        {
+            if (hand.size() != c_omaha_num_hole_cards)
+            {
+                throw std::runtime_error(fmt::format("invalid number of hole cards (should be 4, given {})", hand.size()));
+            }
+            all_hole_cards.join(hand);
+        }
+        if (all_hole_cards.size() != hands.size() * c_omaha_num_hole_cards)
+        {
+            throw std::runtime_error(fmt::format("hands contain duplicate cards: number of unique cards ({}) is smaller than {}",
+                                                 all_hole_cards.size(), hands.size() * c_omaha_num_hole_cards));
+        }
+        if (vec_board.size() > 5)
+        {
+            throw std::runtime_error(
+                fmt::format("invalid number of board cards (should be less or equal to five, given {})", vec_board.size()));
+        }
+        const cardset board(vec_board);
+        if (board.size() != vec_board.size() || board.intersects(all_hole_cards))
+        {
+            throw std::runtime_error("board contains duplicate cards or cards of the hands");
+        }
+        const auto all_fixed_cards = board.combine(all_hole_cards);
+
+        // hole card pairs are the same for every runout
+        std::vector<std::array<uint64_t, c_omaha_num_hole_pairs>> hole_pairs;
+        for (auto&& hand : hands)
+        {
+            hole_pairs.push_back(detail::omaha_hole_pairs(hand));
+        }
+
+        const auto num_missing = static_cast<uint8_t>(5 - board.size());
+        std::vector<detail::equity_counter> counters(std::max(1u, num_threads), detail::equity_counter(hands.size()));
+        const auto evaluate_runout = [&](detail::equity_counter& counter, std::vector<uint32_t>& results, const cardset runout) {
+            const auto triples = detail::omaha_board_triples(board.combine(runout));
+            for (unsigned n = 0; n < hands.size(); ++n)
+            {
+                results[n] = detail::evaluate_omaha(hole_pairs[n], triples, c_omaha_num_board_triples);
+            }
+            counter.add(results);
+        };
+
+        // a few chunks per thread, runouts are equally expensive
+        const cardset_combinations runouts(cardset{c_cardset_full & ~all_fixed_cards.as_bitset()}, num_missing);
+        const uint64_t chunk_size = std::max<uint64_t>(1, runouts.size() / (8 * std::max(1u, num_threads)));
+        parallel_for_chunks(runouts.size(), num_threads, chunk_size,
+                            [&](const unsigned thread_id, const uint64_t begin, const uint64_t end) {
+                                std::vector<uint32_t> results(hands.size());
+                                runouts.for_each(begin, end,
+                                                 [&](const cardset runout) { evaluate_runout(counters[thread_id], results, runout); });
+                            });
+
+        for (std::size_t i = 1; i < counters.size(); ++i)
+        {
+            counters[0].merge(counters[i]);
+        }
+        return counters[0].result();
+    }
+
+}    // namespace mkp
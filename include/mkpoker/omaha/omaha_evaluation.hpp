@@ -0,0 +1,144 @@
+/*
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+
+#pragma once
+
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/holdem/holdem_evaluation.hpp>
+#include <mkpoker/holdem/holdem_result.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace mkp
+{
+    inline namespace constants
+    {
+        constexpr uint8_t c_omaha_num_hole_cards = 4;
+        // 4 choose 2
+        constexpr uint8_t c_omaha_num_hole_pairs = 6;
+        // 5 choose 3
+        constexpr uint8_t c_omaha_num_board_triples = 10;
+    }    // namespace constants
+
+    namespace detail
+    {
+        // positions of the cards of every hole card pair
+        inline constexpr std::array<std::array<uint8_t, 2>, c_omaha_num_hole_pairs> c_omaha_hole_pairs{
+            {{0, 1}, {0, 2}, {1, 2}, {0, 3}, {1, 3}, {2, 3}}};
+
+        // positions of the cards of every board triple in colex order, so the first 1 / 4 / 10 triples are all triples
+        // of a flop / turn / river
+        inline constexpr std::array<std::array<uint8_t, 3>, c_omaha_num_board_triples> c_omaha_board_triples{
+            {{0, 1, 2}, {0, 1, 3}, {0, 2, 3}, {1, 2, 3}, {0, 1, 4}, {0, 2, 4}, {1, 2, 4}, {0, 3, 4}, {1, 3, 4}, {2, 3, 4}}};
+
+        // number of board triples for 3, 4 and 5 board cards
+        [[nodiscard]] constexpr uint8_t omaha_num_board_triples(const uint8_t num_board_cards) noexcept
+        {
+            return num_board_cards == 3 ? 1 : (num_board_cards == 4 ? 4 : c_omaha_num_board_triples);
+        }
+
+        // single card bits of a cardset, ascending
+        template <std::size_t N>
+        [[nodiscard]] constexpr std::array<uint64_t, N> omaha_card_bits(const cardset cs) noexcept
+        {
+            std::array<uint64_t, N> ret{};
+            uint64_t mask = cs.as_bitset();
+            for (std::size_t i = 0; i < N && mask != 0; ++i, mask &= mask - 1)
+            {
+                ret[i] = mask & (~mask + 1);
+            }
+            return ret;
+        }
+
+        // bits of all six hole card pairs (4 hole cards)
+        [[nodiscard]] constexpr std::array<uint64_t, c_omaha_num_hole_pairs> omaha_hole_pairs(const cardset hole) noexcept
+        {
+            const auto cards = omaha_card_bits<c_omaha_num_hole_cards>(hole);
+            std::array<uint64_t, c_omaha_num_hole_pairs> ret{};
+            for (uint8_t i = 0; i < c_omaha_num_hole_pairs; ++i)
+            {
+                ret[i] = cards[c_omaha_hole_pairs[i][0]] | cards[c_omaha_hole_pairs[i][1]];
+            }
+            return ret;
+        }
+
+        // bits of all board triples (3 to 5 board cards), see omaha_num_board_triples
+        [[nodiscard]] constexpr std::array<uint64_t, c_omaha_num_board_triples> omaha_board_triples(const cardset board) noexcept
+        {
+            const auto cards = omaha_card_bits<5>(board);
+            std::array<uint64_t, c_omaha_num_board_triples> ret{};
+            for (uint8_t i = 0; i < c_omaha_num_board_triples; ++i)
+            {
+                const auto& [a, b, c] = c_omaha_board_triples[i];
+                ret[i] = cards[a] | cards[b] | cards[c];
+            }
+            return ret;
+        }
+
+        // best result bits of all pair / triple combinations, every combination is exactly 5 cards
+        [[nodiscard]] inline uint32_t evaluate_omaha(const std::array<uint64_t, c_omaha_num_hole_pairs>& pairs,
+                                                     const std::array<uint64_t, c_omaha_num_board_triples>& triples,
+                                                     const uint8_t num_triples) noexcept
+        {
+            uint32_t best = 0;
+            for (uint8_t t = 0; t < num_triples; ++t)
+            {
+                for (const auto pair : pairs)
+                {
+                    best = std::max(best, evaluate<5>(cardset{pair | triples[t]}).as_bitset());
+                }
+            }
+            return best;
+        }
+    }    // namespace detail
+
+    // best hand of exactly two of the four hole cards and exactly three of the (3 to 5) board cards
+    // this algorithm assumes valid input (4 hole cards, 3 to 5 board cards, no duplicates); otherwise, the behavior is undefined
+    [[nodiscard]] inline holdem_result evaluate_omaha_unsafe(const cardset hole, const cardset board) noexcept
+    {
+        return holdem_result_from_bitset(detail::evaluate_omaha(detail::omaha_hole_pairs(hole), detail::omaha_board_triples(board),
+                                                                detail::omaha_num_board_triples(static_cast<uint8_t>(board.size()))));
+    }
+
+    // same as above, throws on invalid input
+    [[nodiscard]] inline holdem_result evaluate_omaha_safe(const cardset hole, const cardset board)
+    {
+        if (hole.size() != c_omaha_num_hole_cards)
+        {
+            throw std::runtime_error("evaluate_omaha_safe(const cardset, const cardset): invalid number of hole cards " +
+                                     std::to_string(hole.size()));
+        }
+        if (board.size() < 3 || board.size() > 5)
+        {
+            throw std::runtime_error("evaluate_omaha_safe(const cardset, const cardset): invalid number of board cards " +
+                                     std::to_string(board.size()));
+        }
+        if (hole.intersects(board))
+        {
+            throw std::runtime_error("evaluate_omaha_safe(const cardset, const cardset): hole and board cards are not disjoint");
+        }
+        return evaluate_omaha_unsafe(hole, board);
+    }
+
+}    // namespace mkp
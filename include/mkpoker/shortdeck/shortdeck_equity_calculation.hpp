@@ -0,0 +1,66 @@
+/*
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+
+#pragma once
+
+#include <mkpoker/base/card.hpp>
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/cardset_combinations.hpp>
+#include <mkpoker/base/hand.hpp>
+#include <mkpoker/holdem/holdem_equity_calculation.hpp>
+#include <mkpoker/shortdeck/shortdeck_evaluation.hpp>
+
+#include <cstdint>
+#include <stdexcept>    // std::runtime_error
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace mkp
+{
+    // calculate equities for variable number of hands and board (optional) with the short deck (36 cards), same format as
+    // calculate_equities
+    inline equity_calculation_result_t calculate_equities_shortdeck(const std::vector<hand_2c>& hands,
+                                                                    const std::vector<card>& vec_board = {})
+    {
+        const auto [board, all_fixed_cards] = detail::equity_calculation_cards(hands, vec_board);
+        if (all_fixed_cards.as_bitset() & ~c_shortdeck_mask)
+        {
+            throw std::runtime_error(
+                fmt::format("hands or board contain cards which are not in the short deck: {}", all_fixed_cards.str()));
+        }
+        detail::equity_counter counter(hands.size());
+
+        // calculate wins / losses and store them
+        std::vector<uint32_t> results(hands.size());
+        const cardset deck{c_shortdeck_mask & ~all_fixed_cards.as_bitset()};
+        cardset_combinations(deck, static_cast<uint8_t>(5 - board.size())).for_each([&](const cardset additional_cards) {
+            const auto runout = additional_cards.combine(board);
+            for (unsigned n = 0; n < hands.size(); ++n)
+            {
+                results[n] = evaluate_shortdeck_unsafe(runout.combine(hands[n].as_cardset())).as_bitset();
+            }
+            counter.add(results);
+        });
+
+        return counter.result();
+    }
+
+}    // namespace mkp
@@ -0,0 +1,144 @@
+/*
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+
+#pragma once
+
+#include <mkpoker/base/card.hpp>
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/rank.hpp>
+#include <mkpoker/holdem/holdem_evaluation.hpp>
+#include <mkpoker/holdem/holdem_lookup_tables.hpp>
+#include <mkpoker/holdem/holdem_result.hpp>
+#include <mkpoker/util/utility.hpp>
+
+#include <bit>
+#include <compare>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace mkp
+{
+    inline namespace constants
+    {
+        // short deck (6+): no twos to fives
+        constexpr uint8_t c_shortdeck_min_rank = c_rank_six;
+        constexpr uint8_t c_shortdeck_num_ranks = c_num_ranks - c_shortdeck_min_rank;
+        constexpr uint8_t c_shortdeck_deck_size = c_shortdeck_num_ranks * c_num_suits;
+
+        // all cards of the short deck as bitset
+        constexpr uint64_t c_shortdeck_mask = []() {
+            const uint64_t ranks = c_mask_ranks & ~((uint64_t(1) << c_shortdeck_min_rank) - 1);
+            return ranks | (ranks << c_num_ranks) | (ranks << (2 * c_num_ranks)) | (ranks << (3 * c_num_ranks));
+        }();
+    }    // namespace constants
+
+    namespace detail
+    {
+        // same as mkpoker_table_straight, but the lowest straight is A-6-7-8-9 (nine high)
+        inline constexpr auto c_shortdeck_table_straight = make_table_straight(c_shortdeck_min_rank);
+
+        // flushes are rarer than full houses in the short deck and rank above them, all other types keep their order
+        [[nodiscard]] constexpr uint32_t shortdeck_order_bits(const uint32_t holdem_bits) noexcept
+        {
+            const auto type = (holdem_bits >> c_offset_type) & c_mask_type;
+            const uint32_t swap = (type == c_flush || type == c_full_house) ? uint32_t(c_flush ^ c_full_house) << c_offset_type : 0;
+            return holdem_bits ^ swap;
+        }
+    }    // namespace detail
+
+    // result of a short deck hand, a holdem_result with the short deck order
+    class shortdeck_result
+    {
+        holdem_result m_result;
+
+       public:
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // CTORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // we only allow valid objects
+        shortdeck_result() = delete;
+
+        constexpr explicit shortdeck_result(const holdem_result result) noexcept : m_result(result) {}
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // ACCESSORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // the underlying result, its type and ranks are the same as in holdem (e.g. c_flush)
+        [[nodiscard]] constexpr holdem_result as_holdem_result() const noexcept { return m_result; }
+
+        [[nodiscard]] constexpr uint8_t type() const noexcept { return m_result.type(); }
+
+        // bit representation, ordered by short deck rules (unlike holdem_result::as_bitset())
+        [[nodiscard]] constexpr uint32_t as_bitset() const noexcept { return detail::shortdeck_order_bits(m_result.as_bitset()); }
+
+        // string representation, e.g. "a flush, Ace high"
+        [[nodiscard]] MKP_CONSTEXPR_STD_STR std::string str() const { return m_result.str(); }
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // COMPARISON
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] constexpr std::strong_ordering operator<=>(const shortdeck_result& other) const noexcept
+        {
+            return as_bitset() <=> other.as_bitset();
+        }
+
+        [[nodiscard]] constexpr bool operator==(const shortdeck_result& other) const noexcept { return as_bitset() == other.as_bitset(); }
+    };
+
+    // evaluation of 5 to 7 cards of the short deck, A-6-7-8-9 is the lowest straight and a flush beats a full house
+    // with at most 7 cards, a flush and a full house / quads exclude each other, so only the order of the results differs from holdem
+    // this algorithm assumes valid input (5 to 7 cards, no card below six); otherwise, the behavior is undefined
+    [[nodiscard]] inline shortdeck_result evaluate_shortdeck_unsafe(const cardset cs) noexcept
+    {
+        // break down into suits
+        const uint64_t mask = cs.as_bitset();
+        const uint16_t mask_c = (mask >> (0 * c_num_ranks)) & c_mask_ranks;
+        const uint16_t mask_d = (mask >> (1 * c_num_ranks)) & c_mask_ranks;
+        const uint16_t mask_h = (mask >> (2 * c_num_ranks)) & c_mask_ranks;
+        const uint16_t mask_s = (mask >> (3 * c_num_ranks)) & c_mask_ranks;
+
+        if (const auto lanes = detail::flush_lanes(mask_c, mask_d, mask_h, mask_s); lanes)
+        {
+            const auto suit = std::countr_zero(lanes) / 16;
+            return shortdeck_result(
+                detail::flush_or_straight_flush<detail::c_shortdeck_table_straight>((mask >> (suit * c_num_ranks)) & c_mask_ranks));
+        }
+        return shortdeck_result(detail::evaluate_no_flush<detail::c_shortdeck_table_straight>(mask_c, mask_d, mask_h, mask_s));
+    }
+
+    // same as above, throws on invalid input
+    [[nodiscard]] inline shortdeck_result evaluate_shortdeck_safe(const cardset cs)
+    {
+        if (cs.size() < 5 || cs.size() > 7)
+        {
+            throw std::runtime_error("evaluate_shortdeck_safe(const cardset): invalid number of cards " + std::to_string(cs.size()));
+        }
+        if (cs.as_bitset() & ~c_shortdeck_mask)
+        {
+            throw std::runtime_error("evaluate_shortdeck_safe(const cardset): cards not in the short deck " + cs.str());
+        }
+        return evaluate_shortdeck_unsafe(cs);
+    }
+
+}    // namespace mkp
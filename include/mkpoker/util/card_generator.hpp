@@ -20,10 +20,16 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #pragma once
 
 #include <mkpoker/base/card.hpp>
+#include <mkpoker/base/cardset.hpp>
 
+#include <array>
+#include <bit>
 #include <cstdint>
+#include <limits>
 #include <random>
 #include <stdexcept>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace mkp
@@ -73,4 +79,186 @@ namespace mkp
         }
     };
 
-}    // namespace mkp
\ No newline at end of file
+    // xoshiro256** by Blackman and Vigna, small and fast, satisfies UniformRandomBitGenerator
+    class xoshiro256ss
+    {
+        std::array<uint64_t, 4> m_state;
+
+        [[nodiscard]] static constexpr uint64_t splitmix64(uint64_t& x) noexcept
+        {
+            uint64_t z = (x += 0x9E3779B97F4A7C15);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+            return z ^ (z >> 31);
+        }
+
+       public:
+        using result_type = uint64_t;
+
+        // the state is filled with splitmix64, as recommended by the authors
+        constexpr explicit xoshiro256ss(uint64_t seed = 1927) noexcept
+            : m_state{splitmix64(seed), splitmix64(seed), splitmix64(seed), splitmix64(seed)}
+        {
+        }
+
+        [[nodiscard]] static constexpr result_type min() noexcept { return 0; }
+        [[nodiscard]] static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+        constexpr result_type operator()() noexcept
+        {
+            const uint64_t ret = std::rotl(m_state[1] * 5, 7) * 9;
+            const uint64_t t = m_state[1] << 17;
+            m_state[2] ^= m_state[0];
+            m_state[3] ^= m_state[1];
+            m_state[1] ^= m_state[2];
+            m_state[0] ^= m_state[3];
+            m_state[2] ^= t;
+            m_state[3] = std::rotl(m_state[3], 45);
+            return ret;
+        }
+
+        // equivalent to 2^128 calls, used to generate non-overlapping streams (e.g. one per thread)
+        constexpr void jump() noexcept
+        {
+            constexpr std::array<uint64_t, 4> c_jump{0x180EC6D33CFD0ABA, 0xD5A61266F0C9392C, 0xA9582618E03FC9AA, 0x39ABDC4529B1661C};
+            std::array<uint64_t, 4> s{};
+            for (auto&& j : c_jump)
+            {
+                for (int b = 0; b < 64; ++b)
+                {
+                    if (j & (uint64_t(1) << b))
+                    {
+                        for (int i = 0; i < 4; ++i)
+                        {
+                            s[i] ^= m_state[i];
+                        }
+                    }
+                    static_cast<void>(operator()());
+                }
+            }
+            m_state = s;
+        }
+
+        // uniform random number in [0, range), Lemire's nearly divisionless method
+        [[nodiscard]] constexpr uint32_t bounded(const uint32_t range) noexcept
+        {
+            uint64_t m = (operator()() >> 32) * range;
+            if (static_cast<uint32_t>(m) < range)
+            {
+                const uint32_t threshold = static_cast<uint32_t>(-range) % range;
+                while (static_cast<uint32_t>(m) < threshold)
+                {
+                    m = (operator()() >> 32) * range;
+                }
+            }
+            return static_cast<uint32_t>(m >> 32);
+        }
+    };
+
+    // deals distinct cards without allocating, the deck is kept between calls and partially shuffled
+    // (fisher-yates) for every deal, which is uniform regardless of the current order of the deck
+    template <uint8_t max_rank = c_rank_ace, uint8_t max_suit = c_suit_spades>
+    class card_dealer
+    {
+        static_assert(max_rank >= c_rank_two && max_rank <= c_rank_ace, "max_rank value out of range");
+        static_assert(max_suit >= c_suit_clubs && max_suit <= c_suit_spades, "max_suit value out of range");
+
+        static constexpr uint8_t c_num_cards = (max_rank + 1) * (max_suit + 1);
+
+        xoshiro256ss m_rng;
+        std::array<uint8_t, c_num_cards> m_deck;
+
+        // moves n random cards of the first "size" cards of deck to the front
+        constexpr void partial_shuffle(uint8_t* deck, const uint8_t size, const uint8_t n) noexcept
+        {
+            for (uint8_t i = 0; i < n; ++i)
+            {
+                const uint8_t j = static_cast<uint8_t>(i + m_rng.bounded(size - i));
+                const uint8_t tmp = deck[i];
+                deck[i] = deck[j];
+                deck[j] = tmp;
+            }
+        }
+
+       public:
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // CTORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // dealers with the same seed but a different stream produce independent sequences,
+        // e.g. use the thread id as stream for reproducible parallel runs
+        constexpr explicit card_dealer(const uint64_t seed = 1927, const uint32_t stream = 0) noexcept : m_rng(seed), m_deck{}
+        {
+            for (uint32_t i = 0; i < stream; ++i)
+            {
+                m_rng.jump();
+            }
+            uint8_t k = 0;
+            for (uint8_t i = 0; i <= max_rank; ++i)
+            {
+                for (uint8_t j = 0; j <= max_suit; ++j)
+                {
+                    m_deck[k++] = static_cast<uint8_t>(i + j * c_num_ranks);
+                }
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // MUTATORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // n distinct cards
+        template <uint8_t N>
+        [[nodiscard]] constexpr std::array<card, N> deal() noexcept
+        {
+            static_assert(N <= c_num_cards, "N greater than number of specified unique cards");
+
+            partial_shuffle(m_deck.data(), c_num_cards, N);
+            return [&]<std::size_t... I>(std::index_sequence<I...>) { return std::array<card, N>{card{m_deck[I]}...}; }
+            (std::make_index_sequence<N>{});
+        }
+
+        // n distinct cards which are not in dead
+        template <uint8_t N>
+        [[nodiscard]] constexpr std::array<card, N> deal(const cardset dead)
+        {
+            // branchless copy of all live cards
+            const uint64_t dead_bits = dead.as_bitset();
+            std::array<uint8_t, c_num_cards> live{};
+            uint8_t size = 0;
+            for (auto&& c : m_deck)
+            {
+                live[size] = c;
+                size += static_cast<uint8_t>(((dead_bits >> c) & 1) ^ 1);
+            }
+            if (N > size)
+            {
+                throw std::runtime_error("card_dealer::deal<" + std::to_string(N) + ">(cardset): not enough live cards");
+            }
+
+            partial_shuffle(live.data(), size, N);
+            return [&]<std::size_t... I>(std::index_sequence<I...>) { return std::array<card, N>{card{live[I]}...}; }
+            (std::make_index_sequence<N>{});
+        }
+
+        // n distinct cards as cardset
+        [[nodiscard]] constexpr cardset deal_cardset(const uint8_t n)
+        {
+            if (n > c_num_cards)
+            {
+                throw std::runtime_error("card_dealer::deal_cardset(uint8_t): n greater than number of specified unique cards");
+            }
+
+            partial_shuffle(m_deck.data(), c_num_cards, n);
+            uint64_t ret = 0;
+            for (uint8_t i = 0; i < n; ++i)
+            {
+                ret |= uint64_t(1) << m_deck[i];
+            }
+            return cardset{ret};
+        }
+
+        [[nodiscard]] constexpr xoshiro256ss& rng() noexcept { return m_rng; }
+    };
+
+}    // namespace mkp
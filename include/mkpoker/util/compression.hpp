@@ -0,0 +1,303 @@
+/*
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace mkp
+{
+    ///////////////////////////////////////////////////////////////////////////////////////
+    // VARINTS
+    ///////////////////////////////////////////////////////////////////////////////////////
+
+    // little endian base 128, 7 bits per byte
+    inline void varint_encode(std::vector<uint8_t>& out, uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            out.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<uint8_t>(value));
+    }
+
+    // decodes the varint at pos and advances pos, throws on truncated input
+    [[nodiscard]] inline uint64_t varint_decode(const std::span<const uint8_t> in, std::size_t& pos)
+    {
+        uint64_t ret = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7)
+        {
+            if (pos == in.size())
+            {
+                throw std::runtime_error("varint_decode(span<uint8_t>, size_t&): truncated input");
+            }
+            const uint8_t byte = in[pos++];
+            ret |= uint64_t(byte & 0x7F) << shift;
+            if (byte < 0x80)
+            {
+                return ret;
+            }
+        }
+        throw std::runtime_error("varint_decode(span<uint8_t>, size_t&): varint too long");
+    }
+
+    // map signed to unsigned integers with small absolute values -> small values
+    [[nodiscard]] constexpr uint64_t zigzag_encode(const int64_t value) noexcept
+    {
+        return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    }
+
+    [[nodiscard]] constexpr int64_t zigzag_decode(const uint64_t value) noexcept
+    {
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////
+    // BIT PACKING
+    ///////////////////////////////////////////////////////////////////////////////////////
+
+    // appends values with a fixed number of bits (lsb first)
+    class bit_writer
+    {
+        std::vector<uint8_t>& m_out;
+        uint64_t m_buffer = 0;
+        unsigned m_bits = 0;
+
+       public:
+        explicit bit_writer(std::vector<uint8_t>& out) noexcept : m_out(out) {}
+
+        void write(const uint32_t value, const unsigned num_bits)
+        {
+            m_buffer |= uint64_t(value) << m_bits;
+            m_bits += num_bits;
+            for (; m_bits >= 8; m_bits -= 8, m_buffer >>= 8)
+            {
+                m_out.push_back(static_cast<uint8_t>(m_buffer));
+            }
+        }
+
+        // writes the remaining bits, padded with zeros
+        void flush()
+        {
+            if (m_bits > 0)
+            {
+                m_out.push_back(static_cast<uint8_t>(m_buffer));
+            }
+            m_buffer = 0;
+            m_bits = 0;
+        }
+    };
+
+    class bit_reader
+    {
+        std::span<const uint8_t> m_in;
+        std::size_t m_pos;
+        uint64_t m_buffer = 0;
+        unsigned m_bits = 0;
+
+       public:
+        bit_reader(const std::span<const uint8_t> in, const std::size_t pos) noexcept : m_in(in), m_pos(pos) {}
+
+        [[nodiscard]] uint32_t read(const unsigned num_bits)
+        {
+            for (; m_bits < num_bits; m_bits += 8)
+            {
+                if (m_pos == m_in.size())
+                {
+                    throw std::runtime_error("bit_reader::read(unsigned): truncated input");
+                }
+                m_buffer |= uint64_t(m_in[m_pos++]) << m_bits;
+            }
+            const auto ret = static_cast<uint32_t>(m_buffer & ((uint64_t(1) << num_bits) - 1));
+            m_buffer >>= num_bits;
+            m_bits -= num_bits;
+            return ret;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////////////
+    // BLOCK COMPRESSION
+    ///////////////////////////////////////////////////////////////////////////////////////
+
+    // byte oriented lz77 in the spirit of lz4: sequences of (token, literals, 16 bit offset, match length), no entropy coding
+    // token: high nibble literal length, low nibble match length - 4, a nibble of 15 is continued by bytes until one is < 255
+    namespace detail
+    {
+        inline constexpr std::size_t c_lz_min_match = 4;
+        // the last bytes of the input are always literals (as in lz4)
+        inline constexpr std::size_t c_lz_last_literals = 5;
+        inline constexpr std::size_t c_lz_max_offset = 65535;
+        inline constexpr unsigned c_lz_hash_bits = 12;
+
+        [[nodiscard]] inline uint32_t lz_read32(const uint8_t* p) noexcept
+        {
+            uint32_t ret;
+            std::memcpy(&ret, p, sizeof(ret));
+            return ret;
+        }
+
+        [[nodiscard]] constexpr uint32_t lz_hash(const uint32_t seq) noexcept { return (seq * 2654435761u) >> (32 - c_lz_hash_bits); }
+
+        inline void lz_write_length(std::vector<uint8_t>& out, std::size_t len)
+        {
+            for (; len >= 255; len -= 255)
+            {
+                out.push_back(255);
+            }
+            out.push_back(static_cast<uint8_t>(len));
+        }
+
+        inline void lz_write_sequence(std::vector<uint8_t>& out, const uint8_t* literals, const std::size_t num_literals,
+                                      const std::size_t offset, const std::size_t match_len)
+        {
+            const std::size_t m = match_len == 0 ? 0 : match_len - c_lz_min_match;
+            out.push_back(static_cast<uint8_t>((std::min<std::size_t>(num_literals, 15) << 4) | std::min<std::size_t>(m, 15)));
+            if (num_literals >= 15)
+            {
+                lz_write_length(out, num_literals - 15);
+            }
+            out.insert(out.end(), literals, literals + num_literals);
+            if (match_len == 0)
+            {
+                return;
+            }
+            out.push_back(static_cast<uint8_t>(offset));
+            out.push_back(static_cast<uint8_t>(offset >> 8));
+            if (m >= 15)
+            {
+                lz_write_length(out, m - 15);
+            }
+        }
+    }    // namespace detail
+
+    // appends the compressed input to out, returns the compressed size
+    inline std::size_t lz_compress(const std::span<const uint8_t> in, std::vector<uint8_t>& out)
+    {
+        const std::size_t begin = out.size();
+        const uint8_t* src = in.data();
+        const std::size_t n = in.size();
+        std::size_t anchor = 0;
+
+        if (n > detail::c_lz_min_match + detail::c_lz_last_literals)
+        {
+            // positions + 1 of the last occurence of each hashed 4 byte sequence, 0 = none
+            std::array<uint32_t, std::size_t(1) << detail::c_lz_hash_bits> table{};
+            const std::size_t limit = n - detail::c_lz_min_match - detail::c_lz_last_literals;
+            for (std::size_t i = 0; i <= limit;)
+            {
+                const uint32_t seq = detail::lz_read32(src + i);
+                const uint32_t h = detail::lz_hash(seq);
+                const std::size_t candidate = table[h];
+                table[h] = static_cast<uint32_t>(i + 1);
+                if (candidate == 0 || i + 1 - candidate > detail::c_lz_max_offset || detail::lz_read32(src + candidate - 1) != seq)
+                {
+                    ++i;
+                    continue;
+                }
+
+                const std::size_t match = candidate - 1;
+                std::size_t len = detail::c_lz_min_match;
+                while (i + len < n - detail::c_lz_last_literals && src[match + len] == src[i + len])
+                {
+                    ++len;
+                }
+                detail::lz_write_sequence(out, src + anchor, i - anchor, i - match, len);
+                i += len;
+                anchor = i;
+            }
+        }
+
+        detail::lz_write_sequence(out, src + anchor, n - anchor, 0, 0);
+        return out.size() - begin;
+    }
+
+    // decompresses into out, which must have exactly the size of the original data, throws on corrupt input
+    inline void lz_decompress(const std::span<const uint8_t> in, const std::span<uint8_t> out)
+    {
+        std::size_t ip = 0;
+        std::size_t op = 0;
+        const auto read_length = [&](std::size_t len) {
+            if (len == 15)
+            {
+                uint8_t byte;
+                do
+                {
+                    if (ip == in.size())
+                    {
+                        throw std::runtime_error("lz_decompress(span<uint8_t>, span<uint8_t>): truncated input");
+                    }
+                    byte = in[ip++];
+                    len += byte;
+                } while (byte == 255);
+            }
+            return len;
+        };
+
+        while (ip < in.size())
+        {
+            const uint8_t token = in[ip++];
+            const std::size_t num_literals = read_length(token >> 4);
+            if (num_literals > in.size() - ip || num_literals > out.size() - op)
+            {
+                throw std::runtime_error("lz_decompress(span<uint8_t>, span<uint8_t>): literals out of bounds");
+            }
+            if (num_literals > 0)
+            {
+                std::memcpy(out.data() + op, in.data() + ip, num_literals);
+            }
+            ip += num_literals;
+            op += num_literals;
+            if (ip == in.size())
+            {
+                break;
+            }
+
+            if (in.size() - ip < 2)
+            {
+                throw std::runtime_error("lz_decompress(span<uint8_t>, span<uint8_t>): truncated input");
+            }
+            const std::size_t offset = in[ip] | (std::size_t(in[ip + 1]) << 8);
+            ip += 2;
+            const std::size_t len = read_length(token & 15) + detail::c_lz_min_match;
+            if (offset == 0 || offset > op || len > out.size() - op)
+            {
+                throw std::runtime_error("lz_decompress(span<uint8_t>, span<uint8_t>): match out of bounds");
+            }
+            // byte by byte, matches may overlap
+            for (std::size_t i = 0; i < len; ++i, ++op)
+            {
+                out[op] = out[op - offset];
+            }
+        }
+
+        if (op != out.size())
+        {
+            throw std::runtime_error("lz_decompress(span<uint8_t>, span<uint8_t>): size of decompressed data does not match");
+        }
+    }
+
+}    // namespace mkp
@@ -0,0 +1,127 @@
+/*
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// runtime dispatch: hot kernels are compiled once per instruction set level (x86-64 gcc/clang only) and the best
+// version for the cpu is selected on first use, so a single binary runs everywhere with the fastest available code
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define MKP_CPU_DISPATCH 1
+#define MKP_TARGET_V2 __attribute__((target("sse4.2,popcnt")))
+#define MKP_TARGET_V3 __attribute__((target("sse4.2,popcnt,avx2,bmi,bmi2,lzcnt,fma")))
+#define MKP_TARGET_V4 __attribute__((target("sse4.2,popcnt,avx2,bmi,bmi2,lzcnt,fma,avx512f,avx512bw,avx512dq,avx512vl")))
+#define MKP_FORCE_INLINE __attribute__((always_inline)) inline
+#else
+#define MKP_CPU_DISPATCH 0
+#define MKP_FORCE_INLINE inline
+#endif
+
+// defines name_generic, name_v2, name_v3, name_v4 which all call name_impl (declared MKP_FORCE_INLINE, so it is
+// compiled for the instruction set of the caller) and the dispatch table name_kernels
+#if MKP_CPU_DISPATCH
+#define MKP_DISPATCH_KERNELS(name, ret, params, args)                           \
+    inline ret name##_generic params { return name##_impl args; }               \
+    MKP_TARGET_V2 inline ret name##_v2 params { return name##_impl args; }      \
+    MKP_TARGET_V3 inline ret name##_v3 params { return name##_impl args; }      \
+    MKP_TARGET_V4 inline ret name##_v4 params { return name##_impl args; }      \
+    inline constexpr ::mkp::dispatch_table_t<ret params> name##_kernels{&name##_generic, &name##_v2, &name##_v3, &name##_v4};
+#else
+#define MKP_DISPATCH_KERNELS(name, ret, params, args)             \
+    inline ret name##_generic params { return name##_impl args; } \
+    inline constexpr ::mkp::dispatch_table_t<ret params> name##_kernels{&name##_generic, nullptr, nullptr, nullptr};
+#endif
+
+namespace mkp
+{
+    // x86-64 micro-architecture levels, every level includes the ones below
+    enum class cpu_level_t : uint8_t
+    {
+        GENERIC = 0,
+        // sse4.2, popcnt
+        V2,
+        // avx2, bmi1/2, lzcnt, fma
+        V3,
+        // avx512 f/bw/dq/vl
+        V4
+    };
+
+    inline namespace constants
+    {
+        constexpr std::size_t c_num_cpu_levels = 4;
+    }    // namespace constants
+
+    [[nodiscard]] constexpr std::string_view to_string(const cpu_level_t level) noexcept
+    {
+        constexpr std::array<std::string_view, c_num_cpu_levels> names{"generic", "x86-64-v2", "x86-64-v3", "x86-64-v4"};
+        return names[static_cast<std::size_t>(level)];
+    }
+
+    // highest level supported by this cpu, detected once
+    [[nodiscard]] inline cpu_level_t cpu_level() noexcept
+    {
+        static const cpu_level_t level = [] {
+#if MKP_CPU_DISPATCH
+            __builtin_cpu_init();
+            if (!__builtin_cpu_supports("sse4.2") || !__builtin_cpu_supports("popcnt"))
+            {
+                return cpu_level_t::GENERIC;
+            }
+            if (!__builtin_cpu_supports("avx2") || !__builtin_cpu_supports("bmi") || !__builtin_cpu_supports("bmi2") ||
+                !__builtin_cpu_supports("fma"))
+            {
+                return cpu_level_t::V2;
+            }
+            if (!__builtin_cpu_supports("avx512f") || !__builtin_cpu_supports("avx512bw") || !__builtin_cpu_supports("avx512dq") ||
+                !__builtin_cpu_supports("avx512vl"))
+            {
+                return cpu_level_t::V3;
+            }
+            return cpu_level_t::V4;
+#else
+            return cpu_level_t::GENERIC;
+#endif
+        }();
+        return level;
+    }
+
+    // one implementation of a kernel per level, nullptr if not compiled for that level
+    template <typename F>
+    using dispatch_table_t = std::array<F*, c_num_cpu_levels>;
+
+    // best implementation for the given level (default: this cpu)
+    template <typename F>
+    [[nodiscard]] F* cpu_dispatch(const dispatch_table_t<F>& kernels, const cpu_level_t level = cpu_level()) noexcept
+    {
+        for (auto i = static_cast<std::size_t>(level); i > 0; --i)
+        {
+            if (kernels[i] != nullptr)
+            {
+                return kernels[i];
+            }
+        }
+        return kernels[0];
+    }
+
+}    // namespace mkp
@@ -0,0 +1,83 @@
+/*
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#if !defined(_WIN32)
+#include <sys/types.h>    // off_t
+#endif
+
+namespace mkp
+{
+    namespace detail
+    {
+        // RAII wrapper for std::FILE
+        using unique_file_t = std::unique_ptr<std::FILE, decltype(&std::fclose)>;
+
+        [[nodiscard]] inline unique_file_t open_file(const std::string& filename, const char* mode)
+        {
+            unique_file_t f(std::fopen(filename.c_str(), mode), &std::fclose);
+            if (!f)
+            {
+                throw std::runtime_error("open_file(const string&, const char*): could not open file '" + filename + "'");
+            }
+            return f;
+        }
+
+        template <typename T>
+        void write_binary(std::FILE* f, const T* data, const std::size_t n)
+        {
+            if (std::fwrite(data, sizeof(T), n, f) != n)
+            {
+                throw std::runtime_error("write_binary(): could not write " + std::to_string(n) + " elements");
+            }
+        }
+
+        // absolute position in the file, unlike std::fseek also beyond 2 GB where long is 32 bit (windows)
+        inline void seek_file(std::FILE* f, const uint64_t offset)
+        {
+#if defined(_WIN32)
+            const int ret = _fseeki64(f, static_cast<__int64>(offset), SEEK_SET);
+#else
+            const int ret = fseeko(f, static_cast<off_t>(offset), SEEK_SET);
+#endif
+            if (ret != 0)
+            {
+                throw std::runtime_error("seek_file(): could not seek to offset " + std::to_string(offset));
+            }
+        }
+
+        template <typename T>
+        void read_binary(std::FILE* f, T* data, const std::size_t n)
+        {
+            if (std::fread(data, sizeof(T), n, f) != n)
+            {
+                throw std::runtime_error("read_binary(): could not read " + std::to_string(n) + " elements");
+            }
+        }
+    }    // namespace detail
+
+}    // namespace mkp
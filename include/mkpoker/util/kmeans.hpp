@@ -0,0 +1,330 @@
+/*
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#pragma once
+
+#include <mkpoker/util/parallel.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace mkp
+{
+    // L1 on cumulative histograms is the earth mover's distance of the histograms (in one dimension)
+    enum class kmeans_distance_t : uint8_t
+    {
+        L1 = 0,
+        L2
+    };
+
+    struct kmeans_options_t
+    {
+        uint32_t m_max_iterations = 100;
+        // stop if at most this fraction of points changed their cluster
+        double m_tolerance = 0.0;
+        uint64_t m_seed = 1927;
+        unsigned m_num_threads = default_num_threads();
+        // skip distance computations with Hamerly's bounds, only disable for testing
+        bool m_pruning = true;
+    };
+
+    struct kmeans_result_t
+    {
+        // k * dim values
+        std::vector<float> m_centers;
+        std::vector<uint32_t> m_assignment;
+        // sum of the distances of all points to their center
+        double m_cost = 0.0;
+        uint32_t m_iterations = 0;
+        // number of point/center distances computed (to see the effect of pruning)
+        uint64_t m_num_distances = 0;
+    };
+
+    namespace detail
+    {
+        template <typename T>
+        [[nodiscard]] inline float kmeans_distance(const T* x, const float* c, const std::size_t dim, const kmeans_distance_t kind) noexcept
+        {
+            float ret = 0.0f;
+            if (kind == kmeans_distance_t::L1)
+            {
+                for (std::size_t i = 0; i < dim; ++i)
+                {
+                    ret += std::abs(static_cast<float>(x[i]) - c[i]);
+                }
+                return ret;
+            }
+            for (std::size_t i = 0; i < dim; ++i)
+            {
+                const float diff = static_cast<float>(x[i]) - c[i];
+                ret += diff * diff;
+            }
+            return std::sqrt(ret);
+        }
+    }    // namespace detail
+
+    // parallel k-means (seeded with k-means++) for n points with dim dimensions stored consecutively in points
+    // uses the triangle inequality to skip most distance computations after the first iterations
+    // G. Hamerly, "Making k-means even faster", SIAM International Conference on Data Mining, 2010
+    template <typename T>
+    [[nodiscard]] kmeans_result_t kmeans(const std::span<const T> points, const std::size_t dim, const uint32_t k,
+                                         const kmeans_distance_t kind, const kmeans_options_t& options = {})
+    {
+        if (dim == 0 || points.size() % dim != 0 || k == 0 || k > points.size() / dim)
+        {
+            throw std::runtime_error("kmeans(): invalid arguments, " + std::to_string(points.size()) + " values, dim " + std::to_string(dim) +
+                                     ", k " + std::to_string(k));
+        }
+
+        const std::size_t n = points.size() / dim;
+        const unsigned num_threads = std::max(1u, options.m_num_threads);
+        const auto point = [&](const std::size_t i) { return points.data() + i * dim; };
+
+        kmeans_result_t ret{};
+        ret.m_centers.resize(k * dim);
+        ret.m_assignment.resize(n);
+        const auto center = [&](const std::size_t c) { return ret.m_centers.data() + c * dim; };
+        std::vector<uint64_t> num_distances(num_threads, 0);
+
+        //
+        // k-means++ seeding
+        //
+        std::mt19937_64 rng(options.m_seed);
+        {
+            std::vector<float> min_dist(n, std::numeric_limits<float>::max());
+            std::size_t chosen = std::uniform_int_distribution<std::size_t>(0, n - 1)(rng);
+            for (uint32_t c = 0; c < k; ++c)
+            {
+                std::copy(point(chosen), point(chosen) + dim, center(c));
+
+                std::vector<double> partial(num_threads, 0.0);
+                parallel_for_chunks(n, num_threads, 4096, [&](const unsigned thread_id, const uint64_t begin, const uint64_t end) {
+                    for (uint64_t i = begin; i < end; ++i)
+                    {
+                        const float d = detail::kmeans_distance(point(i), center(c), dim, kind);
+                        if (d < min_dist[i])
+                        {
+                            min_dist[i] = d;
+                            ret.m_assignment[i] = c;
+                        }
+                        partial[thread_id] += double(min_dist[i]) * min_dist[i];
+                    }
+                    num_distances[thread_id] += end - begin;
+                });
+
+                // next center with probability proportional to the squared distance to the closest center
+                double total = 0.0;
+                for (auto&& e : partial)
+                {
+                    total += e;
+                }
+                if (total <= 0.0)
+                {
+                    // less than k distinct points: any point will do
+                    chosen = std::uniform_int_distribution<std::size_t>(0, n - 1)(rng);
+                    continue;
+                }
+                double r = std::uniform_real_distribution<double>(0.0, total)(rng);
+                chosen = n - 1;
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    r -= double(min_dist[i]) * min_dist[i];
+                    if (r < 0.0)
+                    {
+                        chosen = i;
+                        break;
+                    }
+                }
+            }
+        }
+
+        //
+        // Lloyd iterations with Hamerly's bounds, upper: distance to own center, lower: distance to second closest center
+        //
+        std::vector<float> upper(n);
+        std::vector<float> lower(n);
+        const auto assign_full = [&](const std::size_t i, uint64_t& cnt) {
+            float d1 = std::numeric_limits<float>::max();
+            float d2 = std::numeric_limits<float>::max();
+            uint32_t best = 0;
+            for (uint32_t c = 0; c < k; ++c)
+            {
+                const float d = detail::kmeans_distance(point(i), center(c), dim, kind);
+                if (d < d1)
+                {
+                    d2 = d1;
+                    d1 = d;
+                    best = c;
+                }
+                else if (d < d2)
+                {
+                    d2 = d;
+                }
+            }
+            cnt += k;
+            const bool changed = best != ret.m_assignment[i];
+            ret.m_assignment[i] = best;
+            upper[i] = d1;
+            lower[i] = d2;
+            return changed;
+        };
+
+        parallel_for_chunks(n, num_threads, 4096, [&](const unsigned thread_id, const uint64_t begin, const uint64_t end) {
+            for (uint64_t i = begin; i < end; ++i)
+            {
+                static_cast<void>(assign_full(i, num_distances[thread_id]));
+            }
+        });
+
+        std::vector<float> old_centers(k * dim);
+        std::vector<float> drift(k);
+        std::vector<float> half_min_center_dist(k);
+        for (ret.m_iterations = 1; ret.m_iterations <= options.m_max_iterations; ++ret.m_iterations)
+        {
+            // 1) move centers to the mean of their points, per thread sums are merged afterwards
+            std::vector<std::vector<double>> sums(num_threads, std::vector<double>(k * dim, 0.0));
+            std::vector<std::vector<uint64_t>> counts(num_threads, std::vector<uint64_t>(k, 0));
+            parallel_for_chunks(n, num_threads, 4096, [&](const unsigned thread_id, const uint64_t begin, const uint64_t end) {
+                auto& sum = sums[thread_id];
+                auto& count = counts[thread_id];
+                for (uint64_t i = begin; i < end; ++i)
+                {
+                    const uint32_t c = ret.m_assignment[i];
+                    ++count[c];
+                    for (std::size_t j = 0; j < dim; ++j)
+                    {
+                        sum[c * dim + j] += static_cast<double>(point(i)[j]);
+                    }
+                }
+            });
+
+            old_centers = ret.m_centers;
+            for (uint32_t c = 0; c < k; ++c)
+            {
+                uint64_t count = 0;
+                for (unsigned t = 0; t < num_threads; ++t)
+                {
+                    count += counts[t][c];
+                }
+                // empty clusters keep their center
+                if (count > 0)
+                {
+                    for (std::size_t j = 0; j < dim; ++j)
+                    {
+                        double sum = 0.0;
+                        for (unsigned t = 0; t < num_threads; ++t)
+                        {
+                            sum += sums[t][c * dim + j];
+                        }
+                        center(c)[j] = static_cast<float>(sum / count);
+                    }
+                }
+                drift[c] = detail::kmeans_distance(old_centers.data() + c * dim, center(c), dim, kind);
+            }
+
+            // 2) update bounds: own center moved by drift, any other center moved by at most max drift
+            const auto it_max = std::max_element(drift.cbegin(), drift.cend());
+            const auto max_idx = static_cast<uint32_t>(it_max - drift.cbegin());
+            float max_drift = *it_max;
+            float second_drift = 0.0f;
+            for (uint32_t c = 0; c < k; ++c)
+            {
+                if (c != max_idx)
+                {
+                    second_drift = std::max(second_drift, drift[c]);
+                }
+            }
+            for (uint32_t c = 0; c < k; ++c)
+            {
+                float min_dist = std::numeric_limits<float>::max();
+                for (uint32_t c2 = 0; c2 < k; ++c2)
+                {
+                    if (c2 != c)
+                    {
+                        min_dist = std::min(min_dist, detail::kmeans_distance(center(c), center(c2), dim, kind));
+                    }
+                }
+                half_min_center_dist[c] = min_dist / 2;
+            }
+
+            // 3) reassign points, only if the bounds do not rule out a closer center
+            std::vector<uint64_t> changed(num_threads, 0);
+            parallel_for_chunks(n, num_threads, 4096, [&](const unsigned thread_id, const uint64_t begin, const uint64_t end) {
+                for (uint64_t i = begin; i < end; ++i)
+                {
+                    const uint32_t a = ret.m_assignment[i];
+                    if (options.m_pruning)
+                    {
+                        upper[i] += drift[a];
+                        lower[i] -= a == max_idx ? second_drift : max_drift;
+
+                        const float bound = std::max(half_min_center_dist[a], lower[i]);
+                        if (upper[i] <= bound)
+                        {
+                            continue;
+                        }
+                        upper[i] = detail::kmeans_distance(point(i), center(a), dim, kind);
+                        ++num_distances[thread_id];
+                        if (upper[i] <= bound)
+                        {
+                            continue;
+                        }
+                    }
+                    changed[thread_id] += assign_full(i, num_distances[thread_id]) ? 1 : 0;
+                }
+            });
+
+            uint64_t num_changed = 0;
+            for (auto&& e : changed)
+            {
+                num_changed += e;
+            }
+            if (num_changed <= options.m_tolerance * n)
+            {
+                break;
+            }
+        }
+        ret.m_iterations = std::min(ret.m_iterations, options.m_max_iterations);
+
+        // exact cost for the final assignment
+        std::vector<double> partial(num_threads, 0.0);
+        parallel_for_chunks(n, num_threads, 4096, [&](const unsigned thread_id, const uint64_t begin, const uint64_t end) {
+            for (uint64_t i = begin; i < end; ++i)
+            {
+                partial[thread_id] += detail::kmeans_distance(point(i), center(ret.m_assignment[i]), dim, kind);
+            }
+        });
+        for (unsigned t = 0; t < num_threads; ++t)
+        {
+            ret.m_cost += partial[t];
+            ret.m_num_distances += num_distances[t];
+        }
+
+        return ret;
+    }
+
+}    // namespace mkp
@@ -0,0 +1,203 @@
+/*
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>       // open
+#include <sys/mman.h>    // mmap, munmap, madvise
+#include <sys/stat.h>    // fstat
+#include <unistd.h>      // close
+#endif
+
+namespace mkp
+{
+    // expected access pattern, passed on to the OS (ignored on windows)
+    enum class mapped_file_advice_t : uint8_t
+    {
+        NORMAL = 0,
+        RANDOM,
+        SEQUENTIAL,
+        WILLNEED
+    };
+
+    // read-only memory mapping of a whole file, the pages are shared between all processes mapping the same file
+    class mapped_file
+    {
+        const std::byte* m_data = nullptr;
+        std::size_t m_size = 0;
+#if defined(_WIN32)
+        HANDLE m_file = INVALID_HANDLE_VALUE;
+        HANDLE m_mapping = nullptr;
+#endif
+
+        void unmap() noexcept
+        {
+#if defined(_WIN32)
+            if (m_data != nullptr)
+            {
+                UnmapViewOfFile(m_data);
+            }
+            if (m_mapping != nullptr)
+            {
+                CloseHandle(m_mapping);
+            }
+            if (m_file != INVALID_HANDLE_VALUE)
+            {
+                CloseHandle(m_file);
+            }
+            m_file = INVALID_HANDLE_VALUE;
+            m_mapping = nullptr;
+#else
+            if (m_data != nullptr)
+            {
+                munmap(const_cast<std::byte*>(m_data), m_size);
+            }
+#endif
+            m_data = nullptr;
+            m_size = 0;
+        }
+
+       public:
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // CTORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        // map the file, throws if the file can not be opened or is empty
+        explicit mapped_file(const std::string& filename, const mapped_file_advice_t advice = mapped_file_advice_t::NORMAL)
+        {
+#if defined(_WIN32)
+            static_cast<void>(advice);
+            m_file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            LARGE_INTEGER size{};
+            if (m_file == INVALID_HANDLE_VALUE || !GetFileSizeEx(m_file, &size) || size.QuadPart == 0)
+            {
+                unmap();
+                throw std::runtime_error("mapped_file(const string&): could not open file '" + filename + "'");
+            }
+            m_size = static_cast<std::size_t>(size.QuadPart);
+            m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (m_mapping != nullptr)
+            {
+                m_data = static_cast<const std::byte*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+            }
+            if (m_data == nullptr)
+            {
+                unmap();
+                throw std::runtime_error("mapped_file(const string&): could not map file '" + filename + "'");
+            }
+#else
+            const int fd = open(filename.c_str(), O_RDONLY);
+            struct stat st
+            {
+            };
+            if (fd < 0 || fstat(fd, &st) != 0 || st.st_size == 0)
+            {
+                if (fd >= 0)
+                {
+                    close(fd);
+                }
+                throw std::runtime_error("mapped_file(const string&): could not open file '" + filename + "'");
+            }
+            m_size = static_cast<std::size_t>(st.st_size);
+            void* ptr = mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+            // the mapping stays valid after closing the file descriptor
+            close(fd);
+            if (ptr == MAP_FAILED)
+            {
+                m_size = 0;
+                throw std::runtime_error("mapped_file(const string&): could not map file '" + filename + "'");
+            }
+            m_data = static_cast<const std::byte*>(ptr);
+
+            switch (advice)
+            {
+                case mapped_file_advice_t::RANDOM:
+                    madvise(ptr, m_size, MADV_RANDOM);
+                    break;
+                case mapped_file_advice_t::SEQUENTIAL:
+                    madvise(ptr, m_size, MADV_SEQUENTIAL);
+                    break;
+                case mapped_file_advice_t::WILLNEED:
+                    madvise(ptr, m_size, MADV_WILLNEED);
+                    break;
+                default:
+                    break;
+            }
+#endif
+        }
+
+        mapped_file(const mapped_file&) = delete;
+        mapped_file& operator=(const mapped_file&) = delete;
+
+        mapped_file(mapped_file&& other) noexcept
+            : m_data(std::exchange(other.m_data, nullptr)),
+              m_size(std::exchange(other.m_size, 0))
+#if defined(_WIN32)
+              ,
+              m_file(std::exchange(other.m_file, INVALID_HANDLE_VALUE)),
+              m_mapping(std::exchange(other.m_mapping, nullptr))
+#endif
+        {
+        }
+
+        mapped_file& operator=(mapped_file&& other) noexcept
+        {
+            if (this != &other)
+            {
+                unmap();
+                m_data = std::exchange(other.m_data, nullptr);
+                m_size = std::exchange(other.m_size, 0);
+#if defined(_WIN32)
+                m_file = std::exchange(other.m_file, INVALID_HANDLE_VALUE);
+                m_mapping = std::exchange(other.m_mapping, nullptr);
+#endif
+            }
+            return *this;
+        }
+
+        ~mapped_file() { unmap(); }
+
+        ///////////////////////////////////////////////////////////////////////////////////////
+        // ACCESSORS
+        ///////////////////////////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] const std::byte* data() const noexcept { return m_data; }
+
+        [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+
+        [[nodiscard]] std::span<const std::byte> bytes() const noexcept { return {m_data, m_size}; }
+    };
+
+}    // namespace mkp
@@ -0,0 +1,101 @@
+/*
+
+Copyright (C) Michael Knörzer
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Affero General Public License as
+published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Affero General Public License for more details.
+
+You should have received a copy of the GNU Affero General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mkp
+{
+    // number of threads to use if the caller does not care
+    [[nodiscard]] inline unsigned default_num_threads() noexcept { return std::max(1u, std::thread::hardware_concurrency()); }
+
+    // calls f(thread_id, begin, end) for chunks of [0, n) on num_threads threads, chunks are handed out dynamically
+    // the first exception thrown by f is rethrown in the calling thread
+    template <typename F>
+    void parallel_for_chunks(const uint64_t n, const unsigned num_threads, const uint64_t chunk_size, F&& f)
+    {
+        std::atomic<uint64_t> next{0};
+        std::exception_ptr error = nullptr;
+        std::mutex mtx;
+
+        auto worker = [&](const unsigned thread_id) {
+            try
+            {
+                for (uint64_t begin = next.fetch_add(chunk_size); begin < n; begin = next.fetch_add(chunk_size))
+                {
+                    f(thread_id, begin, std::min(n, begin + chunk_size));
+                }
+            }
+            catch (...)
+            {
+                const std::lock_guard<std::mutex> lock(mtx);
+                if (!error)
+                {
+                    error = std::current_exception();
+                }
+                // stop handing out work
+                next = n;
+            }
+        };
+
+        if (num_threads <= 1)
+        {
+            worker(0);
+        }
+        else
+        {
+            std::vector<std::thread> threads;
+            threads.reserve(num_threads);
+            for (unsigned i = 0; i < num_threads; ++i)
+            {
+                threads.emplace_back(worker, i);
+            }
+            for (auto&& t : threads)
+            {
+                t.join();
+            }
+        }
+
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    // calls f(i) for every i in [0, n) on num_threads threads
+    template <typename F>
+    void parallel_for(const uint64_t n, const unsigned num_threads, F&& f)
+    {
+        constexpr uint64_t c_chunk_size = 1024;
+        parallel_for_chunks(n, num_threads, c_chunk_size, [&](const unsigned, const uint64_t begin, const uint64_t end) {
+            for (uint64_t i = begin; i < end; ++i)
+            {
+                f(i);
+            }
+        });
+    }
+
+}    // namespace mkp
@@ -0,0 +1,116 @@
+#include <mkpoker/cfr/card_abstraction_buckets.hpp>
+#include <mkpoker/game/game.hpp>
+#include <mkpoker/util/card_generator.hpp>
+#include <mkpoker/util/file.hpp>
+#include <mkpoker/util/mapped_file.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace mkp;
+
+namespace
+{
+    constexpr std::array<gb_gamestate_t, c_num_streets> c_streets{gb_gamestate_t::PREFLOP_BET, gb_gamestate_t::FLOP_BET,
+                                                                  gb_gamestate_t::TURN_BET, gb_gamestate_t::RIVER_BET};
+
+    // bucket file without data (sparse, all zero) except for the buckets of cards, bucket = 1000 * street + 7
+    template <typename T>
+    void write_test_file(const std::string& filename, const gamecards<2>& cards)
+    {
+        const auto header = bucket_file_header_t::make({169, 2000, 3000, 70000}, sizeof(T));
+        {
+            const auto f = detail::open_file(filename, "wb");
+            detail::write_binary(f.get(), &header, 1);
+        }
+        std::filesystem::resize_file(filename, header.file_size());
+
+        const auto f = detail::open_file(filename, "r+b");
+        for (uint8_t i = 0; i < c_num_streets; ++i)
+        {
+            const T value = static_cast<T>(1000 * i + 7);
+            const auto idx = canonical_hand_index(c_streets[i], 0, cards);
+            // river offsets are beyond 2 GB
+            detail::seek_file(f.get(), header.m_offsets[i] + idx * sizeof(T));
+            detail::write_binary(f.get(), &value, 1);
+        }
+    }
+}    // namespace
+
+TEST(tcard_abstraction_buckets, mapped_file)
+{
+    const std::string filename{"mapped_file_test.bin"};
+    {
+        const auto f = detail::open_file(filename, "wb");
+        const std::array<uint32_t, 4> data{1, 2, 3, 0xDEADBEEF};
+        detail::write_binary(f.get(), data.data(), data.size());
+    }
+
+    mapped_file mf(filename);
+    EXPECT_EQ(mf.size(), 16);
+    EXPECT_EQ(reinterpret_cast<const uint32_t*>(mf.data())[3], 0xDEADBEEF);
+
+    // move
+    mapped_file mf2(std::move(mf));
+    EXPECT_EQ(mf.data(), nullptr);
+    EXPECT_EQ(mf2.bytes().size(), 16);
+    EXPECT_EQ(reinterpret_cast<const uint32_t*>(mf2.data())[0], 1);
+
+    EXPECT_THROW(mapped_file("file_does_not_exist.bin"), std::runtime_error);
+    std::filesystem::remove(filename);
+}
+
+TEST(tcard_abstraction_buckets, card_abstraction_mmap)
+{
+    const std::string filename{"card_abstraction_mmap_test.bin"};
+    card_generator cgen{};
+    const gamecards<2> cards(cgen.generate_v(9));
+
+    // uint16
+    {
+        write_test_file<uint16_t>(filename, cards);
+        const card_abstraction_mmap<2> abstraction(filename);
+        // reading the file into memory must give the same result
+        const card_abstraction_buckets<2> abstraction_mem(filename);
+        EXPECT_EQ(abstraction.size(gb_gamestate_t::RIVER_BET), 70000);
+        EXPECT_EQ(abstraction.size(gb_gamestate_t::GAME_FIN), 70000);
+        for (uint8_t i = 0; i < c_num_streets; ++i)
+        {
+            EXPECT_EQ(abstraction.id(c_streets[i], 0, cards), 1000 * i + 7);
+            EXPECT_EQ(abstraction_mem.id(c_streets[i], 0, cards), 1000 * i + 7);
+            EXPECT_EQ(abstraction.id(c_streets[i], 1, cards), abstraction_mem.id(c_streets[i], 1, cards));
+        }
+    }
+
+    // uint32
+    {
+        write_test_file<uint32_t>(filename, cards);
+        const card_abstraction_mmap<2> abstraction(filename);
+        EXPECT_EQ(abstraction.header().m_entry_size, sizeof(uint32_t));
+        for (uint8_t i = 0; i < c_num_streets; ++i)
+        {
+            EXPECT_EQ(abstraction.id(c_streets[i], 0, cards), 1000 * i + 7);
+        }
+
+        // buckets do not fit
+        EXPECT_THROW((card_abstraction_mmap<2, uint16_t>(filename)), std::runtime_error);
+        EXPECT_THROW(static_cast<void>(load_bucket_file<uint16_t>(filename)), std::runtime_error);
+    }
+
+    // truncated file, the tables have to be checked against the size of the file
+    std::filesystem::resize_file(filename, std::filesystem::file_size(filename) - 1);
+    EXPECT_THROW(card_abstraction_mmap<2>{filename}, std::runtime_error);
+    EXPECT_THROW(static_cast<void>(load_bucket_file<uint32_t>(filename)), std::runtime_error);
+    std::filesystem::resize_file(filename, 1000);
+    EXPECT_THROW(card_abstraction_mmap<2>{filename}, std::runtime_error);
+    EXPECT_THROW(static_cast<void>(load_bucket_file<uint32_t>(filename)), std::runtime_error);
+    EXPECT_THROW(card_abstraction_mmap<2>{"file_does_not_exist.bin"}, std::runtime_error);
+
+    std::filesystem::remove(filename);
+}
@@ -0,0 +1,81 @@
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/combo.hpp>
+#include <mkpoker/base/hand.hpp>
+#include <mkpoker/cfr/card_abstraction_ehs.hpp>
+#include <mkpoker/holdem/holdem_evaluation.hpp>
+#include <mkpoker/util/card_generator.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace mkp;
+
+TEST(tcard_abstraction_ehs, river_hand_strengths_brute_force)
+{
+    card_generator cgen{};
+    for (int i = 0; i < 20; ++i)
+    {
+        const cardset board(cgen.generate_v(5));
+        const auto strengths = river_hand_strengths(board);
+
+        for (uint16_t combo = 0; combo < c_num_combos; combo += 7)
+        {
+            const cardset hand{make_bitset(detail::c_combo_cards[combo][0], detail::c_combo_cards[combo][1])};
+            if (hand.intersects(board))
+            {
+                EXPECT_EQ(strengths[combo], 0);
+                continue;
+            }
+
+            const auto hero = evaluate_unsafe(hand.combine(board));
+            uint16_t expected = 0;
+            for (uint16_t opp = 0; opp < c_num_combos; ++opp)
+            {
+                const cardset opp_hand{make_bitset(detail::c_combo_cards[opp][0], detail::c_combo_cards[opp][1])};
+                if (opp_hand.intersects(board) || opp_hand.intersects(hand))
+                {
+                    continue;
+                }
+                const auto villain = evaluate_unsafe(opp_hand.combine(board));
+                expected += hero > villain ? 2 : (hero == villain ? 1 : 0);
+            }
+            EXPECT_EQ(strengths[combo], expected);
+        }
+    }
+
+    EXPECT_THROW(static_cast<void>(river_hand_strengths(cardset("AcKcQc"))), std::runtime_error);
+}
+
+TEST(tcard_abstraction_ehs, river_hand_strengths_nuts)
+{
+    // royal flush on board: everybody ties
+    const auto strengths = river_hand_strengths(cardset("AsKsQsJsTs"));
+    for (uint16_t combo = 0; combo < c_num_combos; ++combo)
+    {
+        const cardset hand{make_bitset(detail::c_combo_cards[combo][0], detail::c_combo_cards[combo][1])};
+        EXPECT_EQ(strengths[combo], hand.intersects(cardset("AsKsQsJsTs")) ? 0 : c_river_strength_max / 2);
+    }
+}
+
+TEST(tcard_abstraction_ehs, percentile_buckets)
+{
+    const std::vector<float> values{0.5f, 0.1f, 0.9f, 0.3f, 0.3f, 0.7f, 0.2f, 1.0f};
+    const auto buckets = percentile_buckets(values, 4, 2);
+    const std::vector<uint16_t> expected{2, 0, 3, 1, 1, 2, 0, 3};
+    EXPECT_EQ(buckets, expected);
+
+    // integral values must give the same result
+    const std::vector<uint16_t> values_int{50, 10, 90, 30, 30, 70, 20, 100};
+    EXPECT_EQ(percentile_buckets(values_int, 4, 2), expected);
+
+    // every value is in its own bucket
+    const auto buckets_8 = percentile_buckets(values_int, 8, 1);
+    const std::vector<uint16_t> expected_8{4, 0, 6, 2, 2, 5, 1, 7};
+    EXPECT_EQ(buckets_8, expected_8);
+
+    EXPECT_THROW(static_cast<void>(percentile_buckets(values, 0)), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(percentile_buckets(std::vector<float>{}, 4)), std::runtime_error);
+}
@@ -0,0 +1,145 @@
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/combo.hpp>
+#include <mkpoker/cfr/card_abstraction_buckets.hpp>
+#include <mkpoker/cfr/card_abstraction_kmeans.hpp>
+#include <mkpoker/holdem/holdem_evaluation.hpp>
+#include <mkpoker/util/card_generator.hpp>
+#include <mkpoker/util/kmeans.hpp>
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace mkp;
+
+namespace
+{
+    // n points around each of the given centers
+    std::vector<float> make_blobs(const std::vector<std::array<float, 2>>& centers, const unsigned n)
+    {
+        std::mt19937 rng(42);
+        std::normal_distribution<float> dist(0.0f, 1.0f);
+        std::vector<float> ret;
+        for (auto&& c : centers)
+        {
+            for (unsigned i = 0; i < n; ++i)
+            {
+                ret.push_back(c[0] + dist(rng));
+                ret.push_back(c[1] + dist(rng));
+            }
+        }
+        return ret;
+    }
+}    // namespace
+
+TEST(tcard_abstraction_kmeans, kmeans_blobs)
+{
+    constexpr unsigned n = 500;
+    const auto points = make_blobs({{0.0f, 0.0f}, {50.0f, 0.0f}, {0.0f, 50.0f}, {50.0f, 50.0f}}, n);
+
+    for (auto kind : {kmeans_distance_t::L1, kmeans_distance_t::L2})
+    {
+        kmeans_options_t options{};
+        options.m_num_threads = 3;
+        const auto result = kmeans<float>(points, 2, 4, kind, options);
+
+        // every blob ends up in its own cluster
+        for (unsigned b = 0; b < 4; ++b)
+        {
+            for (unsigned i = 0; i < n; ++i)
+            {
+                EXPECT_EQ(result.m_assignment[b * n + i], result.m_assignment[b * n]);
+            }
+            for (unsigned b2 = 0; b2 < b; ++b2)
+            {
+                EXPECT_NE(result.m_assignment[b * n], result.m_assignment[b2 * n]);
+            }
+        }
+    }
+}
+
+TEST(tcard_abstraction_kmeans, kmeans_pruning)
+{
+    // overlapping blobs, pruning must not change the result, but save distance computations
+    const auto points = make_blobs({{0.0f, 0.0f}, {3.0f, 0.0f}, {0.0f, 3.0f}, {3.0f, 3.0f}, {1.5f, 1.5f}}, 400);
+
+    kmeans_options_t options{};
+    options.m_num_threads = 2;
+    options.m_max_iterations = 50;
+    const auto pruned = kmeans<float>(points, 2, 8, kmeans_distance_t::L2, options);
+    options.m_pruning = false;
+    const auto full = kmeans<float>(points, 2, 8, kmeans_distance_t::L2, options);
+
+    EXPECT_EQ(pruned.m_assignment, full.m_assignment);
+    EXPECT_EQ(pruned.m_iterations, full.m_iterations);
+    EXPECT_NEAR(pruned.m_cost, full.m_cost, 1e-3 * full.m_cost);
+    EXPECT_LT(pruned.m_num_distances, full.m_num_distances);
+}
+
+TEST(tcard_abstraction_kmeans, kmeans_invalid_args)
+{
+    const std::vector<float> points{1.0f, 2.0f, 3.0f, 4.0f};
+    EXPECT_THROW(static_cast<void>(kmeans<float>(points, 3, 1, kmeans_distance_t::L1)), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(kmeans<float>(points, 2, 3, kmeans_distance_t::L1)), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(kmeans<float>(points, 2, 0, kmeans_distance_t::L1)), std::runtime_error);
+}
+
+TEST(tcard_abstraction_kmeans, river_ochs_brute_force)
+{
+    constexpr uint32_t num_clusters = 3;
+    std::array<uint8_t, c_num_combos> clusters{};
+    for (uint16_t i = 0; i < c_num_combos; ++i)
+    {
+        clusters[i] = static_cast<uint8_t>(i % num_clusters);
+    }
+
+    card_generator cgen{};
+    std::vector<uint8_t> out(c_num_combos * num_clusters);
+    for (int i = 0; i < 5; ++i)
+    {
+        const cardset board(cgen.generate_v(5));
+        river_ochs(board, clusters, num_clusters, out);
+
+        for (uint16_t combo = 0; combo < c_num_combos; combo += 13)
+        {
+            const cardset hand{make_bitset(detail::c_combo_cards[combo][0], detail::c_combo_cards[combo][1])};
+            if (hand.intersects(board))
+            {
+                continue;
+            }
+
+            const auto hero = evaluate_unsafe(hand.combine(board));
+            std::array<int, num_clusters> value{};
+            std::array<int, num_clusters> count{};
+            for (uint16_t opp = 0; opp < c_num_combos; ++opp)
+            {
+                const cardset opp_hand{make_bitset(detail::c_combo_cards[opp][0], detail::c_combo_cards[opp][1])};
+                if (opp_hand.intersects(board) || opp_hand.intersects(hand))
+                {
+                    continue;
+                }
+                const auto villain = evaluate_unsafe(opp_hand.combine(board));
+                value[clusters[opp]] += hero > villain ? 2 : (hero == villain ? 1 : 0);
+                ++count[clusters[opp]];
+            }
+            for (uint32_t c = 0; c < num_clusters; ++c)
+            {
+                EXPECT_EQ(out[combo * num_clusters + c], (255 * value[c] + count[c]) / (2 * count[c]));
+            }
+        }
+    }
+
+    EXPECT_THROW(river_ochs(cardset("AcKcQcJcTc"), clusters, 0, out), std::runtime_error);
+}
+
+TEST(tcard_abstraction_kmeans, bucket_tables)
+{
+    // tables must match the size of the hand indexers
+    bucket_tables_t tables{};
+    EXPECT_THROW(card_abstraction_buckets<2>{tables}, std::runtime_error);
+    EXPECT_THROW(card_abstraction_buckets<2>{"file_does_not_exist.bin"}, std::runtime_error);
+}
@@ -0,0 +1,108 @@
+#include <mkpoker/base/card.hpp>
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/util/card_generator.hpp>
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+using namespace mkp;
+
+TEST(tcard_generator, xoshiro256ss)
+{
+    xoshiro256ss rng_a(42);
+    xoshiro256ss rng_b(42);
+    xoshiro256ss rng_c(43);
+    for (int i = 0; i < 100; ++i)
+    {
+        const auto a = rng_a();
+        EXPECT_EQ(a, rng_b());
+        EXPECT_NE(a, rng_c());
+    }
+
+    // jumped stream differs
+    rng_b.jump();
+    EXPECT_NE(rng_a(), rng_b());
+
+    // bounded
+    std::array<uint32_t, 7> counts{};
+    for (int i = 0; i < 70'000; ++i)
+    {
+        const auto v = rng_a.bounded(7);
+        ASSERT_LT(v, 7);
+        ++counts[v];
+    }
+    for (auto&& c : counts)
+    {
+        EXPECT_GT(c, 9'000);
+        EXPECT_LT(c, 11'000);
+    }
+}
+
+TEST(tcard_generator, card_dealer_deal)
+{
+    card_dealer dealer{};
+    std::array<uint32_t, c_deck_size> counts{};
+    for (int i = 0; i < 52'000; ++i)
+    {
+        const auto cards = dealer.deal<9>();
+        ASSERT_EQ(cardset(cards).size(), 9);
+        for (auto&& c : cards)
+        {
+            ++counts[c.m_card];
+        }
+    }
+    // every card is dealt 9'000 times on average
+    for (auto&& c : counts)
+    {
+        EXPECT_GT(c, 8'400);
+        EXPECT_LT(c, 9'600);
+    }
+
+    const auto all = dealer.deal<c_deck_size>();
+    EXPECT_EQ(cardset(all).size(), c_deck_size);
+}
+
+TEST(tcard_generator, card_dealer_streams)
+{
+    card_dealer dealer_a(7, 0);
+    card_dealer dealer_b(7, 0);
+    card_dealer dealer_c(7, 1);
+    int num_different = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        const auto a = dealer_a.deal<7>();
+        EXPECT_EQ(a, dealer_b.deal<7>());
+        num_different += a != dealer_c.deal<7>();
+    }
+    EXPECT_GT(num_different, 90);
+}
+
+TEST(tcard_generator, card_dealer_dead_cards)
+{
+    card_dealer dealer{};
+    const cardset dead("AcAdAhAsKcKdKhKs");
+    for (int i = 0; i < 1'000; ++i)
+    {
+        const auto cards = dealer.deal<5>(dead);
+        EXPECT_EQ(cardset(cards).size(), 5);
+        EXPECT_TRUE(cardset(cards).disjoint(dead));
+
+        const auto cs = dealer.deal_cardset(7);
+        EXPECT_EQ(cs.size(), 7);
+    }
+
+    // only the remaining 4 cards can be dealt
+    const cardset almost_full{c_cardset_full & ~cardset("2c2d2h2s").as_bitset()};
+    EXPECT_EQ(cardset(dealer.deal<4>(almost_full)), cardset("2c2d2h2s"));
+    EXPECT_THROW(static_cast<void>(dealer.deal<5>(almost_full)), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(dealer.deal_cardset(53)), std::runtime_error);
+
+    // restricted deck
+    card_dealer<c_rank_five, c_suit_diamonds> small_dealer{};
+    const auto small = small_dealer.deal<8>();
+    EXPECT_EQ(cardset(small).size(), 8);
+    EXPECT_TRUE(cardset(small).contains(cardset("2c3c4c5c2d3d4d5d")));
+}
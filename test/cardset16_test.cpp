@@ -0,0 +1,78 @@
+#include <mkpoker/base/card.hpp>
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/cardset16.hpp>
+#include <mkpoker/base/hand.hpp>
+#include <mkpoker/base/normalize.hpp>
+#include <mkpoker/holdem/holdem_evaluation.hpp>
+#include <mkpoker/util/card_generator.hpp>
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+using namespace mkp;
+
+TEST(tcardset16, cardset16_layout)
+{
+    const cardset16 cs("2cAc3dKh4s");
+    EXPECT_EQ(cs.size(), 5);
+    EXPECT_EQ(cs.suit_mask(c_suit_clubs), (1 << c_rank_two) | (1 << c_rank_ace));
+    EXPECT_EQ(cs.suit_mask(c_suit_diamonds), 1 << c_rank_three);
+    EXPECT_EQ(cs.suit_mask(c_suit_hearts), 1 << c_rank_king);
+    EXPECT_EQ(cs.suit_mask(c_suit_spades), 1 << c_rank_four);
+    EXPECT_EQ(cs.suit_masks(), (std::array<uint16_t, 4>{cs.suit_mask(0), cs.suit_mask(1), cs.suit_mask(2), cs.suit_mask(3)}));
+    EXPECT_EQ(cs.as_bitset(), uint64_t(cs.suit_mask(0)) | uint64_t(cs.suit_mask(1)) << 16 | uint64_t(cs.suit_mask(2)) << 32 |
+                                  uint64_t(cs.suit_mask(3)) << 48);
+    EXPECT_EQ(cs, cardset16::from_masks(cs.suit_masks()));
+    EXPECT_EQ(cs.str(), cardset("2cAc3dKh4s").str());
+
+    EXPECT_THROW(cardset16{uint64_t(1) << 13}, std::runtime_error);
+    EXPECT_NO_THROW(cardset16{c_cardset16_full});
+
+    cardset16 full{};
+    full.fill();
+    EXPECT_EQ(full.size(), c_deck_size);
+    EXPECT_EQ(full.as_cardset(), cardset{c_cardset_full});
+    full.remove(cs);
+    EXPECT_EQ(full.size(), c_deck_size - 5);
+    EXPECT_TRUE(full.disjoint(cs));
+    full.insert(card("Ac"));
+    EXPECT_TRUE(full.contains(card("Ac")));
+    EXPECT_TRUE(full.intersects(cs));
+    EXPECT_TRUE(full.combine(cs).contains(cs));
+    full.clear();
+    EXPECT_EQ(full.size(), 0);
+
+    EXPECT_THROW(static_cast<void>(cs.rotate_suits({0, 1, 2, 2})), std::runtime_error);
+}
+
+TEST(tcardset16, cardset16_same_as_cardset)
+{
+    card_dealer dealer{};
+    for (int i = 0; i < 100'000; ++i)
+    {
+        const auto cs = dealer.deal_cardset(static_cast<uint8_t>(1 + i % 7));
+        const cardset16 cs16(cs);
+        ASSERT_EQ(cs16.as_cardset(), cs);
+        EXPECT_EQ(cs16.size(), cs.size());
+        EXPECT_EQ(cs16.get_normalization_vector(), cs.get_normalization_vector());
+        const std::array<uint8_t, 4> r{static_cast<uint8_t>(i % 4), static_cast<uint8_t>((i + 1) % 4), static_cast<uint8_t>((i + 3) % 4),
+                                       static_cast<uint8_t>((i + 2) % 4)};
+        EXPECT_EQ(cs16.rotate_suits(r).as_cardset(), cs.rotate_suits(r));
+        if (cs.size() >= 5)
+        {
+            EXPECT_EQ(evaluate_unsafe(cs16), evaluate_unsafe(cs));
+        }
+    }
+
+    for (int i = 0; i < 10'000; ++i)
+    {
+        const auto cards = dealer.deal<7>();
+        const hand_2c hand(cards[0], cards[1]);
+        const cardset board{cards[2], cards[3], cards[4], cards[5], cards[6]};
+        EXPECT_EQ(suit_normalization_permutation(hand, cardset16(board)), suit_normalization_permutation(hand, board));
+    }
+    EXPECT_THROW(static_cast<void>(suit_normalization_permutation(hand_2c("AcAd"), cardset16("AcKd7h"))), std::runtime_error);
+}
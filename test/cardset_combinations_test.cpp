@@ -0,0 +1,106 @@
+#include <mkpoker/base/card.hpp>
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/cardset_combinations.hpp>
+#include <mkpoker/util/card_generator.hpp>
+
+#include <cstdint>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace mkp;
+
+TEST(tcardset_combinations, cardset_combinations_enumeration)
+{
+    // all flops of the remaining deck: colex order, distinct subsets and rank / unrank are inverse
+    const cardset dead("AcKd7h2s");
+    const cardset deck{c_cardset_full & ~dead.as_bitset()};
+    const cardset_combinations flops(deck, 3);
+    ASSERT_EQ(flops.size(), 17'296);
+
+    std::vector<cardset> all;
+    flops.for_each([&](const cardset cs) { all.push_back(cs); });
+    ASSERT_EQ(all.size(), flops.size());
+    std::set<uint64_t> unique;
+    for (uint64_t i = 0; i < all.size(); ++i)
+    {
+        EXPECT_EQ(all[i].size(), 3);
+        EXPECT_TRUE(deck.contains(all[i]));
+        EXPECT_EQ(flops.rank(all[i]), i);
+        EXPECT_EQ(flops.unrank(i), all[i]);
+        unique.insert(all[i].as_bitset());
+        if (i > 0)
+        {
+            // colex: the highest card decides first, i.e. the bitsets are ascending
+            EXPECT_LT(all[i - 1].as_bitset(), all[i].as_bitset());
+        }
+    }
+    EXPECT_EQ(unique.size(), flops.size());
+    EXPECT_EQ(all.front(), cardset("2c3c4c"));
+    EXPECT_EQ(all.back(), cardset("QsKsAs"));
+
+    // ranges can be resumed and split
+    std::vector<cardset> split;
+    const auto collect = [&](const cardset cs) { split.push_back(cs); };
+    flops.for_each(0, 777, collect);
+    flops.for_each(777, 777, collect);
+    flops.for_each(777, flops.size(), collect);
+    EXPECT_EQ(split, all);
+
+    // resuming at every index gives the same subsets as unrank
+    const cardset small("2c5c9cJdQh3s4s8sKsAs");
+    for (uint8_t k = 1; k <= small.size(); ++k)
+    {
+        const cardset_combinations combos(small, k);
+        for (uint64_t begin = 0; begin < combos.size(); ++begin)
+        {
+            uint64_t idx = begin;
+            combos.for_each(begin, combos.size(), [&](const cardset cs) { EXPECT_EQ(cs, combos.unrank(idx++)); });
+            EXPECT_EQ(idx, combos.size());
+        }
+    }
+
+    // edge cases
+    uint64_t count = 0;
+    cardset_combinations(deck, 0).for_each([&](const cardset cs) {
+        EXPECT_EQ(cs.size(), 0);
+        ++count;
+    });
+    EXPECT_EQ(count, 1);
+    const cardset_combinations everything(deck, static_cast<uint8_t>(deck.size()));
+    EXPECT_EQ(everything.size(), 1);
+    EXPECT_EQ(everything.unrank(0), deck);
+    EXPECT_EQ(cardset_combinations(cardset{c_cardset_full}, 5).size(), 2'598'960);
+    EXPECT_EQ(cardset_combinations(cardset{c_cardset_full}, 7).unrank(133'784'559), cardset("8s9sTsJsQsKsAs"));
+
+    EXPECT_THROW(cardset_combinations(dead, 5), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(flops.unrank(flops.size())), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(flops.rank(cardset("AcKsQs"))), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(flops.rank(cardset("JsKsQsAs"))), std::runtime_error);
+    EXPECT_THROW(flops.for_each(0, flops.size() + 1, collect), std::runtime_error);
+}
+
+TEST(tcardset_combinations, cardset_combinations_sample)
+{
+    card_dealer dealer{};
+    const cardset_combinations turns(cardset{c_cardset_full}, 4);
+    std::vector<uint32_t> counts(c_deck_size, 0);
+    constexpr int c_num_samples = 100'000;
+    for (int i = 0; i < c_num_samples; ++i)
+    {
+        const auto cs = turns.sample(dealer.rng());
+        ASSERT_EQ(cs.size(), 4);
+        ASSERT_EQ(turns.unrank(turns.rank(cs)), cs);
+        for (auto&& c : cs.as_cards())
+        {
+            ++counts[c.m_card];
+        }
+    }
+    // every card is in 4/52 of the subsets
+    for (auto&& n : counts)
+    {
+        EXPECT_NEAR(n, c_num_samples * 4.0 / c_deck_size, 500);
+    }
+}
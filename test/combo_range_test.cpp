@@ -0,0 +1,149 @@
+#include <mkpoker/base/card.hpp>
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/combo.hpp>
+#include <mkpoker/base/combo_range.hpp>
+#include <mkpoker/base/hand.hpp>
+#include <mkpoker/base/range.hpp>
+#include <mkpoker/util/card_generator.hpp>
+
+#include <cstdint>
+#include <set>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+using namespace mkp;
+
+TEST(tcombo_range, combo_index)
+{
+    static_assert(combo_index(0, 1) == 0);
+    static_assert(combo_index(51, 50) == c_num_combos - 1);
+
+    std::set<uint16_t> indices;
+    for (uint8_t i = 0; i < c_deck_size; ++i)
+    {
+        for (uint8_t j = i + 1; j < c_deck_size; ++j)
+        {
+            const hand_2c h(card{i}, card{j});
+            const auto idx = combo_index(h);
+            ASSERT_LT(idx, c_num_combos);
+            EXPECT_EQ(idx, combo_index(j, i));
+            EXPECT_EQ(combo_hand(idx), h);
+            EXPECT_EQ(combo_cardset(idx), h.as_cardset());
+            indices.insert(idx);
+        }
+    }
+    EXPECT_EQ(indices.size(), c_num_combos);
+    EXPECT_THROW(static_cast<void>(combo_hand(c_num_combos)), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(combo_cardset(c_num_combos)), std::runtime_error);
+}
+
+TEST(tcombo_range, combo_mask)
+{
+    static_assert(combo_mask_of(card("As")).size() == c_deck_size - 1);
+    static_assert(blocked_combos(cardset("AsKdQh")).size() == 3 * 51 - 3);
+    static_assert((~combo_mask{}).size() == c_num_combos);
+
+    card_dealer dealer{};
+    for (int n = 0; n < 100; ++n)
+    {
+        const auto cards = dealer.deal<5>();
+        const cardset board(cards);
+        const auto blocked = blocked_combos(board);
+        for (uint16_t i = 0; i < c_num_combos; ++i)
+        {
+            EXPECT_EQ(blocked.test(i), combo_cardset(i).intersects(board));
+        }
+        EXPECT_EQ(blocked.size(), c_num_combos - 47 * 46 / 2);
+        EXPECT_EQ((~blocked).size(), 47 * 46 / 2);
+        EXPECT_EQ(blocked | ~blocked, ~combo_mask{});
+        EXPECT_TRUE((blocked & ~blocked).none());
+        EXPECT_EQ(blocked, blocked_combos(cardset({cards[0], cards[1]})) | blocked_combos(cardset({cards[2], cards[3], cards[4]})));
+
+        uint16_t num_unblocked = 0;
+        (~blocked).for_each([&](const uint16_t i) {
+            EXPECT_TRUE(combo_cardset(i).disjoint(board));
+            ++num_unblocked;
+        });
+        EXPECT_EQ(num_unblocked, 47 * 46 / 2);
+    }
+
+    combo_mask m;
+    EXPECT_TRUE(m.none());
+    m.set(1325);
+    m.set(64);
+    EXPECT_TRUE(m.test(1325) && m.test(64) && !m.test(63));
+    EXPECT_EQ(m.size(), 2);
+    m.reset(1325);
+    EXPECT_EQ(m.size(), 1);
+}
+
+TEST(tcombo_range, range_conversion)
+{
+    const range r("99+,A2s+,KTs+,QJs,ATo+,KQo");
+    const combo_range cr(r);
+    EXPECT_EQ(cr.size(), r.hands());
+    EXPECT_FLOAT_EQ(cr.sum(), static_cast<float>(r.hands()));
+    EXPECT_EQ(cr.to_range(), r);
+    EXPECT_EQ(cr.value_of(hand_2c("AhKh")), 1.0f);
+    EXPECT_EQ(cr.value_of(hand_2c("AhKd")), 1.0f);
+    EXPECT_EQ(cr.value_of(hand_2c("KhQd")), 1.0f);
+    EXPECT_EQ(cr.value_of(hand_2c("8h8d")), 0.0f);
+
+    // suit specific weights are merged into their class
+    combo_range half{};
+    half.set_value(hand_2c("AhAd"), 1.0f);
+    half.set_value(hand_2c("AcAs"), 0.5f);
+    half.set_value(hand_2c("7c2d"), 0.25f);
+    const auto r2 = half.to_range();
+    EXPECT_EQ(r2.value_of(hand_2r("AA")), 150);
+    // non-suited: lower rank first
+    EXPECT_EQ(r2.value_of(hand_2r("27")), 25);
+    EXPECT_EQ(r2.size(), 2);
+
+    EXPECT_EQ(combo_range(range{}), combo_range{});
+    range full;
+    full.fill();
+    EXPECT_EQ(combo_range(full), combo_range(1.0f));
+}
+
+TEST(tcombo_range, arithmetic)
+{
+    combo_range full(1.0f);
+    EXPECT_EQ(full.size(), c_num_combos);
+    EXPECT_FLOAT_EQ(full.sum(), 1326.0f);
+    EXPECT_FLOAT_EQ(full.dot(full), 1326.0f);
+
+    full.normalize();
+    EXPECT_NEAR(full.sum(), 1.0f, 1e-5f);
+    EXPECT_FLOAT_EQ(full[0], 1.0f / 1326);
+
+    // three board cards block 3 * 51 - 3 combos
+    combo_range r(0.5f);
+    r.remove_blocked(cardset("AhKdQs"));
+    EXPECT_EQ(r.size(), c_num_combos - 150);
+    EXPECT_EQ(r.value_of(hand_2c("AhAd")), 0.0f);
+    EXPECT_EQ(r.value_of(hand_2c("AcAd")), 0.5f);
+    EXPECT_FLOAT_EQ(r.sum(), 0.5f * (c_num_combos - 150));
+    combo_range r2(0.5f);
+    r2.remove(blocked_combos(cardset("AhKdQs")));
+    EXPECT_EQ(r2, r);
+
+    combo_range other(0.5f);
+    other *= r;
+    EXPECT_FLOAT_EQ(other.sum(), 0.25f * (c_num_combos - 150));
+    EXPECT_FLOAT_EQ(other.dot(r), 0.125f * (c_num_combos - 150));
+    other += r;
+    EXPECT_FLOAT_EQ(other.value_of(hand_2c("AcAd")), 0.75f);
+    other *= 2.0f;
+    EXPECT_FLOAT_EQ(other.value_of(hand_2c("AcAd")), 1.5f);
+
+    combo_range empty{};
+    empty.normalize();
+    EXPECT_EQ(empty.sum(), 0.0f);
+    EXPECT_EQ(empty.size(), 0);
+
+    EXPECT_THROW(empty.set_value(c_num_combos, 1.0f), std::runtime_error);
+    EXPECT_THROW(empty.set_value(0, 1.5f), std::runtime_error);
+    EXPECT_THROW(empty.set_value(0, -0.5f), std::runtime_error);
+}
@@ -0,0 +1,118 @@
+#include <mkpoker/base/combo_range.hpp>
+#include <mkpoker/holdem/holdem_evaluation.hpp>
+#include <mkpoker/util/card_generator.hpp>
+#include <mkpoker/util/cpu_dispatch.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace mkp;
+
+namespace
+{
+    int kernel_generic() { return 0; }
+    int kernel_v2() { return 2; }
+    int kernel_v4() { return 4; }
+
+    // all levels supported by this cpu which have a kernel
+    template <typename F>
+    std::vector<F*> available_kernels(const dispatch_table_t<F>& kernels)
+    {
+        std::vector<F*> ret;
+        for (std::size_t i = 0; i <= static_cast<std::size_t>(cpu_level()); ++i)
+        {
+            if (kernels[i] != nullptr)
+            {
+                ret.push_back(kernels[i]);
+            }
+        }
+        return ret;
+    }
+}    // namespace
+
+TEST(tcpu_dispatch, select)
+{
+    const dispatch_table_t<int()> kernels{&kernel_generic, &kernel_v2, nullptr, &kernel_v4};
+    EXPECT_EQ(cpu_dispatch(kernels, cpu_level_t::GENERIC)(), 0);
+    EXPECT_EQ(cpu_dispatch(kernels, cpu_level_t::V2)(), 2);
+    // falls back to the next lower level
+    EXPECT_EQ(cpu_dispatch(kernels, cpu_level_t::V3)(), 2);
+    EXPECT_EQ(cpu_dispatch(kernels, cpu_level_t::V4)(), 4);
+
+    EXPECT_EQ(cpu_level(), cpu_level());
+    EXPECT_EQ(to_string(cpu_level_t::V3), "x86-64-v3");
+#if !MKP_CPU_DISPATCH
+    EXPECT_EQ(cpu_level(), cpu_level_t::GENERIC);
+#endif
+}
+
+TEST(tcpu_dispatch, evaluate_batch)
+{
+    card_dealer dealer{};
+    std::vector<cardset> hands;
+    std::vector<uint32_t> expected;
+    for (uint8_t n = 5; n <= 7; ++n)
+    {
+        for (int i = 0; i < 10'000; ++i)
+        {
+            hands.push_back(dealer.deal_cardset(n));
+            expected.push_back(evaluate_unsafe(hands.back()).as_bitset());
+        }
+    }
+
+    std::vector<uint32_t> results(hands.size());
+    evaluate_batch(hands, results);
+    EXPECT_EQ(results, expected);
+    for (auto&& kernel : available_kernels(detail::evaluate_batch_kernels))
+    {
+        std::fill(results.begin(), results.end(), 0);
+        kernel(hands.data(), results.data(), hands.size());
+        EXPECT_EQ(results, expected);
+    }
+
+    std::vector<uint32_t> too_small(hands.size() - 1);
+    EXPECT_THROW(evaluate_batch(hands, too_small), std::runtime_error);
+}
+
+TEST(tcpu_dispatch, combo_weights)
+{
+    card_dealer dealer{};
+    alignas(64) std::array<float, detail::c_combo_weights_size> a{};
+    alignas(64) std::array<float, detail::c_combo_weights_size> b{};
+    for (std::size_t i = 0; i < c_num_combos; ++i)
+    {
+        a[i] = static_cast<float>(dealer.rng().bounded(1000)) / 1000;
+        b[i] = static_cast<float>(dealer.rng().bounded(1000)) / 1000;
+    }
+
+    const auto sum = detail::combo_weights_sum_generic(a.data());
+    const auto dot = detail::combo_weights_dot_generic(a.data(), b.data());
+    auto scaled = a;
+    detail::combo_weights_scale_generic(scaled.data(), 0.5f);
+    auto product = a;
+    detail::combo_weights_mul_generic(product.data(), b.data());
+    auto added = a;
+    detail::combo_weights_add_generic(added.data(), b.data());
+
+    for (std::size_t level = 0; level <= static_cast<std::size_t>(cpu_level()); ++level)
+    {
+        const auto l = static_cast<cpu_level_t>(level);
+        EXPECT_FLOAT_EQ(cpu_dispatch(detail::combo_weights_sum_kernels, l)(a.data()), sum);
+        EXPECT_FLOAT_EQ(cpu_dispatch(detail::combo_weights_dot_kernels, l)(a.data(), b.data()), dot);
+
+        auto x = a;
+        cpu_dispatch(detail::combo_weights_scale_kernels, l)(x.data(), 0.5f);
+        EXPECT_EQ(x, scaled);
+        x = a;
+        cpu_dispatch(detail::combo_weights_mul_kernels, l)(x.data(), b.data());
+        EXPECT_EQ(x, product);
+        x = a;
+        cpu_dispatch(detail::combo_weights_add_kernels, l)(x.data(), b.data());
+        EXPECT_EQ(x, added);
+    }
+}
@@ -18,7 +18,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include <mkpoker/game/game.hpp>
+#include <mkpoker/holdem/holdem_evaluation.hpp>
+#include <mkpoker/util/card_generator.hpp>
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
 #include <functional>
@@ -666,3 +669,133 @@ TEST(tgame, game_gamestate_hand_ended_branch2)
     game2.execute_action(player_action_t{0, gb_action_t::FOLD, game2.active_player_v()});
     EXPECT_EQ(game2.gamestate_v(), gb_gamestate_t::GAME_FIN);
 }
+
+TEST(tgame, game_gamestate_pot_layers)
+{
+    // compare the side pot resolution with a straightforward implementation based on all_pots()
+    // for random games with random stack sizes and actions
+    using game_type = gamestate<6, 1, 20>;
+    card_dealer dealer{};
+    xoshiro256ss rng{};
+    int num_multiple_pots = 0;
+    for (int i = 0; i < 5'000; ++i)
+    {
+        const auto chips = make_array<int32_t, 6>([&](const auto) { return static_cast<int32_t>(1'000 + rng.bounded(20) * 500); });
+        game_type game(chips);
+        while (!game.in_terminal_state())
+        {
+            const auto actions = game.possible_actions();
+            game.execute_action(actions[rng.bounded(static_cast<uint32_t>(actions.size()))]);
+        }
+        if (!game.is_showdown())
+        {
+            continue;
+        }
+
+        const gamecards<6> gc(dealer.deal<17>());
+        const auto pots = game.all_pots();
+        const auto layers = game.pot_layers();
+        ASSERT_EQ(layers.pots().size(), pots.size());
+        num_multiple_pots += pots.size() > 1;
+
+        std::array<int32_t, 6> expected_payouts{};
+        std::array<int32_t, 6> expected_distribution{};
+        for (std::size_t p = 0; p < pots.size(); ++p)
+        {
+            const auto& [eligible, upper, lower] = pots[p];
+            uint8_t mask = 0;
+            for (auto&& pos : eligible)
+            {
+                mask |= static_cast<uint8_t>(1 << pos);
+            }
+            EXPECT_EQ(layers.pots()[p].m_eligible, mask);
+            EXPECT_EQ(layers.pots()[p].m_upper, upper);
+            EXPECT_EQ(layers.pots()[p].m_lower, lower);
+
+            std::vector<unsigned> winners;
+            for (auto&& pos : eligible)
+            {
+                const auto best = evaluate_unsafe(gc.board_n_as_cs(5).combine(gc.m_hands[pos].as_cardset()));
+                if (winners.empty() || best > evaluate_unsafe(gc.board_n_as_cs(5).combine(gc.m_hands[winners[0]].as_cardset())))
+                {
+                    winners = {pos};
+                }
+                else if (best == evaluate_unsafe(gc.board_n_as_cs(5).combine(gc.m_hands[winners[0]].as_cardset())))
+                {
+                    winners.push_back(pos);
+                }
+            }
+
+            std::array<int32_t, 6> invested{};
+            int32_t total = 0;
+            for (unsigned pos = 0; pos < 6; ++pos)
+            {
+                invested[pos] = std::clamp(game.chips_front()[pos] - lower, 0, upper - lower);
+                total += invested[pos];
+            }
+            const int32_t amount_each_winner = static_cast<int32_t>(total * (1.0f - 1.0f / 20)) / static_cast<int32_t>(winners.size());
+            for (unsigned pos = 0; pos < 6; ++pos)
+            {
+                const bool is_winner = std::find(winners.cbegin(), winners.cend(), pos) != winners.cend();
+                expected_payouts[pos] += (is_winner ? amount_each_winner : 0) - invested[pos];
+                expected_distribution[pos] += is_winner ? amount_each_winner : 0;
+            }
+        }
+        EXPECT_EQ(game.payouts_showdown(gc), expected_payouts);
+        EXPECT_EQ(game.pot_distribution(gc), expected_distribution);
+    }
+    EXPECT_GT(num_multiple_pots, 100);
+
+    auto g = gamestate<3, 0, 1>(3000);
+    EXPECT_THROW(static_cast<void>(g.pot_layers()), std::runtime_error);
+}
+
+namespace
+{
+    // expose the player counters
+    template <std::size_t N>
+    struct gamestate_counters : public gamestate<N, 0, 1>
+    {
+        using gamestate<N, 0, 1>::gamestate;
+        using gamestate<N, 0, 1>::num_alive;
+        using gamestate<N, 0, 1>::num_actionable;
+        using gamestate<N, 0, 1>::num_future_actionable;
+    };
+}    // namespace
+
+TEST(tgame, game_gamestate_player_counters)
+{
+    // the incrementally maintained counters must match the player states for random games
+    xoshiro256ss rng{};
+    for (int i = 0; i < 5'000; ++i)
+    {
+        const auto chips = make_array<int32_t, 6>([&](const auto) { return static_cast<int32_t>(1'000 + rng.bounded(40) * 500); });
+        gamestate_counters<6> game(chips);
+        for (;;)
+        {
+            const auto states = game.all_players_state();
+            const auto front = game.chips_front();
+            const int32_t highest_bet = *std::max_element(front.cbegin(), front.cend());
+            int alive = 0;
+            int actionable = 0;
+            int future = 0;
+            for (unsigned pos = 0; pos < 6; ++pos)
+            {
+                alive += states[pos] != gb_playerstate_t::OUT;
+                actionable += states[pos] == gb_playerstate_t::INIT || (states[pos] == gb_playerstate_t::ALIVE && front[pos] < highest_bet);
+                future += states[pos] != gb_playerstate_t::OUT && states[pos] != gb_playerstate_t::ALLIN;
+            }
+            ASSERT_EQ(game.current_highest_bet(), highest_bet);
+            ASSERT_EQ(game.num_alive(), alive);
+            ASSERT_EQ(game.num_future_actionable(), future);
+            ASSERT_EQ(game.num_actionable(), actionable);
+            if (game.in_terminal_state())
+            {
+                break;
+            }
+
+            const auto actions = game.possible_actions();
+            game.execute_action(actions[rng.bounded(static_cast<uint32_t>(actions.size()))]);
+        }
+    }
+}
@@ -0,0 +1,104 @@
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/hand.hpp>
+#include <mkpoker/base/hand_indexer.hpp>
+#include <mkpoker/util/card_generator.hpp>
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace mkp;
+
+TEST(thand_indexer, hand_indexer_sizes)
+{
+    static_assert(hand_indexer_preflop::size(0) == 169);
+    static_assert(hand_indexer_flop::size(0) == 169);
+    static_assert(hand_indexer_flop::size(1) == 1'286'792);
+    static_assert(hand_indexer_turn::size(1) == 13'960'050);
+    static_assert(hand_indexer_river::size(1) == 123'156'254);
+
+    // perfect recall
+    EXPECT_EQ((hand_indexer<2, 3, 1>::size(2)), 55'190'538);
+    EXPECT_EQ((hand_indexer<2, 3, 1, 1>::size(3)), 2'428'287'420);
+
+    EXPECT_THROW(static_cast<void>(hand_indexer_flop::size(2)), std::runtime_error);
+}
+
+TEST(thand_indexer, hand_indexer_preflop)
+{
+    // every index is hit and the index of the canonical hand is the index itself
+    std::vector<int> hits(hand_indexer_preflop::size(0));
+    for (uint8_t i = 0; i < c_deck_size; ++i)
+    {
+        for (uint8_t j = i + 1; j < c_deck_size; ++j)
+        {
+            const auto idx = hand_indexer_preflop::index(hand_2c(i, j));
+            ASSERT_LT(idx, hits.size());
+            ++hits[idx];
+        }
+    }
+    for (uint64_t idx = 0; idx < hits.size(); ++idx)
+    {
+        // pairs: 6 combos, suited: 4 combos, offsuit: 12 combos
+        EXPECT_TRUE(hits[idx] == 4 || hits[idx] == 6 || hits[idx] == 12);
+        const auto cs = hand_indexer_preflop::unindex(0, idx);
+        EXPECT_EQ(cs[0].size(), 2);
+        EXPECT_EQ(hand_indexer_preflop::index({cs[0]}), idx);
+    }
+}
+
+TEST(thand_indexer, hand_indexer_flop_roundtrip)
+{
+    for (uint64_t idx = 0; idx < hand_indexer_flop::size(1); ++idx)
+    {
+        const auto cs = hand_indexer_flop::unindex(1, idx);
+        ASSERT_EQ(cs[0].size(), 2);
+        ASSERT_EQ(cs[1].size(), 3);
+        ASSERT_TRUE(cs[0].disjoint(cs[1]));
+        ASSERT_EQ(hand_indexer_flop::index(cs), idx);
+    }
+}
+
+TEST(thand_indexer, hand_indexer_suit_isomorphism)
+{
+    constexpr std::array<std::array<uint8_t, 4>, 4> permutations{{{0, 1, 2, 3}, {3, 2, 1, 0}, {1, 0, 3, 2}, {2, 3, 0, 1}}};
+
+    card_generator cgen{};
+    for (int i = 0; i < 10'000; ++i)
+    {
+        const auto v = cgen.generate_v(7);
+        const cardset hand{v[0], v[1]};
+        const cardset turn{v[2], v[3], v[4], v[5]};
+        const cardset river{v[2], v[3], v[4], v[5], v[6]};
+
+        const auto idx_turn = hand_indexer_turn::index({hand, turn});
+        const auto idx_river = hand_indexer_river::index({hand, river});
+        const auto idx_pr = hand_indexer<2, 3, 1, 1>::index_all(
+            {hand, cardset{v[2], v[3], v[4]}, cardset{v[5]}, cardset{v[6]}});
+
+        for (auto&& p : permutations)
+        {
+            EXPECT_EQ(hand_indexer_turn::index({hand.rotate_suits(p), turn.rotate_suits(p)}), idx_turn);
+            EXPECT_EQ(hand_indexer_river::index({hand.rotate_suits(p), river.rotate_suits(p)}), idx_river);
+        }
+
+        // the canonical hand must map to the same index
+        const auto cs_turn = hand_indexer_turn::unindex(1, idx_turn);
+        EXPECT_EQ(hand_indexer_turn::index(cs_turn), idx_turn);
+        const auto cs_river = hand_indexer_river::unindex(1, idx_river);
+        EXPECT_EQ(hand_indexer_river::index(cs_river), idx_river);
+        const auto cs_pr = hand_indexer<2, 3, 1, 1>::unindex(3, idx_pr[3]);
+        EXPECT_EQ((hand_indexer<2, 3, 1, 1>::index_all(cs_pr)), idx_pr);
+    }
+}
+
+TEST(thand_indexer, hand_indexer_invalid_input)
+{
+    EXPECT_THROW(static_cast<void>(hand_indexer_flop::index(hand_2c("AcKd"), cardset("2c3c"))), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(hand_indexer_flop::index(hand_2c("AcKd"), cardset("Ac3c4c"))), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(hand_indexer_flop::unindex(1, hand_indexer_flop::size(1))), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(hand_indexer_flop::unindex(2, 0)), std::runtime_error);
+}
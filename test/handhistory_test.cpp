@@ -0,0 +1,155 @@
+#include <mkpoker/game/game.hpp>
+#include <mkpoker/game/handhistory.hpp>
+#include <mkpoker/game/hh_writer.hpp>
+#include <mkpoker/util/card_generator.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <gtest/gtest.h>
+
+#include "hh_test_util.hpp"
+
+using namespace mkp;
+
+namespace
+{
+    // play a random hand and write its history to out (file or buffer)
+    template <typename TOut>
+    void play_random_hand(card_dealer<>& dealer, TOut&& out, const uint64_t hand_id)
+    {
+        static_cast<void>(hh_test::write_random_hand<6>(dealer, out, hand_id, {.m_min_stack = 70, .m_stack_range = 60, .m_player_id = 2}));
+    }
+
+    std::string read_file(const std::string& filename)
+    {
+        std::ifstream f(filename, std::ios::binary);
+        std::stringstream ss;
+        ss << f.rdbuf();
+        return ss.str();
+    }
+
+    // split into single hands
+    std::vector<std::string> split_hands(const std::string& str)
+    {
+        constexpr std::string_view c_start{"PokerStars Zoom Hand #"};
+        std::vector<std::string> ret;
+        for (auto pos = str.find(c_start); pos != std::string::npos;)
+        {
+            const auto next = str.find(c_start, pos + 1);
+            ret.push_back(str.substr(pos, next == std::string::npos ? std::string::npos : next - pos));
+            pos = next;
+        }
+        return ret;
+    }
+}    // namespace
+
+TEST(thandhistory, buffer_equals_file)
+{
+    const std::string filename{"hh_file_test.txt"};
+    {
+        std::FILE* f = std::fopen(filename.c_str(), "w");
+        card_dealer dealer{};
+        for (uint64_t i = 0; i < 200; ++i)
+        {
+            play_random_hand(dealer, f, i);
+        }
+        std::fclose(f);
+    }
+
+    fmt::memory_buffer buf;
+    card_dealer dealer{};
+    for (uint64_t i = 0; i < 200; ++i)
+    {
+        play_random_hand(dealer, buf, i);
+    }
+
+    const auto from_file = read_file(filename);
+    EXPECT_EQ(std::string(buf.data(), buf.size()), from_file);
+    EXPECT_EQ(split_hands(from_file).size(), 200);
+    std::filesystem::remove(filename);
+}
+
+TEST(thandhistory, sink_multiple_threads)
+{
+    constexpr unsigned c_num_threads = 4;
+    constexpr uint64_t c_hands_per_thread = 500;
+    const std::string filename{"hh_sink_test.txt"};
+
+    // expected hands from every thread
+    std::vector<std::string> expected;
+    for (unsigned t = 0; t < c_num_threads; ++t)
+    {
+        fmt::memory_buffer buf;
+        card_dealer dealer(1927, t);
+        for (uint64_t i = 0; i < c_hands_per_thread; ++i)
+        {
+            play_random_hand(dealer, buf, t * c_hands_per_thread + i);
+        }
+        const auto hands = split_hands(std::string(buf.data(), buf.size()));
+        expected.insert(expected.end(), hands.begin(), hands.end());
+    }
+
+    std::FILE* f = std::fopen(filename.c_str(), "w");
+    {
+        // few blocks in flight, so that the threads have to wait for the writer
+        hh_sink sink(f, 2);
+        std::vector<std::thread> threads;
+        for (unsigned t = 0; t < c_num_threads; ++t)
+        {
+            threads.emplace_back([&sink, t]() {
+                // small blocks to get a lot of interleaving
+                hh_buffer out(sink, 4096);
+                card_dealer dealer(1927, t);
+                for (uint64_t i = 0; i < c_hands_per_thread; ++i)
+                {
+                    play_random_hand(dealer, out.buffer(), t * c_hands_per_thread + i);
+                    out.commit();
+                }
+            });
+        }
+        for (auto&& t : threads)
+        {
+            t.join();
+        }
+        EXPECT_TRUE(sink.good());
+        EXPECT_NO_THROW(sink.close());
+    }
+    std::fclose(f);
+
+    // all hands are complete, the order between threads is arbitrary
+    auto written = split_hands(read_file(filename));
+    ASSERT_EQ(written.size(), expected.size());
+    std::sort(written.begin(), written.end());
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(written, expected);
+    std::filesystem::remove(filename);
+
+    EXPECT_THROW(hh_sink{nullptr}, std::runtime_error);
+
+    // write errors are reported by close
+    std::fclose(std::fopen(filename.c_str(), "w"));
+    f = std::fopen(filename.c_str(), "r");
+    EXPECT_THROW((hh_sink{f, 0}), std::runtime_error);
+    {
+        hh_sink sink(f);
+        {
+            hh_buffer out(sink);
+            card_dealer dealer{};
+            play_random_hand(dealer, out.buffer(), 0);
+        }
+        EXPECT_THROW(sink.close(), std::runtime_error);
+        EXPECT_FALSE(sink.good());
+    }
+    std::fclose(f);
+    std::filesystem::remove(filename);
+}
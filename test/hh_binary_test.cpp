@@ -0,0 +1,279 @@
+#include <mkpoker/base/card.hpp>
+#include <mkpoker/game/game.hpp>
+#include <mkpoker/game/handhistory.hpp>
+#include <mkpoker/game/hh_binary.hpp>
+#include <mkpoker/game/hh_parser.hpp>
+#include <mkpoker/util/compression.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "hh_test_util.hpp"
+
+using namespace mkp;
+
+namespace
+{
+    std::vector<uint8_t> lz_roundtrip(const std::vector<uint8_t>& data)
+    {
+        std::vector<uint8_t> compressed{1, 2, 3};
+        const auto size = lz_compress(data, compressed);
+        EXPECT_EQ(size, compressed.size() - 3);
+        std::vector<uint8_t> ret(data.size());
+        lz_decompress(std::span<const uint8_t>(compressed).subspan(3), ret);
+        return ret;
+    }
+}    // namespace
+
+TEST(thh_binary, varint)
+{
+    std::vector<uint8_t> buf;
+    const std::vector<uint64_t> values{0, 1, 127, 128, 300, 16383, 16384, uint64_t(1) << 35, ~uint64_t(0)};
+    for (auto&& v : values)
+    {
+        varint_encode(buf, v);
+    }
+    EXPECT_EQ(buf[0], 0);
+    EXPECT_EQ(buf[3], 0x80);
+    std::size_t pos = 0;
+    for (auto&& v : values)
+    {
+        EXPECT_EQ(varint_decode(buf, pos), v);
+    }
+    EXPECT_EQ(pos, buf.size());
+    EXPECT_THROW(static_cast<void>(varint_decode(buf, pos)), std::runtime_error);
+
+    for (const int64_t v : {int64_t(0), int64_t(-1), int64_t(1), int64_t(-1000), int64_t(1) << 40})
+    {
+        EXPECT_EQ(zigzag_decode(zigzag_encode(v)), v);
+    }
+    EXPECT_EQ(zigzag_encode(-1), 1);
+    EXPECT_EQ(zigzag_encode(1), 2);
+
+    std::vector<uint8_t> bits;
+    bit_writer writer(bits);
+    for (uint32_t i = 0; i < 52; ++i)
+    {
+        writer.write(i, 6);
+    }
+    writer.flush();
+    EXPECT_EQ(bits.size(), 39);
+    bit_reader reader(bits, 0);
+    for (uint32_t i = 0; i < 52; ++i)
+    {
+        EXPECT_EQ(reader.read(6), i);
+    }
+}
+
+TEST(thh_binary, lz_compression)
+{
+    xoshiro256ss rng{};
+
+    // empty, tiny, random, repetitive and long runs
+    EXPECT_TRUE(lz_roundtrip({}).empty());
+    EXPECT_EQ(lz_roundtrip({1, 2, 3}), (std::vector<uint8_t>{1, 2, 3}));
+
+    std::vector<uint8_t> random(100'000);
+    for (auto&& e : random)
+    {
+        e = static_cast<uint8_t>(rng());
+    }
+    EXPECT_EQ(lz_roundtrip(random), random);
+
+    // random sequence of 16 random words
+    std::array<uint64_t, 16> words{};
+    for (auto&& w : words)
+    {
+        w = rng();
+    }
+    std::vector<uint8_t> repetitive;
+    for (int i = 0; i < 5'000; ++i)
+    {
+        const auto w = words[rng.bounded(16)];
+        for (unsigned j = 0; j < 8; ++j)
+        {
+            repetitive.push_back(static_cast<uint8_t>(w >> (8 * j)));
+        }
+    }
+    EXPECT_EQ(lz_roundtrip(repetitive), repetitive);
+    std::vector<uint8_t> compressed;
+    EXPECT_LT(lz_compress(repetitive, compressed), repetitive.size() / 2);
+
+    const std::vector<uint8_t> zeros(300'000, 0);
+    EXPECT_EQ(lz_roundtrip(zeros), zeros);
+    compressed.clear();
+    EXPECT_LT(lz_compress(zeros, compressed), 2000);
+
+    // corrupt input
+    std::vector<uint8_t> out(zeros.size());
+    EXPECT_THROW(lz_decompress(std::span<const uint8_t>(compressed).first(compressed.size() / 2), out), std::runtime_error);
+    std::vector<uint8_t> too_small(zeros.size() - 1);
+    EXPECT_THROW(lz_decompress(compressed, too_small), std::runtime_error);
+    compressed[2] = 0;
+    compressed[3] = 0;
+    EXPECT_THROW(lz_decompress(compressed, out), std::runtime_error);
+}
+
+TEST(thh_binary, roundtrip)
+{
+    const std::string ps_filename{"hh_binary_test.txt"};
+    const std::string filename{"hh_binary_test.bin"};
+    constexpr uint64_t c_num_hands = 500;
+    // hh_ps output with 2, 3 and 6 players
+    hh_test::write_ps_file<2, 3, 6>(ps_filename, c_num_hands, 1000, 7);
+
+    const hh_file_ps file(ps_filename, 2);
+    ASSERT_EQ(file.hands().size(), c_num_hands);
+    {
+        hh_binary_writer writer(filename, 64);
+        EXPECT_EQ(hh_convert(file, writer), c_num_hands);
+        EXPECT_EQ(writer.num_hands(), c_num_hands);
+    }
+
+    const hh_binary_reader reader(filename);
+    EXPECT_EQ(reader.num_hands(), c_num_hands);
+    EXPECT_EQ(reader.num_blocks(), 8);
+    EXPECT_EQ(reader.header().m_hands_per_block, 64);
+    EXPECT_LT(reader.size() * 5, file.size());
+
+    // all columns
+    uint64_t num_river_actions = 0;
+    uint64_t idx = 0;
+    for (std::size_t b = 0; b < reader.num_blocks(); ++b)
+    {
+        const auto block = reader.read_block(b);
+        EXPECT_EQ(block.columns(), c_hh_all_columns);
+        for (auto&& hand : block.hands())
+        {
+            const auto& expected = file.hands()[idx++];
+            EXPECT_EQ(hand.m_hand_id, expected.m_hand_id);
+            EXPECT_EQ(hand.m_num_players, expected.m_num_players);
+            EXPECT_EQ(hand.m_big_blind, expected.m_big_blind);
+            EXPECT_EQ(hand.m_names, expected.m_names);
+            EXPECT_EQ(hand.m_stacks, expected.m_stacks);
+            EXPECT_EQ(hand.m_collected, expected.m_collected);
+            EXPECT_EQ(hand.m_rake, expected.m_rake);
+            EXPECT_EQ(hand.m_known_hands, expected.m_known_hands);
+            EXPECT_EQ(hand.known_cards(), expected.known_cards());
+            EXPECT_EQ(hand.m_num_board_cards, expected.m_num_board_cards);
+            EXPECT_EQ(hand.m_board, expected.m_board);
+            const auto actions = block.actions(hand);
+            const auto expected_actions = file.actions(expected);
+            ASSERT_EQ(actions.size(), expected_actions.size());
+            EXPECT_TRUE(std::equal(actions.begin(), actions.end(), expected_actions.begin()));
+
+            // replay: streets match the game
+            const auto streets = block.streets(hand);
+            std::size_t i = 0;
+            const auto check_streets = [&](const auto& game, const player_action_t&) { EXPECT_EQ(game.gamestate_v(), streets[i++]); };
+            switch (hand.m_num_players)
+            {
+                case 2:
+                    static_cast<void>(hh_replay<2, 1, 20>(hand, actions, check_streets));
+                    break;
+                case 3:
+                    static_cast<void>(hh_replay<3, 1, 20>(hand, actions, check_streets));
+                    break;
+                default:
+                    static_cast<void>(hh_replay<6, 1, 20>(hand, actions, check_streets));
+                    break;
+            }
+            EXPECT_EQ(i, actions.size());
+            num_river_actions += static_cast<uint64_t>(std::count(streets.begin(), streets.end(), gb_gamestate_t::RIVER_BET));
+        }
+    }
+    EXPECT_EQ(idx, c_num_hands);
+    EXPECT_GT(num_river_actions, 0);
+
+    // only the action column: no amounts, names, cards, ...
+    uint64_t num_river_actions_2 = 0;
+    for (std::size_t b = 0; b < reader.num_blocks(); ++b)
+    {
+        const auto block = reader.read_block(b, hh_column_bit(hh_column_t::ACTIONS));
+        EXPECT_EQ(block.columns(), hh_column_bit(hh_column_t::HANDS) | hh_column_bit(hh_column_t::ACTIONS));
+        for (auto&& a : block.all_actions())
+        {
+            EXPECT_EQ(a.m_amount, 0);
+        }
+        for (auto&& hand : block.hands())
+        {
+            EXPECT_TRUE(hand.m_names[0].empty());
+            EXPECT_EQ(hand.m_stacks[0], 0);
+            EXPECT_EQ(hand.m_num_board_cards, 0);
+        }
+        const auto& streets = block.all_streets();
+        num_river_actions_2 += static_cast<uint64_t>(std::count(streets.begin(), streets.end(), gb_gamestate_t::RIVER_BET));
+    }
+    EXPECT_EQ(num_river_actions_2, num_river_actions);
+
+    // amounts imply actions, moved blocks keep their names
+    auto block = reader.read_block(1, hh_column_bit(hh_column_t::AMOUNTS) | hh_column_bit(hh_column_t::NAMES));
+    EXPECT_EQ(block.all_actions().size(), block.all_streets().size());
+    const auto moved = std::move(block);
+    EXPECT_EQ(moved.hands()[0].m_names, file.hands()[64].m_names);
+    EXPECT_EQ(moved.hands()[0].m_num_actions, file.hands()[64].m_num_actions);
+    EXPECT_THROW(static_cast<void>(reader.read_block(8)), std::runtime_error);
+
+    // converter, invalid files
+    EXPECT_EQ(hh_convert_ps(ps_filename, filename, 1), c_num_hands);
+    EXPECT_EQ(hh_binary_reader(filename).num_blocks(), 1);
+    std::filesystem::resize_file(filename, std::filesystem::file_size(filename) - 1);
+    EXPECT_THROW(hh_binary_reader{filename}, std::runtime_error);
+    EXPECT_THROW(hh_binary_reader{ps_filename}, std::runtime_error);
+    EXPECT_THROW(hh_binary_writer(filename, 0), std::runtime_error);
+
+    std::filesystem::remove(filename);
+    std::filesystem::remove(ps_filename);
+}
+
+TEST(thh_binary, invalid_hands)
+{
+    const std::string filename{"hh_binary_invalid_test.bin"};
+    hh_binary_writer writer(filename);
+
+    hh_hand_t hand{};
+    hand.m_num_players = 2;
+    hand.m_stacks = {10'000, 10'000};
+    const std::vector<player_action_t> actions{{0, gb_action_t::FOLD, gb_pos_t::SB}};
+    EXPECT_THROW(writer.add(hand, actions), std::runtime_error);
+    const std::vector<player_action_t> wrong_player{{0, gb_action_t::FOLD, gb_pos_t::BB}, {0, gb_action_t::FOLD, gb_pos_t::BB}};
+    EXPECT_THROW(writer.add(hand, wrong_player), std::runtime_error);
+    hand.m_num_players = 7;
+    EXPECT_THROW(writer.add(hand, actions), std::runtime_error);
+    EXPECT_EQ(writer.num_hands(), 0);
+
+    writer.close();
+    EXPECT_THROW(writer.add(hand, actions), std::runtime_error);
+    EXPECT_EQ(hh_binary_reader(filename).num_hands(), 0);
+    std::filesystem::remove(filename);
+}
+
+TEST(thh_binary, write_errors)
+{
+    // every write to /dev/full fails (as soon as the stdio buffer is flushed)
+    if (!std::filesystem::exists("/dev/full"))
+    {
+        GTEST_SKIP() << "no /dev/full";
+    }
+    const std::string ps_filename{"hh_binary_write_errors_test.txt"};
+    hh_test::write_ps_file<2, 6>(ps_filename, 2000, 1);
+    const hh_file_ps file(ps_filename, 1);
+
+    // a write error is no invalid hand, hh_convert has to pass it on
+    hh_binary_writer writer("/dev/full", 16);
+    EXPECT_THROW(static_cast<void>(hh_convert(file, writer)), std::runtime_error);
+    const auto num_hands = writer.num_hands();
+    EXPECT_GT(num_hands, 0);
+    EXPECT_LT(num_hands, file.hands().size());
+    // the hand which completed the block was added, the block is kept for the next try
+    EXPECT_EQ(num_hands % 16, 0);
+    EXPECT_THROW(writer.close(), std::runtime_error);
+    std::filesystem::remove(ps_filename);
+}
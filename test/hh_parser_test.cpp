@@ -0,0 +1,293 @@
+#include <mkpoker/base/card.hpp>
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/hand.hpp>
+#include <mkpoker/game/game.hpp>
+#include <mkpoker/game/handhistory.hpp>
+#include <mkpoker/game/hh_parser.hpp>
+#include <mkpoker/util/card_generator.hpp>
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <gtest/gtest.h>
+
+#include "hh_test_util.hpp"
+
+using namespace mkp;
+
+namespace
+{
+    using hh_test::random_hand_t;
+
+    // names with spaces and colons, the parser has to find the end of the name
+    const hh_test::random_hand_config_t c_config{.m_names = {"Alf", "Alf Bert", "Charles:", "Dave", "Ethan", "Fred"}, .m_player_id = 1};
+
+    template <std::size_t N>
+    void check_parsed_hand(const hh_file_ps& file, const hh_hand_t& hand, const random_hand_t<N>& expected)
+    {
+        ASSERT_EQ(hand.m_num_players, N);
+        EXPECT_EQ(hand.m_big_blind, 2);
+        const auto actions = file.actions(hand);
+        EXPECT_EQ(std::vector<player_action_t>(actions.begin(), actions.end()), expected.m_actions);
+
+        // amounts are printed with two decimals: 1 cent = 500 mBB
+        EXPECT_NEAR(hand.m_rake, expected.m_rake, 250);
+        for (uint8_t pos = 0; pos < N; ++pos)
+        {
+            EXPECT_EQ(hand.m_stacks[pos], expected.m_stacks[pos]);
+            EXPECT_NEAR(hand.m_collected[pos], expected.m_collected[pos], 250);
+            EXPECT_EQ(hand.hand_known(pos), pos == 1 || expected.m_shown[pos]);
+            if (hand.hand_known(pos))
+            {
+                // hand_2c orders its cards
+                EXPECT_EQ(hand.hand(pos), hand_2c(card(expected.m_cards[c_num_board_cards + 2 * pos]),
+                                                  card(expected.m_cards[c_num_board_cards + 2 * pos + 1])));
+            }
+        }
+        ASSERT_EQ(hand.m_num_board_cards, c_num_board_cards);
+        for (uint8_t i = 0; i < c_num_board_cards; ++i)
+        {
+            EXPECT_EQ(hand.m_board[i], expected.m_cards[i]);
+        }
+
+        // replay
+        card_dealer dealer(7, static_cast<uint32_t>(hand.m_hand_id));
+        const auto cards = hh_gamecards<N>(hand, dealer);
+        unsigned num_actions = 0;
+        const auto game = hh_replay<N, 1, 20>(hand, actions, [&](const auto& g, const player_action_t& a) {
+            EXPECT_EQ(g.active_player_v(), a.m_pos);
+            ++num_actions;
+        });
+        EXPECT_EQ(num_actions, actions.size());
+        EXPECT_TRUE(game.in_terminal_state());
+        EXPECT_NEAR(game.rake_size(), hand.m_rake, 250);
+        if (game.is_showdown() && hand.hand_known(0) == expected.m_shown[0])
+        {
+            // all showdown hands are known
+            const auto pot_dist = game.pot_distribution(cards);
+            for (uint8_t pos = 0; pos < N; ++pos)
+            {
+                EXPECT_NEAR(pot_dist[pos], hand.m_collected[pos], 250);
+            }
+        }
+    }
+}    // namespace
+
+TEST(thh_parser, parse_amount)
+{
+    EXPECT_EQ(detail::hh_parse_amount("$1.94 in chips"), 194);
+    EXPECT_EQ(detail::hh_parse_amount("calls $0.5"), 50);
+    EXPECT_EQ(detail::hh_parse_amount("(€1,234.56)"), 123456);
+    EXPECT_EQ(detail::hh_parse_amount("posts big blind 20"), 2000);
+    EXPECT_EQ(detail::hh_parse_amount("$3."), 300);
+    EXPECT_EQ(detail::hh_parse_amount("folds"), -1);
+}
+
+TEST(thh_parser, parse_hand)
+{
+    // real format: sitting out players, names with colons and spaces, "raises X to Y" with street totals, side pots, rake
+    constexpr std::string_view text =
+        "PokerStars Hand #222222222222:  Hold'em No Limit ($0.05/$0.10 USD) - 2021/01/01 12:00:00 ET\r\n"
+        "Table 'Alpha II' 6-max Seat #4 is the button\r\n"
+        "Seat 1: player one ($10 in chips)\r\n"
+        "Seat 2: B: colon ($12.50 in chips)\r\n"
+        "Seat 4: Hero ($10.20 in chips)\r\n"
+        "Seat 5: Villain ($5 in chips) is sitting out\r\n"
+        "Seat 6: sb guy ($10 in chips)\r\n"
+        "sb guy: posts small blind $0.05\r\n"
+        "player one: posts big blind $0.10\r\n"
+        "*** HOLE CARDS ***\r\n"
+        "Dealt to Hero [Ah Kh]\r\n"
+        "B: colon: raises $0.20 to $0.30\r\n"
+        "Hero: raises $0.60 to $0.90\r\n"
+        "sb guy: folds\r\n"
+        "player one: folds\r\n"
+        "B: colon: calls $0.60\r\n"
+        "*** FLOP *** [2c 7d Kd]\r\n"
+        "B: colon: checks\r\n"
+        "Hero: bets $1.20\r\n"
+        "B: colon: raises $2.40 to $3.60\r\n"
+        "Hero: calls $2.40\r\n"
+        "*** TURN *** [2c 7d Kd] [9s]\r\n"
+        "B: colon: bets $8 and is all-in\r\n"
+        "Hero: calls $5.70 and is all-in\r\n"
+        "Uncalled bet ($2.30) returned to B: colon\r\n"
+        "*** RIVER *** [2c 7d Kd 9s] [3h]\r\n"
+        "*** SHOW DOWN ***\r\n"
+        "B: colon: shows [7c 7h] (three of a kind, Sevens)\r\n"
+        "Hero: shows [Ah Kh] (a pair of Kings)\r\n"
+        "B: colon collected $19.90 from pot\r\n"
+        "*** SUMMARY ***\r\n"
+        "Total pot $20.55 | Rake $0.65\r\n"
+        "Board [2c 7d Kd 9s 3h]\r\n"
+        "Seat 1: player one (big blind) folded before Flop\r\n"
+        "Seat 2: B: colon showed [7c 7h] and won ($19.90) with three of a kind, Sevens\r\n"
+        "Seat 4: Hero (button) showed [Ah Kh] and lost with a pair of Kings\r\n"
+        "Seat 6: sb guy (small blind) folded before Flop\r\n"
+        "\r\n\r\n";
+
+    hh_hand_t hand;
+    std::vector<player_action_t> actions;
+    ASSERT_TRUE(parse_hand_ps(text, hand, actions));
+    EXPECT_EQ(hand.m_hand_id, 222222222222);
+    EXPECT_EQ(hand.m_num_players, 4);
+    EXPECT_EQ(hand.m_big_blind, 10);
+    EXPECT_EQ(hand.m_names, (std::array<std::string_view, 6>{"sb guy", "player one", "B: colon", "Hero", "", ""}));
+    EXPECT_EQ(hand.m_stacks, (std::array<int32_t, 6>{100'000, 100'000, 125'000, 102'000, 0, 0}));
+    EXPECT_EQ(hand.m_collected, (std::array<int32_t, 6>{0, 0, 199'000, 0, 0, 0}));
+    EXPECT_EQ(hand.m_rake, 6500);
+    EXPECT_EQ(hand.m_known_hands, 0b1100);
+    EXPECT_EQ(hand.hand(3), hand_2c("AhKh"));
+    EXPECT_EQ(hand.hand(2), hand_2c("7c7h"));
+    EXPECT_EQ(hand.m_num_board_cards, 5);
+    EXPECT_EQ(hand.known_cards(), cardset("2c7dKd9s3hAhKh7c7h"));
+
+    const std::vector<player_action_t> expected{
+        {3000, gb_action_t::RAISE, gb_pos_t::UTG},   {9000, gb_action_t::RAISE, gb_pos_t::MP},    {0, gb_action_t::FOLD, gb_pos_t::SB},
+        {0, gb_action_t::FOLD, gb_pos_t::BB},        {6000, gb_action_t::CALL, gb_pos_t::UTG},    {0, gb_action_t::CHECK, gb_pos_t::UTG},
+        {12000, gb_action_t::RAISE, gb_pos_t::MP},   {36000, gb_action_t::RAISE, gb_pos_t::UTG},  {24000, gb_action_t::CALL, gb_pos_t::MP},
+        {80000, gb_action_t::ALLIN, gb_pos_t::UTG},  {57000, gb_action_t::ALLIN, gb_pos_t::MP}};
+    EXPECT_EQ(actions, expected);
+    EXPECT_EQ(hand.m_num_actions, expected.size());
+
+    // replay and showdown
+    const auto game = hh_replay<4, 0, 1>(hand, actions);
+    EXPECT_TRUE(game.in_terminal_state());
+    EXPECT_EQ(game.pot_size(), 205'500);
+    card_dealer dealer{};
+    EXPECT_EQ(game.pot_distribution(hh_gamecards<4>(hand, dealer))[2], 205'500);
+    EXPECT_THROW(static_cast<void>(hh_replay<3, 0, 1>(hand, actions)), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(hh_gamecards<2>(hand, dealer)), std::runtime_error);
+    std::vector<player_action_t> wrong_order(actions.begin() + 1, actions.end());
+    EXPECT_THROW(static_cast<void>(hh_replay<4, 0, 1>(hand, wrong_order)), std::runtime_error);
+
+    // unsupported hands
+    const auto replace = [&](const std::string_view from, const std::string_view to) {
+        auto str = std::string(text);
+        str.replace(str.find(from), from.size(), to);
+        return str;
+    };
+    actions.clear();
+    EXPECT_FALSE(parse_hand_ps(replace("Hold'em No Limit", "Hold'em Pot Limit"), hand, actions));
+    EXPECT_FALSE(
+        parse_hand_ps(replace("player one: posts big", "player one: posts the ante $0.01\r\nplayer one: posts big"), hand, actions));
+    EXPECT_FALSE(parse_hand_ps(replace("$0.05\r\n", "$0.04\r\n"), hand, actions));
+    EXPECT_FALSE(parse_hand_ps(replace("[Ah Kh]", "[Xh Kh]"), hand, actions));
+    EXPECT_FALSE(parse_hand_ps(text.substr(0, text.find("*** SUMMARY")), hand, actions));
+    EXPECT_TRUE(actions.empty());
+}
+
+TEST(thh_parser, hh_replay_invalid_actions)
+{
+    hh_hand_t hand{};
+    hand.m_num_players = 3;
+    hand.m_stacks = {100'000, 100'000, 100'000, 0, 0, 0};
+
+    // blinds 500 / 1000: utg has to call 1000 and sb then 500 more
+    const std::vector<player_action_t> valid{{1000, gb_action_t::CALL, gb_pos_t::UTG}, {500, gb_action_t::CALL, gb_pos_t::SB}};
+    EXPECT_EQ((hh_replay<3, 0, 1>(hand, valid).pot_size()), 3000);
+
+    // the checks of gamestate::execute_action are compiled out with NDEBUG, hh_replay has to reject these in every build type
+    const std::vector<player_action_t> wrong_call{{1000, gb_action_t::CALL, gb_pos_t::UTG}, {7000, gb_action_t::CALL, gb_pos_t::SB}};
+    EXPECT_THROW(static_cast<void>(hh_replay<3, 0, 1>(hand, wrong_call)), std::runtime_error);
+    const std::vector<player_action_t> illegal_check{{0, gb_action_t::CHECK, gb_pos_t::UTG}, {500, gb_action_t::CALL, gb_pos_t::SB}};
+    EXPECT_THROW(static_cast<void>(hh_replay<3, 0, 1>(hand, illegal_check)), std::runtime_error);
+}
+
+TEST(thh_parser, parse_hand_inexact_amounts)
+{
+    // big blind $25: 1 cent is 0.4 mBB, only multiples of 5 cents can be represented
+    const auto make_hand = [](const std::string_view raise) {
+        return fmt::format(
+            "PokerStars Hand #1:  Hold'em No Limit ($12.50/$25 USD) - 2021/01/01 12:00:00 ET\r\n"
+            "Table 'Beta' 2-max Seat #1 is the button\r\n"
+            "Seat 1: Alf ($2500 in chips)\r\n"
+            "Seat 2: Bert ($2500 in chips)\r\n"
+            "Alf: posts small blind $12.50\r\n"
+            "Bert: posts big blind $25\r\n"
+            "*** HOLE CARDS ***\r\n"
+            "Alf: raises ${} to $75.05\r\n"
+            "Bert: folds\r\n"
+            "Alf collected $50 from pot\r\n"
+            "*** SUMMARY ***\r\n"
+            "Total pot $50 | Rake $0\r\n"
+            "\r\n\r\n",
+            raise);
+    };
+
+    hh_hand_t hand;
+    std::vector<player_action_t> actions;
+    ASSERT_TRUE(parse_hand_ps(make_hand("50.05"), hand, actions));
+    EXPECT_EQ(hand.m_big_blind, 2500);
+    EXPECT_EQ(hand.m_stacks[0], 100'000);
+    EXPECT_EQ(actions.front().m_amount, 2502);
+
+    actions.clear();
+    EXPECT_FALSE(parse_hand_ps(make_hand("50.01"), hand, actions));
+    EXPECT_TRUE(actions.empty());
+}
+
+TEST(thh_parser, hh_ps_roundtrip)
+{
+    const std::string filename{"hh_parser_test.txt"};
+    constexpr uint64_t c_num_hands = 300;
+
+    card_dealer dealer{};
+    fmt::memory_buffer buf;
+    std::vector<random_hand_t<2>> hands_2;
+    std::vector<random_hand_t<3>> hands_3;
+    std::vector<random_hand_t<6>> hands_6;
+    for (uint64_t i = 0; i < c_num_hands; ++i)
+    {
+        switch (i % 3)
+        {
+            case 0:
+                hands_2.push_back(hh_test::write_random_hand<2>(dealer, buf, i, c_config));
+                break;
+            case 1:
+                hands_3.push_back(hh_test::write_random_hand<3>(dealer, buf, i, c_config));
+                break;
+            default:
+                hands_6.push_back(hh_test::write_random_hand<6>(dealer, buf, i, c_config));
+                break;
+        }
+    }
+    hh_test::write_file(filename, buf);
+
+    // small chunks, so that most hands cross chunk boundaries
+    for (const unsigned num_threads : {1u, 3u})
+    {
+        const hh_file_ps file(filename, num_threads, 1000);
+        EXPECT_EQ(file.size(), buf.size());
+        EXPECT_EQ(file.num_skipped(), 0);
+        ASSERT_EQ(file.hands().size(), c_num_hands);
+        for (uint64_t i = 0; i < c_num_hands; ++i)
+        {
+            const auto& hand = file.hands()[i];
+            EXPECT_EQ(hand.m_hand_id, i);
+            EXPECT_TRUE(hand.m_text.starts_with("PokerStars Zoom Hand #"));
+            switch (i % 3)
+            {
+                case 0:
+                    check_parsed_hand(file, hand, hands_2[i / 3]);
+                    break;
+                case 1:
+                    check_parsed_hand(file, hand, hands_3[i / 3]);
+                    break;
+                default:
+                    check_parsed_hand(file, hand, hands_6[i / 3]);
+                    break;
+            }
+        }
+    }
+
+    std::filesystem::remove(filename);
+    EXPECT_THROW(hh_file_ps("file_does_not_exist.txt"), std::runtime_error);
+}
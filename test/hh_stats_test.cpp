@@ -0,0 +1,176 @@
+#include <mkpoker/game/game.hpp>
+#include <mkpoker/game/handhistory.hpp>
+#include <mkpoker/game/hh_binary.hpp>
+#include <mkpoker/game/hh_parser.hpp>
+#include <mkpoker/game/hh_stats.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "hh_test_util.hpp"
+
+using namespace mkp;
+
+namespace
+{
+    // hands with 2 and 6 players, seated randomly to mix positions
+    void write_ps_file(const std::string& filename, const uint64_t num_hands, const uint64_t first_id)
+    {
+        hh_test::write_ps_file<2, 6>(filename, num_hands, first_id, 1, {.m_shuffle_names = true});
+    }
+}    // namespace
+
+TEST(thh_stats, hand_stats)
+{
+    // UTG opens, SB 3bets, BB folds, UTG calls, SB cbets and UTG calls, checked down and UTG wins
+    hh_hand_t hand{};
+    hand.m_num_players = 3;
+    hand.m_names = {"SB", "BB", "UTG"};
+    hand.m_stacks = {100'000, 100'000, 100'000};
+    hand.m_collected = {0, 0, 39'000};
+    const std::vector<player_action_t> actions{
+        {3000, gb_action_t::RAISE, gb_pos_t::UTG}, {8500, gb_action_t::RAISE, gb_pos_t::SB}, {0, gb_action_t::FOLD, gb_pos_t::BB},
+        {6000, gb_action_t::CALL, gb_pos_t::UTG},  {10000, gb_action_t::RAISE, gb_pos_t::SB}, {10000, gb_action_t::CALL, gb_pos_t::UTG},
+        {0, gb_action_t::CHECK, gb_pos_t::SB},     {0, gb_action_t::CHECK, gb_pos_t::UTG},    {0, gb_action_t::CHECK, gb_pos_t::SB},
+        {0, gb_action_t::CHECK, gb_pos_t::UTG}};
+
+    const auto stats = hh_hand_stats(hand, actions);
+    const auto& sb = stats[0];
+    const auto& bb = stats[1];
+    const auto& utg = stats[2];
+
+    EXPECT_EQ(sb.m_hands, 1);
+    EXPECT_EQ(sb.m_vpip, 1);
+    EXPECT_EQ(sb.m_pfr, 1);
+    EXPECT_EQ(sb.m_3bet_opportunities, 1);
+    EXPECT_EQ(sb.m_3bets, 1);
+    EXPECT_EQ(sb.m_cbet_opportunities, 1);
+    EXPECT_EQ(sb.m_cbets, 1);
+    EXPECT_EQ(sb.m_saw_flop, 1);
+    EXPECT_EQ(sb.m_showdowns, 1);
+    EXPECT_EQ(sb.m_showdowns_won, 0);
+    EXPECT_EQ(sb.m_postflop_aggressive, 1);
+    EXPECT_EQ(sb.m_postflop_calls, 0);
+    EXPECT_EQ(sb.m_postflop_passive, 2);
+    EXPECT_EQ(sb.m_won, -19'000);
+
+    // facing two raises is no 3bet opportunity
+    EXPECT_EQ(bb.m_hands, 1);
+    EXPECT_EQ(bb.m_vpip, 0);
+    EXPECT_EQ(bb.m_3bet_opportunities, 0);
+    EXPECT_EQ(bb.m_saw_flop, 0);
+    EXPECT_EQ(bb.m_showdowns, 0);
+    EXPECT_EQ(bb.m_won, -1000);
+
+    EXPECT_EQ(utg.m_vpip, 1);
+    EXPECT_EQ(utg.m_pfr, 1);
+    EXPECT_EQ(utg.m_3bet_opportunities, 0);
+    EXPECT_EQ(utg.m_cbet_opportunities, 0);
+    EXPECT_EQ(utg.m_saw_flop, 1);
+    EXPECT_EQ(utg.m_showdowns, 1);
+    EXPECT_EQ(utg.m_showdowns_won, 1);
+    EXPECT_EQ(utg.m_postflop_calls, 1);
+    EXPECT_EQ(utg.m_postflop_passive, 2);
+    EXPECT_EQ(utg.m_won, 20'000);
+    EXPECT_EQ(stats[3], player_stats_t{});
+
+    // unfinished hands and wrong actions are rejected
+    EXPECT_THROW(static_cast<void>(hh_hand_stats(hand, std::span(actions).first(5))), std::runtime_error);
+    auto wrong = actions;
+    wrong[0].m_pos = gb_pos_t::SB;
+    EXPECT_THROW(static_cast<void>(hh_hand_stats(hand, wrong)), std::runtime_error);
+
+    // uncalled bets are not lost
+    hand.m_collected = {0, 0, 2500};
+    const std::vector<player_action_t> steal{
+        {3000, gb_action_t::RAISE, gb_pos_t::UTG}, {0, gb_action_t::FOLD, gb_pos_t::SB}, {0, gb_action_t::FOLD, gb_pos_t::BB}};
+    const auto stats_steal = hh_hand_stats(hand, steal);
+    EXPECT_EQ(stats_steal[0].m_won, -500);
+    EXPECT_EQ(stats_steal[1].m_won, -1000);
+    EXPECT_EQ(stats_steal[2].m_won, 1500);
+    EXPECT_EQ(stats_steal[2].m_saw_flop, 0);
+    EXPECT_EQ(stats_steal[1].m_3bet_opportunities, 1);
+    EXPECT_EQ(stats_steal[1].m_3bets, 0);
+    hand.m_collected = {0, 0, 39'000};
+
+    hh_stats db;
+    EXPECT_TRUE(db.add(hand, actions));
+    EXPECT_FALSE(db.add(hand, wrong));
+    EXPECT_EQ(db.num_hands(), 1);
+    EXPECT_EQ(db.num_skipped(), 1);
+    ASSERT_NE(db.find("SB"), nullptr);
+    EXPECT_EQ(*db.find("SB"), sb);
+    EXPECT_EQ(db.find("Nobody"), nullptr);
+    EXPECT_DOUBLE_EQ(db.find("UTG")->bb_per_100(), 2000.0);
+    EXPECT_DOUBLE_EQ(db.find("UTG")->aggression_frequency(), 0.0);
+    EXPECT_DOUBLE_EQ(db.find("SB")->aggression_frequency(), 1.0 / 3);
+}
+
+TEST(thh_stats, aggregation)
+{
+    const std::string ps_filename = "hh_stats_test.txt";
+    const std::string bin_filename = "hh_stats_test.bin";
+    const std::string stats_filename = "hh_stats_test.stats";
+    constexpr uint64_t c_num_hands = 2000;
+    write_ps_file(ps_filename, c_num_hands, 1);
+
+    const hh_file_ps file(ps_filename, 2);
+    ASSERT_EQ(file.hands().size(), c_num_hands);
+
+    // single and multi threaded aggregation agree
+    hh_stats single;
+    single.add(file, 1);
+    hh_stats multi;
+    multi.add(file, 4);
+    EXPECT_EQ(single.num_hands(), c_num_hands);
+    EXPECT_EQ(single.num_skipped(), 0);
+    EXPECT_EQ(single.players(), multi.players());
+    EXPECT_EQ(single.players().size(), 6);
+
+    // every hand counts for every player
+    const auto num_seats = std::accumulate(file.hands().cbegin(), file.hands().cend(), uint64_t(0),
+                                           [](const uint64_t acc, const hh_hand_t& hand) { return acc + hand.m_num_players; });
+    const auto total = std::accumulate(single.players().cbegin(), single.players().cend(), player_stats_t{},
+                                       [](player_stats_t acc, const auto& e) { return acc += e.second; });
+    EXPECT_EQ(total.m_hands, num_seats);
+    EXPECT_GT(total.m_vpip, 0);
+    EXPECT_GT(total.m_3bets, 0);
+    EXPECT_GT(total.m_cbets, 0);
+    EXPECT_GT(total.m_showdowns_won, 0);
+    EXPECT_LE(total.m_showdowns, total.m_saw_flop);
+    EXPECT_LE(total.m_pfr, total.m_vpip);
+
+    // the binary format gives the same stats
+    hh_convert_ps(ps_filename, bin_filename, 1, 128);
+    hh_stats binary;
+    binary.add(hh_binary_reader(bin_filename), 3);
+    EXPECT_EQ(binary.players(), single.players());
+    EXPECT_EQ(binary.num_hands(), c_num_hands);
+
+    // incremental: saved stats are loaded and updated with a new file
+    single.save(stats_filename);
+    hh_stats loaded(stats_filename);
+    EXPECT_EQ(loaded.players(), single.players());
+    EXPECT_EQ(loaded.num_hands(), single.num_hands());
+
+    write_ps_file(ps_filename, 500, 10'000);
+    const hh_file_ps file2(ps_filename, 2);
+    loaded.add(file2, 2);
+    single.add(file2, 1);
+    EXPECT_EQ(loaded.players(), single.players());
+    EXPECT_EQ(loaded.num_hands(), c_num_hands + 500);
+
+    std::filesystem::resize_file(stats_filename, 20);
+    EXPECT_THROW(hh_stats{stats_filename}, std::runtime_error);
+    EXPECT_THROW(hh_stats{ps_filename}, std::runtime_error);
+
+    std::filesystem::remove(ps_filename);
+    std::filesystem::remove(bin_filename);
+    std::filesystem::remove(stats_filename);
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <mkpoker/base/card.hpp>
+#include <mkpoker/game/game.hpp>
+#include <mkpoker/game/handhistory.hpp>
+#include <mkpoker/util/array.hpp>
+#include <mkpoker/util/card_generator.hpp>
+#include <mkpoker/util/file.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <fmt/format.h>
+
+// random hand histories written with hh_ps, shared by the hand history tests
+namespace mkp::hh_test
+{
+    struct random_hand_config_t
+    {
+        std::array<std::string, 6> m_names = {"Alf", "Bert", "Charles", "Dave", "Ethan", "Fred"};
+        // seat the players in random order to mix positions
+        bool m_shuffle_names = false;
+        // stacks are uniform in [m_min_stack, m_min_stack + m_stack_range) big blinds
+        uint32_t m_min_stack = 5;
+        uint32_t m_stack_range = 200;
+        // player whose hole cards are shown in the hand history
+        unsigned m_player_id = 0;
+    };
+
+    // a random hand as written by hh_ps, everything a parser should recover
+    template <std::size_t N>
+    struct random_hand_t
+    {
+        std::array<int32_t, N> m_stacks;
+        std::vector<player_action_t> m_actions;
+        std::array<int32_t, N> m_collected;
+        int32_t m_rake;
+        std::vector<uint8_t> m_cards;
+        std::array<bool, N> m_shown;
+    };
+
+    // play a hand with random actions and write its history to out (file or buffer)
+    template <std::size_t N, typename TOut>
+    random_hand_t<N> write_random_hand(card_dealer<>& dealer, TOut&& out, const uint64_t hand_id, const random_hand_config_t& config = {})
+    {
+        auto& rng = dealer.rng();
+        auto all_names = config.m_names;
+        if (config.m_shuffle_names)
+        {
+            std::shuffle(all_names.begin(), all_names.end(), rng);
+        }
+        auto names = make_array<std::string, N>([&](auto i) { return all_names[i]; });
+
+        random_hand_t<N> ret{};
+        ret.m_stacks = make_array<int32_t, N>(
+            [&](auto) { return static_cast<int32_t>(1000 * (config.m_min_stack + rng.bounded(config.m_stack_range))); });
+        const auto all_cards = dealer.deal<c_num_board_cards + 2 * N>();
+        for (auto&& c : all_cards)
+        {
+            ret.m_cards.push_back(c.m_card);
+        }
+        const gamecards<N> cards(all_cards);
+
+        auto game = gamestate<N, 1, 20>(ret.m_stacks);
+        auto printer = hh_ps(game, cards, names, out, config.m_player_id, 50'000, hand_id);
+        while (!game.in_terminal_state())
+        {
+            const auto actions = game.possible_actions();
+            const auto action = actions[rng.bounded(static_cast<uint32_t>(actions.size()))];
+            game.execute_action(action);
+            printer.add_action(action);
+            ret.m_actions.push_back(action);
+        }
+
+        ret.m_rake = game.rake_size();
+        ret.m_collected = {};
+        ret.m_shown = {};
+        if (game.is_showdown())
+        {
+            ret.m_collected = game.pot_distribution(cards);
+            const auto pots = game.all_pots();
+            for (auto&& pos : std::get<0>(pots.back()))
+            {
+                ret.m_shown[pos] = true;
+            }
+        }
+        else
+        {
+            for (uint8_t pos = 0; pos < N; ++pos)
+            {
+                if (game.all_players_state()[pos] != gb_playerstate_t::OUT)
+                {
+                    ret.m_collected[pos] = game.pot_size_rake_adjusted();
+                }
+            }
+        }
+        return ret;
+    }
+
+    // write the buffer to a file, throws if the file can not be written
+    inline void write_file(const std::string& filename, const fmt::memory_buffer& buf)
+    {
+        const auto f = detail::open_file(filename, "wb");
+        detail::write_binary(f.get(), buf.data(), buf.size());
+    }
+
+    // file with num_hands random hands, hand i has the (i % sizeof...(Ns))-th number of players and the id first_id + id_step * i
+    template <std::size_t... Ns>
+    void write_ps_file(const std::string& filename, const uint64_t num_hands, const uint64_t first_id, const uint64_t id_step = 1,
+                       const random_hand_config_t& config = {})
+    {
+        card_dealer dealer{};
+        fmt::memory_buffer buf;
+        for (uint64_t i = 0; i < num_hands; ++i)
+        {
+            std::size_t k = 0;
+            const auto write = [&](auto num_players) {
+                if (k++ == i % sizeof...(Ns))
+                {
+                    static_cast<void>(write_random_hand<num_players()>(dealer, buf, first_id + id_step * i, config));
+                }
+            };
+            (write(std::integral_constant<std::size_t, Ns>{}), ...);
+        }
+        write_file(filename, buf);
+    }
+}    // namespace mkp::hh_test
@@ -0,0 +1,69 @@
+#include <mkpoker/base/combo.hpp>
+#include <mkpoker/holdem/holdem_combo_evaluation.hpp>
+#include <mkpoker/holdem/holdem_evaluation.hpp>
+#include <mkpoker/util/card_generator.hpp>
+
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+using namespace mkp;
+
+TEST(tholdem_combo_evaluation, board_flush_suits)
+{
+    // rainbow and two tone boards: no flush possible
+    EXPECT_TRUE(board_flush_suits(cardset("AcKdQh")).none());
+    EXPECT_TRUE(board_flush_suits(cardset("AcKdQh2c3d")).none());
+
+    // three of a suit: both hole cards are needed
+    const auto three = board_flush_suits(cardset("AcKc2c7d"));
+    EXPECT_FALSE(three.none());
+    EXPECT_TRUE(three.can_flush(cardset("5c6c").as_bitset()));
+    EXPECT_FALSE(three.can_flush(cardset("5c6d").as_bitset()));
+    EXPECT_FALSE(three.can_flush(cardset("5h6d").as_bitset()));
+
+    // four of a suit: one hole card is enough
+    const auto four = board_flush_suits(cardset("AsKs2s7s"));
+    EXPECT_TRUE(four.can_flush(cardset("5s6d").as_bitset()));
+    EXPECT_FALSE(four.can_flush(cardset("5h6d").as_bitset()));
+
+    // board flush: every combo has a flush
+    const auto five = board_flush_suits(cardset("AhKh2h7h9h"));
+    EXPECT_TRUE(five.can_flush(cardset("5c6d").as_bitset()));
+}
+
+TEST(tholdem_combo_evaluation, evaluate_combos)
+{
+    card_dealer dealer{};
+    for (uint8_t board_size = 3; board_size <= 5; ++board_size)
+    {
+        for (int n = 0; n < 300; ++n)
+        {
+            const auto board = dealer.deal_cardset(board_size);
+            const auto results = evaluate_combos(board);
+            for (uint16_t i = 0; i < c_num_combos; ++i)
+            {
+                const auto combo = combo_cardset(i);
+                if (combo.intersects(board))
+                {
+                    EXPECT_EQ(results[i], 0);
+                }
+                else
+                {
+                    ASSERT_EQ(results[i], evaluate_unsafe(board.combine(combo)).as_bitset()) << board.str() << " " << combo.str();
+                }
+            }
+        }
+    }
+
+    // boards with quads, trips and a flush
+    for (auto&& board : {cardset("AcAdAhAs2c"), cardset("7c7d7h2s2c"), cardset("2h5h9hJhKh"), cardset("3c4c5c6d6h")})
+    {
+        const auto results = evaluate_combos(board);
+        (~blocked_combos(board)).for_each(
+            [&](const uint16_t i) { ASSERT_EQ(results[i], evaluate_unsafe(board.combine(combo_cardset(i))).as_bitset()); });
+    }
+
+    EXPECT_THROW(static_cast<void>(evaluate_combos(cardset("AcKd"))), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(evaluate_combos(cardset("AcKdQh2c3d4s"))), std::runtime_error);
+}
@@ -0,0 +1,91 @@
+// the larger tables are tested against the evaluation with the default tables
+#define MKP_EVAL_TABLE_SIZE 2
+
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/holdem/holdem_evaluation.hpp>
+#include <mkpoker/holdem/holdem_lookup_tables.hpp>
+#include <mkpoker/holdem/holdem_result.hpp>
+#include <mkpoker/util/card_generator.hpp>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+using namespace mkp;
+
+namespace
+{
+    // a different object, so the evaluation does not use the larger tables
+    inline constexpr auto c_table_straight_copy = mkpoker_table_straight;
+
+    holdem_result evaluate_reference(const cardset cs)
+    {
+        const uint64_t mask = cs.as_bitset();
+        const uint16_t mask_c = (mask >> (0 * c_num_ranks)) & c_mask_ranks;
+        const uint16_t mask_d = (mask >> (1 * c_num_ranks)) & c_mask_ranks;
+        const uint16_t mask_h = (mask >> (2 * c_num_ranks)) & c_mask_ranks;
+        const uint16_t mask_s = (mask >> (3 * c_num_ranks)) & c_mask_ranks;
+        if (const auto lanes = detail::flush_lanes(mask_c, mask_d, mask_h, mask_s); lanes)
+        {
+            const auto suit = std::countr_zero(lanes) / 16;
+            return detail::flush_or_straight_flush<c_table_straight_copy>((mask >> (suit * c_num_ranks)) & c_mask_ranks);
+        }
+        return detail::evaluate_no_flush<c_table_straight_copy>(mask_c, mask_d, mask_h, mask_s);
+    }
+}    // namespace
+
+TEST(tholdem_lookup_tables, tables)
+{
+    EXPECT_EQ(mkpoker_table_straight[0b1'0000'0000'1111], c_rank_five);
+    EXPECT_EQ(mkpoker_table_straight[0b0'0000'0001'1111], c_rank_six);
+    EXPECT_EQ(mkpoker_table_straight[0b1'1111'0000'0000], c_rank_ace);
+    EXPECT_EQ(mkpoker_table_straight[0b1'1111'1000'1111], c_rank_ace);
+    EXPECT_EQ(mkpoker_table_straight[0b1'0111'1000'0111], 0);
+    for (std::size_t mask = 0; mask < c_num_rank_masks; ++mask)
+    {
+        // the kickers are the highest ranks of the mask
+        const auto top3 = mkpoker_table_top3[mask];
+        const auto top5 = mkpoker_table_top5[mask];
+        EXPECT_EQ(std::popcount(top3), std::min(std::popcount(mask), 3));
+        EXPECT_EQ(std::popcount(top5), std::min(std::popcount(mask), 5));
+        EXPECT_EQ(top3 & ~mask, 0);
+        EXPECT_EQ(top5 & top3, top3);
+        EXPECT_LE(mask & ~top5, top5 & (~top5 + 1u));
+    }
+}
+
+TEST(tholdem_lookup_tables, evaluation)
+{
+    for (auto i1 = 0; i1 < c_deck_size; ++i1)
+    {
+        for (auto i2 = i1 + 1; i2 < c_deck_size; ++i2)
+        {
+            for (auto i3 = i2 + 1; i3 < c_deck_size; ++i3)
+            {
+                for (auto i4 = i3 + 1; i4 < c_deck_size; ++i4)
+                {
+                    for (auto i5 = i4 + 1; i5 < c_deck_size; ++i5)
+                    {
+                        const cardset cs{make_bitset(i1, i2, i3, i4, i5)};
+                        const auto expected = evaluate_reference(cs);
+                        ASSERT_EQ(evaluate_unsafe(cs), expected) << cs.str();
+                        ASSERT_EQ(evaluate<5>(cs), expected) << cs.str();
+                    }
+                }
+            }
+        }
+    }
+
+    card_dealer dealer{};
+    for (int i = 0; i < 1'000'000; ++i)
+    {
+        const auto cs6 = dealer.deal_cardset(6);
+        ASSERT_EQ(evaluate_unsafe(cs6), evaluate_reference(cs6)) << cs6.str();
+        ASSERT_EQ(evaluate<6>(cs6), evaluate_reference(cs6)) << cs6.str();
+        const auto cs7 = dealer.deal_cardset(7);
+        ASSERT_EQ(evaluate_unsafe(cs7), evaluate_reference(cs7)) << cs7.str();
+        ASSERT_EQ(evaluate<7>(cs7), evaluate_reference(cs7)) << cs7.str();
+    }
+}
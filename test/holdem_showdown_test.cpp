@@ -0,0 +1,82 @@
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/combo.hpp>
+#include <mkpoker/base/combo_range.hpp>
+#include <mkpoker/holdem/holdem_evaluation.hpp>
+#include <mkpoker/holdem/holdem_showdown.hpp>
+#include <mkpoker/util/card_generator.hpp>
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+using namespace mkp;
+
+TEST(tholdem_showdown, river_combo_order)
+{
+    const cardset board("AcKdQh7s2c");
+    const auto order = river_combo_order(board);
+    ASSERT_EQ(order.m_size, 1081);
+    for (uint16_t k = 1; k < order.m_size; ++k)
+    {
+        const auto prev = order.m_combos[k - 1];
+        const auto cur = order.m_combos[k];
+        EXPECT_LE(order.m_values[prev], order.m_values[cur]);
+        EXPECT_EQ(order.m_ranks[cur], order.m_ranks[prev] + (order.m_values[prev] != order.m_values[cur]));
+    }
+    EXPECT_EQ(order.m_ranks[order.m_combos[0]], 0);
+    // JT makes the nuts, the weakest hands are 3-4 and 3-5 without a pair
+    EXPECT_EQ(order.m_ranks[combo_index(hand_2c("JsTs"))], order.m_ranks[order.m_combos[order.m_size - 1]]);
+    EXPECT_EQ(order.m_ranks[combo_index(hand_2c("3d4d"))], 0);
+    EXPECT_EQ(order.m_values[combo_index(hand_2c("AcKc"))], 0);
+
+    EXPECT_THROW(static_cast<void>(river_combo_order(cardset("AcKdQh7s"))), std::runtime_error);
+}
+
+TEST(tholdem_showdown, river_showdown)
+{
+    card_dealer dealer{};
+    for (int n = 0; n < 10; ++n)
+    {
+        const auto board = dealer.deal_cardset(5);
+        std::array<float, c_num_combos> weights{};
+        for (auto&& w : weights)
+        {
+            w = static_cast<float>(dealer.rng().bounded(1001)) / 1000.0f;
+        }
+        const auto order = river_combo_order(board);
+        const auto showdown = river_showdown(order, weights);
+
+        // pairwise
+        const auto live = ~blocked_combos(board);
+        live.for_each([&](const uint16_t hero) {
+            double win = 0.0;
+            double tie = 0.0;
+            double lose = 0.0;
+            live.for_each([&](const uint16_t villain) {
+                if (detail::c_combo_bitsets[hero] & detail::c_combo_bitsets[villain])
+                {
+                    return;
+                }
+                const auto h = evaluate_unsafe(cardset{board.as_bitset() | detail::c_combo_bitsets[hero]});
+                const auto v = evaluate_unsafe(cardset{board.as_bitset() | detail::c_combo_bitsets[villain]});
+                (h > v ? win : (h == v ? tie : lose)) += weights[villain];
+            });
+            ASSERT_NEAR(showdown[hero].m_win, win, 1e-3) << board.str() << " " << combo_hand(hero).str();
+            ASSERT_NEAR(showdown[hero].m_tie, tie, 1e-3) << board.str() << " " << combo_hand(hero).str();
+            ASSERT_NEAR(showdown[hero].m_lose, lose, 1e-3) << board.str() << " " << combo_hand(hero).str();
+        });
+        blocked_combos(board).for_each([&](const uint16_t i) { EXPECT_EQ(showdown[i].equity(), 0.0f); });
+    }
+
+    // uniform range: the nuts win against everything
+    const cardset board("AcKdQh7s2c");
+    const auto showdown = river_showdown(board, combo_range(1.0f));
+    const auto nuts = showdown[combo_index(hand_2c("JsTs"))];
+    EXPECT_FLOAT_EQ(nuts.m_lose, 0.0f);
+    // JT of other suits tie, all other combos without Js / Ts lose
+    EXPECT_FLOAT_EQ(nuts.m_tie, 9.0f);
+    EXPECT_FLOAT_EQ(nuts.m_win + nuts.m_tie, 45.0f * 44.0f / 2.0f);
+    EXPECT_GT(nuts.equity(), 0.99f);
+}
@@ -0,0 +1,118 @@
+#include <mkpoker/base/hand.hpp>
+#include <mkpoker/holdem/holdem_equity_calculation.hpp>
+#include <mkpoker/holdem/holdem_evaluation.hpp>
+#include <mkpoker/holdem/holdem_state_table.hpp>
+
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace mkp;
+
+TEST(tholdem_state_table, result_from_bitset)
+{
+    for (auto&& cs : {cardset("AcKcQcJcTc"), cardset("2c2d2h2s3c"), cardset("AcAdKhKsQc7d"), cardset("2c3d4h5s7c9dJh")})
+    {
+        const auto result = evaluate_unsafe(cs);
+        EXPECT_EQ(holdem_result_from_bitset(result.as_bitset()), result);
+    }
+}
+
+TEST(tholdem_state_table, state_table)
+{
+    // one test, so the table is only created once
+    const std::string filename = "holdem_state_table_test.bin";
+    save_state_table(filename, make_state_table());
+    const holdem_state_table table(filename);
+    EXPECT_EQ(table.num_states(), 612'977);
+
+    // every 5, 6 and 7 card hand, the states of the first cards are reused
+    const auto c0 = table.start();
+    for (uint8_t i1 = 0; i1 < c_deck_size; ++i1)
+    {
+        auto c1 = c0;
+        c1.add(card{i1});
+        for (uint8_t i2 = i1 + 1; i2 < c_deck_size; ++i2)
+        {
+            auto c2 = c1;
+            c2.add(card{i2});
+            for (uint8_t i3 = i2 + 1; i3 < c_deck_size; ++i3)
+            {
+                auto c3 = c2;
+                c3.add(card{i3});
+                for (uint8_t i4 = i3 + 1; i4 < c_deck_size; ++i4)
+                {
+                    auto c4 = c3;
+                    c4.add(card{i4});
+                    for (uint8_t i5 = i4 + 1; i5 < c_deck_size; ++i5)
+                    {
+                        auto c5 = c4;
+                        c5.add(card{i5});
+                        const cardset cs5{make_bitset(i1, i2, i3, i4, i5)};
+                        ASSERT_EQ(c5.result(), evaluate_unsafe(cs5));
+                        for (uint8_t i6 = i5 + 1; i6 < c_deck_size; ++i6)
+                        {
+                            auto c6 = c5;
+                            c6.add(card{i6});
+                            const auto cs6 = cs5.combine(card{i6});
+                            ASSERT_EQ(c6.result(), evaluate_unsafe(cs6));
+                            for (uint8_t i7 = i6 + 1; i7 < c_deck_size; ++i7)
+                            {
+                                auto c7 = c6;
+                                c7.add(card{i7});
+                                ASSERT_EQ(c7.result_bits(), evaluate_unsafe(cs6.combine(card{i7})).as_bitset());
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // the order of the cards does not matter
+    auto c = table.start();
+    for (auto&& str : {"9h", "2c", "Kh", "Th", "Kd", "Jh", "Qh"})
+    {
+        c.add(card{str});
+    }
+    EXPECT_EQ(c.size(), 7);
+    EXPECT_EQ(c.result(), evaluate_unsafe(cardset("9h2cKhThKdJhQh")));
+    EXPECT_EQ(c.result().type(), c_straight_flush);
+    EXPECT_EQ(table.evaluate(cardset("AcAdAh2s2c")).type(), c_full_house);
+
+    // same equities as with the direct evaluation
+    const std::vector<std::vector<hand_2c>> all_hands{
+        {hand_2c("AhKh"), hand_2c("QsQd")}, {hand_2c("7c2d"), hand_2c("8s9s"), hand_2c("AdAc")}, {hand_2c("Ts9s"), hand_2c("Js8s")}};
+    const std::vector<std::vector<card>> boards{{}, {card("2s"), card("3s"), card("Kd")}, {card("Ks"), card("5s"), card("5h"), card("Qc")}};
+
+    for (auto&& hands : all_hands)
+    {
+        for (auto&& board : boards)
+        {
+            const auto expected = calculate_equities(hands, board);
+            const auto actual = calculate_equities(hands, board, table);
+            EXPECT_EQ(actual.m_wins, expected.m_wins);
+            EXPECT_EQ(actual.m_ties, expected.m_ties);
+            EXPECT_EQ(actual.m_equities, expected.m_equities);
+        }
+    }
+
+    const std::vector<card> river{card("2s"), card("3s"), card("Kd"), card("7h"), card("7d")};
+    EXPECT_EQ(calculate_equities(all_hands[0], river, table).m_wins, calculate_equities(all_hands[0], river).m_wins);
+    EXPECT_THROW(static_cast<void>(calculate_equities({hand_2c("AhKh"), hand_2c("AhQd")}, {}, table)), std::runtime_error);
+
+    // invalid files
+    const std::string filename_invalid = "holdem_state_table_test_invalid.bin";
+    std::filesystem::copy_file(filename, filename_invalid, std::filesystem::copy_options::overwrite_existing);
+    std::filesystem::resize_file(filename_invalid, std::filesystem::file_size(filename_invalid) - 4);
+    EXPECT_THROW(holdem_state_table{filename_invalid}, std::runtime_error);
+    std::filesystem::resize_file(filename_invalid, 16);
+    EXPECT_THROW(holdem_state_table{filename_invalid}, std::runtime_error);
+    EXPECT_THROW(holdem_state_table{"does_not_exist.bin"}, std::runtime_error);
+
+    std::filesystem::remove(filename);
+    std::filesystem::remove(filename_invalid);
+}
@@ -0,0 +1,145 @@
+#include <mkpoker/base/card.hpp>
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/holdem/holdem_evaluation.hpp>
+#include <mkpoker/omaha/omaha_equity_calculation.hpp>
+#include <mkpoker/omaha/omaha_evaluation.hpp>
+#include <mkpoker/util/card_generator.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace mkp;
+
+namespace
+{
+    // all 2 + 3 card combinations with the generic evaluator
+    holdem_result omaha_brute_force(const cardset hole, const cardset board)
+    {
+        const auto hole_cards = hole.as_cards();
+        const auto board_cards = board.as_cards();
+        holdem_result best(c_no_pair, 0, 0, 0);
+        for (std::size_t h1 = 0; h1 < hole_cards.size(); ++h1)
+        {
+            for (std::size_t h2 = h1 + 1; h2 < hole_cards.size(); ++h2)
+            {
+                for (std::size_t b1 = 0; b1 < board_cards.size(); ++b1)
+                {
+                    for (std::size_t b2 = b1 + 1; b2 < board_cards.size(); ++b2)
+                    {
+                        for (std::size_t b3 = b2 + 1; b3 < board_cards.size(); ++b3)
+                        {
+                            const cardset cs{hole_cards[h1], hole_cards[h2], board_cards[b1], board_cards[b2], board_cards[b3]};
+                            best = std::max(best, evaluate_unsafe(cs));
+                        }
+                    }
+                }
+            }
+        }
+        return best;
+    }
+}    // namespace
+
+TEST(tomaha, evaluation)
+{
+    // exactly two hole cards: no four of a kind and no flush with only one hole card
+    EXPECT_EQ(evaluate_omaha_safe(cardset("AhAsAdAc"), cardset("KhQhJhTh2c")).type(), c_one_pair);
+    EXPECT_EQ(evaluate_omaha_safe(cardset("Ah2c3d4s"), cardset("KhQhJhTh9h")).type(), c_no_pair);
+    EXPECT_EQ(evaluate_omaha_safe(cardset("AhKh2c3d"), cardset("QhJhTh")).type(), c_straight_flush);
+    // exactly three board cards: no trips from trips in hand, but a full house with a pair
+    EXPECT_EQ(evaluate_omaha_safe(cardset("7c7d7hAs"), cardset("2c3d4hKs9h")).type(), c_one_pair);
+    EXPECT_EQ(evaluate_omaha_safe(cardset("7c7d2s3h"), cardset("7h2c2dKs9h")).type(), c_full_house);
+
+    card_dealer dealer{};
+    for (uint8_t board_size = 3; board_size <= 5; ++board_size)
+    {
+        for (int n = 0; n < 5000; ++n)
+        {
+            const auto cards = dealer.deal_cardset(static_cast<uint8_t>(4 + board_size));
+            const auto all = cards.as_cards();
+            const cardset hole{all[0], all[2], all[4], all[6]};
+            cardset board = cards;
+            board.remove(hole);
+            ASSERT_EQ(evaluate_omaha_unsafe(hole, board), omaha_brute_force(hole, board)) << hole.str() << " " << board.str();
+        }
+    }
+
+    EXPECT_THROW(static_cast<void>(evaluate_omaha_safe(cardset("AhAsAd"), cardset("KhQhJh"))), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(evaluate_omaha_safe(cardset("AhAsAdAc"), cardset("KhQh"))), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(evaluate_omaha_safe(cardset("AhAsAdAc"), cardset("KhQhJhTh9h8h"))), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(evaluate_omaha_safe(cardset("AhAsAdAc"), cardset("KhQhAh"))), std::runtime_error);
+}
+
+TEST(tomaha, equities)
+{
+    const std::vector<cardset> hands{cardset("AhAsKhKs"), cardset("QcJcTc9c"), cardset("8d8h7d6s")};
+
+    // river: single runout
+    const std::vector<card> river{card("2c"), card("5d"), card("Td"), card("Kd"), card("3h")};
+    const auto res_river = calculate_equities_omaha(hands, river);
+    std::vector<holdem_result> results;
+    for (auto&& hand : hands)
+    {
+        results.push_back(evaluate_omaha_unsafe(hand, cardset(river)));
+    }
+    const auto winner = std::max_element(results.cbegin(), results.cend()) - results.cbegin();
+    EXPECT_EQ(res_river.m_wins[static_cast<std::size_t>(winner)], 1);
+    EXPECT_FLOAT_EQ(res_river.m_equities[static_cast<std::size_t>(winner)], 100.0f);
+
+    // turn: all river cards by hand
+    const std::vector<card> turn{card("2c"), card("5d"), card("Td"), card("Kd")};
+    const auto res_turn = calculate_equities_omaha(hands, turn, 1);
+    std::vector<uint32_t> wins(hands.size(), 0);
+    std::vector<uint32_t> ties(hands.size(), 0);
+    cardset dead(turn);
+    for (auto&& hand : hands)
+    {
+        dead.join(hand);
+    }
+    for (uint8_t i = 0; i < c_deck_size; ++i)
+    {
+        const card c{i};
+        if (dead.contains(c))
+        {
+            continue;
+        }
+        const auto board = cardset(turn).combine(c);
+        std::vector<holdem_result> res;
+        for (auto&& hand : hands)
+        {
+            res.push_back(omaha_brute_force(hand, board));
+        }
+        const auto best = *std::max_element(res.cbegin(), res.cend());
+        const auto num_best = std::count(res.cbegin(), res.cend(), best);
+        for (std::size_t n = 0; n < res.size(); ++n)
+        {
+            if (res[n] == best)
+            {
+                (num_best > 1 ? ties : wins)[n] += 1;
+            }
+        }
+    }
+    EXPECT_EQ(res_turn.m_wins, wins);
+    EXPECT_EQ(res_turn.m_ties, ties);
+
+    // the number of threads does not change the result
+    const std::vector<card> flop{card("2c"), card("5d"), card("Td")};
+    const auto res_single = calculate_equities_omaha(hands, flop, 1);
+    const auto res_multi = calculate_equities_omaha(hands, flop, 4);
+    EXPECT_EQ(res_single.m_wins, res_multi.m_wins);
+    EXPECT_EQ(res_single.m_ties, res_multi.m_ties);
+    EXPECT_EQ(res_single.m_equities, res_multi.m_equities);
+    const auto res_preflop = calculate_equities_omaha({cardset("AhAsKhKs"), cardset("QcJcTc9c")}, {}, 2);
+    EXPECT_GT(res_preflop.m_equities[0], 50.0f);
+    EXPECT_LT(res_preflop.m_equities[0], 75.0f);
+
+    // invalid input
+    EXPECT_THROW(static_cast<void>(calculate_equities_omaha({cardset("AhAsKhKs")}, flop)), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(calculate_equities_omaha({cardset("AhAsKhKs"), cardset("QcJcTc")}, flop)), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(calculate_equities_omaha({cardset("AhAsKhKs"), cardset("AhJcTc9c")}, flop)), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(calculate_equities_omaha(hands, {card("Ah"), card("2c"), card("3c")})), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(calculate_equities_omaha(hands, {card("2c"), card("2c"), card("3c")})), std::runtime_error);
+}
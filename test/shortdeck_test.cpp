@@ -0,0 +1,144 @@
+#include <mkpoker/base/card.hpp>
+#include <mkpoker/base/cardset.hpp>
+#include <mkpoker/base/hand.hpp>
+#include <mkpoker/holdem/holdem_evaluation.hpp>
+#include <mkpoker/shortdeck/shortdeck_equity_calculation.hpp>
+#include <mkpoker/shortdeck/shortdeck_evaluation.hpp>
+#include <mkpoker/util/card_generator.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace mkp;
+
+namespace
+{
+    uint16_t rank_mask(const cardset cs)
+    {
+        const uint64_t mask = cs.as_bitset();
+        const uint64_t ranks = mask | (mask >> c_num_ranks) | (mask >> (2 * c_num_ranks)) | (mask >> (3 * c_num_ranks));
+        return static_cast<uint16_t>(ranks & c_mask_ranks);
+    }
+
+    // cards of a deck with 9 ranks, shifted to six and above
+    cardset to_shortdeck(const cardset cs)
+    {
+        const uint64_t mask = cs.as_bitset();
+        uint64_t ret = 0;
+        for (uint8_t s = 0; s < c_num_suits; ++s)
+        {
+            ret |= ((mask >> (s * c_num_ranks)) & 0x1FF) << (s * c_num_ranks + c_shortdeck_min_rank);
+        }
+        return cardset{ret};
+    }
+
+    // the ace plays as five in the holdem evaluator to find the A-6-7-8-9 straights
+    shortdeck_result shortdeck_reference(const cardset cs)
+    {
+        uint64_t low = cs.as_bitset();
+        for (uint8_t s = 0; s < c_num_suits; ++s)
+        {
+            const uint64_t ace = uint64_t(1) << (s * c_num_ranks + c_rank_ace);
+            if (low & ace)
+            {
+                low ^= ace | (uint64_t(1) << (s * c_num_ranks + c_rank_five));
+            }
+        }
+        return std::max(shortdeck_result(evaluate_unsafe(cs)), shortdeck_result(evaluate_unsafe(cardset{low})));
+    }
+}    // namespace
+
+TEST(tshortdeck, evaluation)
+{
+    // the lowest straight is A-6-7-8-9, A-2-3-4-5 does not exist
+    EXPECT_EQ(detail::c_shortdeck_table_straight[rank_mask(cardset("As6c7d8h9s"))], c_rank_nine);
+    EXPECT_EQ(detail::c_shortdeck_table_straight[rank_mask(cardset("6c7d8h9sTs"))], c_rank_ten);
+    EXPECT_EQ(detail::c_shortdeck_table_straight[rank_mask(cardset("AsKcQdJhTs"))], c_rank_ace);
+    EXPECT_EQ(detail::c_shortdeck_table_straight[rank_mask(cardset("As2c3d4h5s"))], 0);
+
+    const auto wheel = evaluate_shortdeck_safe(cardset("As6c7d8h9sKd"));
+    EXPECT_EQ(wheel.type(), c_straight);
+    EXPECT_EQ(wheel.as_holdem_result().major_rank().m_rank, c_rank_nine);
+    EXPECT_EQ(evaluate_shortdeck_safe(cardset("As6s7s8s9sKd")).type(), c_straight_flush);
+
+    // a flush beats a full house, everything else is ordered as in holdem
+    const auto flush = evaluate_shortdeck_safe(cardset("6h8hThQhKh"));
+    const auto full_house = evaluate_shortdeck_safe(cardset("AcAdAhKsKc"));
+    const auto quads = evaluate_shortdeck_safe(cardset("6c6d6h6sKc"));
+    EXPECT_EQ(flush.type(), c_flush);
+    EXPECT_EQ(full_house.type(), c_full_house);
+    EXPECT_GT(flush, full_house);
+    EXPECT_LT(flush, quads);
+    EXPECT_GT(full_house, evaluate_shortdeck_safe(cardset("AcKdQhJsTc")));
+    EXPECT_EQ(flush.str(), flush.as_holdem_result().str());
+
+    card_dealer<c_rank_ten> dealer{};
+    for (uint8_t n = 5; n <= 7; ++n)
+    {
+        for (int i = 0; i < 20'000; ++i)
+        {
+            const auto cs = to_shortdeck(dealer.deal_cardset(n));
+            ASSERT_EQ(cs.size(), n);
+            ASSERT_EQ(evaluate_shortdeck_unsafe(cs), shortdeck_reference(cs)) << cs.str();
+        }
+    }
+
+    EXPECT_THROW(static_cast<void>(evaluate_shortdeck_safe(cardset("As6c7d8h"))), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(evaluate_shortdeck_safe(cardset("As6c7d8h9sKdKcKh"))), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(evaluate_shortdeck_safe(cardset("As6c7d8h5s"))), std::runtime_error);
+}
+
+TEST(tshortdeck, equities)
+{
+    const std::vector<hand_2c> hands{hand_2c("AhKh"), hand_2c("QsQc"), hand_2c("9d8d")};
+    const std::vector<card> flop{card("Th"), card("7d"), card("6c")};
+    const auto res = calculate_equities_shortdeck(hands, flop);
+
+    // all turn and river cards by hand
+    std::vector<uint32_t> wins(hands.size(), 0);
+    std::vector<uint32_t> ties(hands.size(), 0);
+    cardset dead(flop);
+    for (auto&& hand : hands)
+    {
+        dead.join(hand.as_cardset());
+    }
+    const auto live = cardset{c_shortdeck_mask & ~dead.as_bitset()}.as_cards();
+    ASSERT_EQ(live.size(), c_shortdeck_deck_size - 9);
+    for (std::size_t t = 0; t < live.size(); ++t)
+    {
+        for (std::size_t r = t + 1; r < live.size(); ++r)
+        {
+            const auto board = cardset(flop).combine(cardset{live[t], live[r]});
+            std::vector<shortdeck_result> results;
+            for (auto&& hand : hands)
+            {
+                results.push_back(shortdeck_reference(board.combine(hand.as_cardset())));
+            }
+            const auto best = *std::max_element(results.cbegin(), results.cend());
+            const auto num_best = std::count(results.cbegin(), results.cend(), best);
+            for (std::size_t n = 0; n < results.size(); ++n)
+            {
+                if (results[n] == best)
+                {
+                    (num_best > 1 ? ties : wins)[n] += 1;
+                }
+            }
+        }
+    }
+    EXPECT_EQ(res.m_wins, wins);
+    EXPECT_EQ(res.m_ties, ties);
+
+    // preflop: all 5 card boards of the remaining 32 cards
+    const auto res_preflop = calculate_equities_shortdeck({hand_2c("AhAs"), hand_2c("KcKd")});
+    EXPECT_EQ(std::accumulate(res_preflop.m_wins.cbegin(), res_preflop.m_wins.cend(), uint32_t(0)) + res_preflop.m_ties[0], 201'376);
+    EXPECT_GT(res_preflop.m_equities[0], 70.0f);
+
+    EXPECT_THROW(static_cast<void>(calculate_equities_shortdeck({hand_2c("AhKh"), hand_2c("2c2d")})), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(calculate_equities_shortdeck(hands, {card("Th"), card("5d"), card("6c")})), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(calculate_equities_shortdeck({hand_2c("AhKh")}, flop)), std::runtime_error);
+}
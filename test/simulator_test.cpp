@@ -0,0 +1,84 @@
+#include <mkpoker/game/simulator.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace mkp;
+
+TEST(tsimulator, duplicate_deals)
+{
+    // identical deterministic agents: with duplicate deals every deal is a draw
+    hand_simulator<2> sim({calling_station_policy<2>, calling_station_policy<2>});
+    simulation_options_t options{};
+    options.m_num_deals = 2'000;
+    options.m_num_threads = 2;
+    const auto result = sim.run(options);
+
+    EXPECT_EQ(result.m_num_hands, 4'000);
+    for (auto&& agent : result.m_agents)
+    {
+        EXPECT_EQ(agent.m_mean, 0.0);
+        EXPECT_EQ(agent.m_stddev, 0.0);
+    }
+
+    // without duplicate deals, there is variance
+    options.m_duplicate = false;
+    const auto result_nd = sim.run(options);
+    EXPECT_EQ(result_nd.m_num_hands, 2'000);
+    EXPECT_GT(result_nd.m_agents[0].m_stddev, 0.0);
+    EXPECT_LT(std::abs(result_nd.m_agents[0].m_mean), 4 * result_nd.m_agents[0].m_ci95);
+}
+
+TEST(tsimulator, zero_sum_and_reproducible)
+{
+    hand_simulator<3> sim({random_policy<3>, calling_station_policy<3>, random_policy<3>});
+    simulation_options_t options{};
+    options.m_num_deals = 3'000;
+    options.m_num_threads = 1;
+    const auto result = sim.run(options);
+
+    // no rake: sum of all winnings is zero
+    double sum = 0.0;
+    for (auto&& agent : result.m_agents)
+    {
+        sum += agent.m_mean;
+        EXPECT_GT(agent.m_ci95, 0.0);
+    }
+    EXPECT_NEAR(sum, 0.0, 1e-9);
+
+    // the result does not depend on the number of threads
+    options.m_num_threads = 3;
+    const auto result_mt = sim.run(options);
+    for (unsigned a = 0; a < 3; ++a)
+    {
+        EXPECT_EQ(result.m_agents[a].m_mean, result_mt.m_agents[a].m_mean);
+        EXPECT_EQ(result.m_agents[a].m_stddev, result_mt.m_agents[a].m_stddev);
+    }
+
+    // but on the seed
+    options.m_seed = 42;
+    EXPECT_NE(sim.run(options).m_agents[0].m_mean, result.m_agents[0].m_mean);
+}
+
+TEST(tsimulator, rake)
+{
+    hand_simulator<2, 1, 20> sim({calling_station_policy<2, 1, 20>, random_policy<2, 1, 20>});
+    simulation_options_t options{};
+    options.m_num_deals = 1'000;
+    const auto result = sim.run(options);
+    EXPECT_LT(result.m_agents[0].m_mean + result.m_agents[1].m_mean, 0.0);
+}
+
+TEST(tsimulator, invalid_args)
+{
+    EXPECT_THROW(hand_simulator<3>({random_policy<3>, random_policy<3>}), std::runtime_error);
+
+    hand_simulator<2> sim({random_policy<2>, random_policy<2>});
+    simulation_options_t options{};
+    options.m_num_deals = 1;
+    EXPECT_THROW(static_cast<void>(sim.run(options)), std::runtime_error);
+}